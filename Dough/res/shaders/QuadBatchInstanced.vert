@@ -0,0 +1,44 @@
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+
+layout (set = 0, binding = 0) uniform UniformBufferObject {
+	mat4 projView;
+} ubo;
+
+//Per-instance input (VK_VERTEX_INPUT_RATE_INSTANCE)
+layout (location = 0) in vec3 mQuadPos;
+layout (location = 1) in vec2 mQuadSize;
+layout (location = 2) in float mQuadRotation;
+layout (location = 3) in vec4 mColour;
+layout (location = 4) in vec4 mTexCoords; //botLeft.x, botLeft.y, topRight.x, topRight.y
+layout (location = 5) in float mTexIndex;
+
+layout (location = 0) out vec4 vFragColour;
+layout (location = 1) out vec2 vTexCoord;
+layout (location = 2) out float vTexIndex;
+
+//Same winding as the indexed quad batch (0, 1, 2, 2, 3, 0) using bot left, bot right, top right, top left.
+const vec2 CORNERS[6] = vec2[](
+	vec2(0.0, 0.0),
+	vec2(1.0, 0.0),
+	vec2(1.0, 1.0),
+	vec2(1.0, 1.0),
+	vec2(0.0, 1.0),
+	vec2(0.0, 0.0)
+);
+
+void main() {
+	vec2 corner = CORNERS[gl_VertexIndex];
+
+	//Rotate around the centre of the quad, Position is the bottom left corner when un-rotated.
+	vec2 halfSize = mQuadSize * 0.5;
+	vec2 local = (corner * mQuadSize) - halfSize;
+	float s = sin(mQuadRotation);
+	float c = cos(mQuadRotation);
+	vec2 rotated = vec2(local.x * c - local.y * s, local.x * s + local.y * c);
+
+	gl_Position = ubo.projView * vec4(mQuadPos.xy + halfSize + rotated, mQuadPos.z, 1.0);
+	vFragColour = mColour;
+	vTexCoord = mix(mTexCoords.xy, mTexCoords.zw, corner);
+	vTexIndex = mTexIndex;
+}
@@ -6,6 +6,7 @@ C:\VulkanSDK\1.3.296.0\Bin\glslc.exe SimpleUi.vert -o spv/SimpleUi.vert.spv
 C:\VulkanSDK\1.3.296.0\Bin\glslc.exe SimpleUi.frag -o spv/SimpleUi.frag.spv
 C:\VulkanSDK\1.3.296.0\Bin\glslc.exe QuadBatch.vert -o spv/QuadBatch.vert.spv
 C:\VulkanSDK\1.3.296.0\Bin\glslc.exe QuadBatch.frag -o spv/QuadBatch.frag.spv
+C:\VulkanSDK\1.3.296.0\Bin\glslc.exe QuadBatchInstanced.vert -o spv/QuadBatchInstanced.vert.spv
 C:\VulkanSDK\1.3.296.0\Bin\glslc.exe TextSoftMask3d.vert -o spv/TextSoftMask3d.vert.spv
 C:\VulkanSDK\1.3.296.0\Bin\glslc.exe TextSoftMask3d.frag -o spv/TextSoftMask3d.frag.spv
 C:\VulkanSDK\1.3.296.0\Bin\glslc.exe LineRenderer3d.vert -o spv/LineRenderer3d.vert.spv
@@ -37,7 +37,7 @@ namespace DOH {
 		initInfo.Instance = imGuiInit.VulkanInstance;
 		initInfo.PhysicalDevice = imGuiInit.PhysicalDevice;
 		initInfo.Device = imGuiInit.LogicDevice;
-		initInfo.PipelineCache = VK_NULL_HANDLE;
+		initInfo.PipelineCache = imGuiInit.PipelineCache;
 		initInfo.Allocator = nullptr;
 		initInfo.QueueFamily = imGuiInit.QueueFamily;
 		initInfo.Queue = imGuiInit.Queue;
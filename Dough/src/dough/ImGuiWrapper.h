@@ -22,6 +22,7 @@ namespace DOH {
 		uint32_t MinImageCount;
 		uint32_t ImageCount;
 		VkFormat ImageFormat;
+		VkPipelineCache PipelineCache = VK_NULL_HANDLE;
 	};
 
 	enum class EImGuiContainerType {
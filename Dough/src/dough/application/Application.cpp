@@ -87,6 +87,7 @@ namespace DOH {
 		);
 
 		Input::init();
+		ResourceHandler::init();
 
 		mRenderer = std::make_unique<RendererVulkan>();
 		mAppInfoTimer->recordInterval("Renderer.init() start");
@@ -148,6 +149,8 @@ namespace DOH {
 		mWindow->close();
 		mRenderer->close();
 
+		//After everything that could be waiting on an async load has closed
+		ResourceHandler::close();
 		Input::close();
 		mAppInfoTimer->recordInterval("Closing end");
 
@@ -42,6 +42,11 @@ namespace DOH {
 		uint32_t IndexBufferBinds = 0;
 		uint32_t DescriptorSetBinds = 0;
 
+		//Bytes of vertex data each renderer wrote into the upload ring this frame
+		size_t ShapeRendererUploadBytes = 0;
+		size_t TextRendererUploadBytes = 0;
+		size_t LineRendererUploadBytes = 0;
+
 		inline void updateTotalDrawCallCount() {
 			TotalDrawCalls = SceneDrawCalls + UiDrawCalls + QuadBatchRendererDrawCalls;
 		}
@@ -60,6 +65,12 @@ namespace DOH {
 			DescriptorSetBinds = 0;
 		}
 
+		inline void resetUploadBytes() {
+			ShapeRendererUploadBytes = 0;
+			TextRendererUploadBytes = 0;
+			LineRendererUploadBytes = 0;
+		}
+
 		inline void updatePerFrameData() {
 			updateTotalDrawCallCount();
 		}
@@ -67,6 +78,7 @@ namespace DOH {
 		inline void resetPerFrameData() {
 			resetDrawCallsCount();
 			resetBindingCount();
+			resetUploadBytes();
 		}
 	};
 
@@ -0,0 +1,82 @@
+#include "dough/files/AsyncAssetLoader.h"
+
+#include "dough/Logging.h"
+
+#include <tracy/public/tracy/Tracy.hpp>
+
+namespace DOH {
+
+	AsyncAssetLoader::AsyncAssetLoader()
+	:	mStopping(false)
+	{}
+
+	AsyncAssetLoader::~AsyncAssetLoader() {
+		stop();
+	}
+
+	void AsyncAssetLoader::start(uint32_t threadCount) {
+		ZoneScoped;
+
+		if (isRunning()) {
+			LOG_WARN("AsyncAssetLoader already started");
+			return;
+		}
+
+		if (threadCount == 0) {
+			const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+			threadCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+		}
+
+		mStopping = false;
+		mWorkers.reserve(threadCount);
+		for (uint32_t i = 0; i < threadCount; i++) {
+			mWorkers.emplace_back(&AsyncAssetLoader::workerLoop, this);
+		}
+	}
+
+	void AsyncAssetLoader::stop() {
+		ZoneScoped;
+
+		if (!isRunning()) {
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mQueueMutex);
+			mStopping = true;
+		}
+		mQueueCondition.notify_all();
+
+		for (std::thread& worker : mWorkers) {
+			worker.join();
+		}
+		mWorkers.clear();
+	}
+
+	size_t AsyncAssetLoader::getQueuedCount() {
+		std::lock_guard<std::mutex> lock(mQueueMutex);
+		return mQueue.size();
+	}
+
+	void AsyncAssetLoader::workerLoop() {
+#if defined (TRACY_ENABLE)
+		tracy::SetThreadName("AsyncAssetLoader");
+#endif
+
+		while (true) {
+			std::function<void()> load;
+			{
+				std::unique_lock<std::mutex> lock(mQueueMutex);
+				mQueueCondition.wait(lock, [this]() { return mStopping || !mQueue.empty(); });
+				//When stopping the queue is emptied first
+				if (mQueue.empty()) {
+					return;
+				}
+				load = std::move(mQueue.front());
+				mQueue.pop_front();
+			}
+
+			load();
+		}
+	}
+}
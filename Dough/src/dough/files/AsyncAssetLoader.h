@@ -0,0 +1,77 @@
+#pragma once
+
+#include "dough/Core.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+namespace DOH {
+
+	/**
+	* Pool of worker threads that run asset loads (file reading and decoding) off of the main thread.
+	* Each submitted load returns a std::future of its result, poll it with wait_for(0) and do anything that touches the GPU
+	* on the main thread once it's ready, e.g. TextRenderer uploading font pages in beginFrame.
+	*
+	* Loads are run in the order they're submitted, though with more than one worker they can finish in any order.
+	* An exception thrown by a load is stored in its future and thrown again by get().
+	*
+	* Use ResourceHandler's load...Async functions rather than owning one of these, they share the pool started by ResourceHandler::init.
+	*/
+	class AsyncAssetLoader {
+	private:
+		std::vector<std::thread> mWorkers;
+		std::deque<std::function<void()>> mQueue;
+		std::mutex mQueueMutex;
+		std::condition_variable mQueueCondition;
+		bool mStopping;
+
+	public:
+		AsyncAssetLoader();
+		AsyncAssetLoader(const AsyncAssetLoader& copy) = delete;
+		AsyncAssetLoader operator=(const AsyncAssetLoader& assignment) = delete;
+		~AsyncAssetLoader();
+
+		//Does nothing if already running. A threadCount of 0 uses one less than the number of hardware threads so the main thread keeps a core.
+		void start(uint32_t threadCount = 0);
+		//Queued loads are finished before returning so no future is left without a result.
+		void stop();
+
+		/**
+		* Queue load to be run on a worker thread.
+		* If the pool isn't running load is run straight away on the calling thread and the returned future is already ready.
+		*/
+		template<typename TLoad>
+		std::future<std::invoke_result_t<TLoad>> submit(TLoad&& load) {
+			using TResult = std::invoke_result_t<TLoad>;
+
+			//std::function must be copyable and packaged_task isn't, so it's shared instead
+			std::shared_ptr<std::packaged_task<TResult()>> task = std::make_shared<std::packaged_task<TResult()>>(std::forward<TLoad>(load));
+			std::future<TResult> result = task->get_future();
+
+			{
+				std::unique_lock<std::mutex> lock(mQueueMutex);
+				if (!mWorkers.empty() && !mStopping) {
+					mQueue.emplace_back([task]() { (*task)(); });
+					lock.unlock();
+					mQueueCondition.notify_one();
+					return result;
+				}
+			}
+
+			(*task)();
+			return result;
+		}
+
+		inline bool isRunning() const { return !mWorkers.empty(); }
+		inline uint32_t getThreadCount() const { return static_cast<uint32_t>(mWorkers.size()); }
+		size_t getQueuedCount();
+
+	private:
+		void workerLoop();
+	};
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "dough/Core.h"
+
+namespace DOH {
+
+	/**
+	* Layout of a cooked mesh file: the final interleaved vertices and indices of an obj model for one EVertexType, so it can
+	* be loaded without parsing the obj again. Written by ResourceHandler when an obj model is first loaded and read back
+	* through a FileView, the vertex and index data are copied straight from the mapped file into staging buffers.
+	*
+	* [CookedMeshHeader][VertexFloatCount floats][IndexCount uint32_t's], in the byte order of the machine that cooked it.
+	*
+	* Files are named by SourceHash and vertex type, so a changed obj is cooked again instead of reading stale data.
+	* Bump VERSION when the layout or how vertices are extracted from an obj changes.
+	*/
+	struct CookedMeshHeader {
+		constexpr static uint32_t MAGIC = 0x48534D44; //"DMSH"
+		constexpr static uint32_t VERSION = 1;
+
+		uint32_t Magic;
+		uint32_t Version;
+		//FNV-1a of the whole source obj file
+		uint64_t SourceHash;
+		uint32_t VertexType;
+		uint32_t FloatsPerVertex;
+		uint64_t VertexFloatCount;
+		uint64_t IndexCount;
+
+		inline size_t getVertexDataOffset() const { return sizeof(CookedMeshHeader); }
+		inline size_t getIndexDataOffset() const { return getVertexDataOffset() + static_cast<size_t>(VertexFloatCount) * sizeof(float); }
+		inline size_t getFileSize() const { return getIndexDataOffset() + static_cast<size_t>(IndexCount) * sizeof(uint32_t); }
+	};
+	static_assert(sizeof(CookedMeshHeader) % sizeof(float) == 0, "Vertex data following the header must stay aligned");
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "dough/Core.h"
+
+namespace DOH {
+
+	/**
+	* Layout of a cooked texture file: the decoded texels of an image with its full mip chain, so it can be loaded without
+	* decoding the image again or generating mips at runtime. Written by ResourceHandler when a texture is first loaded and
+	* read back through a FileView, the whole mip chain is copied straight from the mapped file into one staging buffer.
+	*
+	* [CookedTextureHeader][MipLevels levels, largest first, each max(Width >> level, 1) by max(Height >> level, 1) texels]
+	* Texels are always 4 channel, 8 bits per channel sRGB (VK_FORMAT_R8G8B8A8_SRGB), Channels is the source image's channel count.
+	*
+	* Files are named by SourceHash, so a changed image is cooked again instead of reading stale data.
+	* Bump VERSION when the layout or how mips are generated changes.
+	*/
+	struct CookedTextureHeader {
+		constexpr static uint32_t MAGIC = 0x58455444; //"DTEX"
+		constexpr static uint32_t VERSION = 1;
+		constexpr static uint32_t TEXEL_SIZE = 4;
+
+		uint32_t Magic;
+		uint32_t Version;
+		//FNV-1a of the whole source image file
+		uint64_t SourceHash;
+		uint32_t Width;
+		uint32_t Height;
+		uint32_t Channels;
+		uint32_t MipLevels;
+		uint64_t DataSize;
+
+		inline size_t getDataOffset() const { return sizeof(CookedTextureHeader); }
+		inline size_t getFileSize() const { return getDataOffset() + static_cast<size_t>(DataSize); }
+	};
+	static_assert(sizeof(CookedTextureHeader) % CookedTextureHeader::TEXEL_SIZE == 0, "Texel data following the header must stay aligned");
+}
@@ -0,0 +1,136 @@
+#include "dough/files/FileView.h"
+
+#include "dough/Logging.h"
+
+#include <tracy/public/tracy/Tracy.hpp>
+
+#include <fstream>
+
+#if defined (_WIN32)
+	#define WIN32_LEAN_AND_MEAN
+	#include <windows.h>
+#elif defined (__unix__) || defined (__APPLE__)
+	#define DOH_FILE_VIEW_POSIX
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace DOH {
+
+	FileView::FileView()
+	:	mData(nullptr),
+		mSize(0),
+		mMapped(false)
+	{}
+
+	FileView::~FileView() {
+		if (mMapped) {
+#if defined (_WIN32)
+			UnmapViewOfFile(mData);
+#elif defined (DOH_FILE_VIEW_POSIX)
+			munmap(const_cast<char*>(mData), mSize);
+#endif
+		}
+	}
+
+	std::shared_ptr<FileView> FileView::create(const char* filePath) {
+		ZoneScoped;
+
+		std::shared_ptr<FileView> view = std::shared_ptr<FileView>(new FileView());
+		if (!view->map(filePath) && !view->readIntoBuffer(filePath)) {
+			return nullptr;
+		}
+
+		return view;
+	}
+
+	bool FileView::map(const char* filePath) {
+#if defined (_WIN32)
+		HANDLE file = CreateFileA(
+			filePath,
+			GENERIC_READ,
+			FILE_SHARE_READ,
+			nullptr,
+			OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+			nullptr
+		);
+		if (file == INVALID_HANDLE_VALUE) {
+			return false;
+		}
+
+		LARGE_INTEGER fileSize = {};
+		//Empty files can't be mapped
+		if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+			CloseHandle(file);
+			return false;
+		}
+
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		//The view keeps the mapping and file open, so the handles can be closed straight away
+		CloseHandle(file);
+		if (mapping == nullptr) {
+			return false;
+		}
+
+		const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(mapping);
+		if (data == nullptr) {
+			return false;
+		}
+
+		mData = static_cast<const char*>(data);
+		mSize = static_cast<size_t>(fileSize.QuadPart);
+		mMapped = true;
+		return true;
+
+#elif defined (DOH_FILE_VIEW_POSIX)
+		const int file = ::open(filePath, O_RDONLY);
+		if (file == -1) {
+			return false;
+		}
+
+		struct stat fileStat = {};
+		//Empty files can't be mapped
+		if (fstat(file, &fileStat) != 0 || fileStat.st_size <= 0) {
+			::close(file);
+			return false;
+		}
+
+		void* data = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+		//The mapping keeps the file open, so it can be closed straight away
+		::close(file);
+		if (data == MAP_FAILED) {
+			return false;
+		}
+		madvise(data, static_cast<size_t>(fileStat.st_size), MADV_SEQUENTIAL);
+
+		mData = static_cast<const char*>(data);
+		mSize = static_cast<size_t>(fileStat.st_size);
+		mMapped = true;
+		return true;
+
+#else
+		return false;
+#endif
+	}
+
+	bool FileView::readIntoBuffer(const char* filePath) {
+		std::ifstream file(filePath, std::ios::ate | std::ios::binary);
+		if (!file.is_open()) {
+			return false;
+		}
+
+		const size_t fileSize = static_cast<size_t>(file.tellg());
+		mBuffer.resize(fileSize);
+		file.seekg(0);
+		file.read(mBuffer.data(), static_cast<std::streamsize>(fileSize));
+
+		mData = mBuffer.data();
+		mSize = fileSize;
+		mMapped = false;
+		return true;
+	}
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "dough/Core.h"
+
+#include <string_view>
+
+namespace DOH {
+
+	/**
+	* Read only view of a whole file. Memory mapped where possible so opening doesn't copy the file, pages are read from the
+	* OS's file cache as they're first touched and are shared with any other view of the same file.
+	* If the file can't be mapped (or is empty) it's read into a buffer instead, the view works the same either way.
+	*
+	* Use ResourceHandler::openFileView rather than create so repeated opens of the same file share one view.
+	* NOTE:: On Windows a mapped file can't be written to or deleted until every view of it has been released.
+	*/
+	class FileView {
+	private:
+		const char* mData;
+		size_t mSize;
+		bool mMapped;
+		//Used when the file isn't mapped
+		std::vector<char> mBuffer;
+
+		FileView();
+
+	public:
+		FileView(const FileView& copy) = delete;
+		FileView operator=(const FileView& assignment) = delete;
+		~FileView();
+
+		//Returns nullptr if the file can't be opened
+		static std::shared_ptr<FileView> create(const char* filePath);
+
+		inline const char* data() const { return mData; }
+		inline size_t size() const { return mSize; }
+		inline bool empty() const { return mSize == 0; }
+		inline std::string_view getView() const { return { mData, mSize }; }
+		inline bool isMapped() const { return mMapped; }
+
+	private:
+		bool map(const char* filePath);
+		bool readIntoBuffer(const char* filePath);
+	};
+}
@@ -0,0 +1,670 @@
+#include "dough/files/JsonDocument.h"
+
+#include <tracy/public/tracy/Tracy.hpp>
+
+#include <charconv>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define DOH_JSON_SSE2 1
+	#include <emmintrin.h>
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#endif
+#else
+	#define DOH_JSON_SSE2 0
+#endif
+
+namespace DOH {
+
+#if DOH_JSON_SSE2
+	static inline uint32_t countTrailingZeros(const uint32_t value) {
+	#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward(&index, value);
+		return static_cast<uint32_t>(index);
+	#else
+		return static_cast<uint32_t>(__builtin_ctz(value));
+	#endif
+	}
+#endif
+
+	static inline bool isJsonWhitespace(const char c) {
+		return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+	}
+
+	//Recursive descent over the source buffer, appending to the document's tape in the same pass.
+	class JsonParser {
+	private:
+		constexpr static uint32_t UTF8_REPLACEMENT_CHARACTER = 0xFFFD;
+
+		JsonDocument& mDocument;
+		char* mCurrent;
+		char* mEnd;
+		const char* mDebugName;
+		uint32_t mDepth;
+
+	public:
+		JsonParser(JsonDocument& document, const char* debugName)
+		:	mDocument(document),
+			mCurrent(document.mSource.data()),
+			mEnd(document.mSource.data() + document.mSource.size()),
+			mDebugName(debugName),
+			mDepth(0)
+		{}
+
+		bool parse() {
+			//UTF-8 BOM
+			if (mEnd - mCurrent >= 3 && memcmp(mCurrent, "\xEF\xBB\xBF", 3) == 0) {
+				mCurrent += 3;
+			}
+
+			skipWhitespace();
+			if (mCurrent == mEnd) {
+				return error("Empty JSON");
+			} else if (!parseValue(JsonDocument::NO_KEY)) {
+				return false;
+			}
+
+			skipWhitespace();
+			if (mCurrent != mEnd && *mCurrent != '\0') {
+				return error("Unexpected content after root value");
+			}
+
+			return true;
+		}
+
+	private:
+		bool error(const char* message) const {
+			const char* begin = mDocument.mSource.data();
+			const char* position = std::min<const char*>(mCurrent, mEnd);
+			//Only counted on error so the hot paths don't have to watch for new lines
+			uint32_t lineNumber = 1;
+			const char* lineStart = begin;
+			for (const char* c = begin; c < position; c++) {
+				if (*c == '\n') {
+					lineNumber++;
+					lineStart = c + 1;
+				}
+			}
+
+			const size_t column = static_cast<size_t>(position - lineStart) + 1;
+			LOG_ERR("Malformed JSON: " << message << " at line " << lineNumber << " char " << column << " in " << mDebugName);
+			return false;
+		}
+
+		inline void skipWhitespace() {
+			//Most values are separated by at most a single space, only bulk scan longer runs (indentation)
+			if (mCurrent == mEnd || !isJsonWhitespace(*mCurrent)) {
+				return;
+			}
+
+#if DOH_JSON_SSE2
+			const __m128i space = _mm_set1_epi8(' ');
+			const __m128i newLine = _mm_set1_epi8('\n');
+			const __m128i carriageReturn = _mm_set1_epi8('\r');
+			const __m128i tab = _mm_set1_epi8('\t');
+			while (mEnd - mCurrent >= 16) {
+				const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mCurrent));
+				const __m128i whitespace = _mm_or_si128(
+					_mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, newLine)),
+					_mm_or_si128(_mm_cmpeq_epi8(chunk, carriageReturn), _mm_cmpeq_epi8(chunk, tab))
+				);
+				const uint32_t notWhitespace = ~static_cast<uint32_t>(_mm_movemask_epi8(whitespace)) & 0xFFFFu;
+				if (notWhitespace != 0) {
+					mCurrent += countTrailingZeros(notWhitespace);
+					return;
+				}
+				mCurrent += 16;
+			}
+#endif
+
+			while (mCurrent < mEnd && isJsonWhitespace(*mCurrent)) {
+				mCurrent++;
+			}
+		}
+
+		//Move to the next '"' or '\\' (or the end) from the current position.
+		inline void scanToStringSpecial() {
+#if DOH_JSON_SSE2
+			const __m128i quote = _mm_set1_epi8('"');
+			const __m128i backslash = _mm_set1_epi8('\\');
+			while (mEnd - mCurrent >= 16) {
+				const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mCurrent));
+				const uint32_t special = static_cast<uint32_t>(_mm_movemask_epi8(
+					_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash))
+				));
+				if (special != 0) {
+					mCurrent += countTrailingZeros(special);
+					return;
+				}
+				mCurrent += 16;
+			}
+#endif
+
+			while (mCurrent < mEnd && *mCurrent != '"' && *mCurrent != '\\') {
+				mCurrent++;
+			}
+		}
+
+		inline uint32_t addNode(const EJsonElementType type, const uint32_t keyId) {
+			const uint32_t index = static_cast<uint32_t>(mDocument.mTape.size());
+			JsonTapeNode& node = mDocument.mTape.emplace_back();
+			node.Type = type;
+			node.KeyId = keyId;
+			node.End = index + 1;
+			node.Count = 0;
+			node.Value.Long = 0;
+			return index;
+		}
+
+		bool parseValue(const uint32_t keyId) {
+			switch (*mCurrent) {
+				case '{':
+					return parseObject(keyId);
+				case '[':
+					return parseArray(keyId);
+				case '"': {
+					std::string_view string;
+					if (!parseString(string)) {
+						return false;
+					}
+					JsonTapeNode& node = mDocument.mTape[addNode(EJsonElementType::DATA_STRING, keyId)];
+					node.Count = static_cast<uint32_t>(string.size());
+					node.Value.StringOffset = static_cast<uint32_t>(string.data() - mDocument.mSource.data());
+					return true;
+				}
+				case 't':
+					if (mEnd - mCurrent >= 4 && memcmp(mCurrent, "true", 4) == 0) {
+						mDocument.mTape[addNode(EJsonElementType::DATA_BOOL, keyId)].Value.Bool = true;
+						mCurrent += 4;
+						return true;
+					}
+					return error("Expected true");
+				case 'f':
+					if (mEnd - mCurrent >= 5 && memcmp(mCurrent, "false", 5) == 0) {
+						mDocument.mTape[addNode(EJsonElementType::DATA_BOOL, keyId)].Value.Bool = false;
+						mCurrent += 5;
+						return true;
+					}
+					return error("Expected false");
+				case 'n':
+					if (mEnd - mCurrent >= 4 && memcmp(mCurrent, "null", 4) == 0) {
+						addNode(EJsonElementType::NONE, keyId);
+						mCurrent += 4;
+						return true;
+					}
+					return error("Expected null");
+				case '-': case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9':
+					return parseNumber(keyId);
+				default:
+					return error("Unexpected character");
+			}
+		}
+
+		bool parseObject(const uint32_t keyId) {
+			if (++mDepth > JsonDocument::MAX_DEPTH) {
+				return error("Nested too deeply");
+			}
+
+			const uint32_t index = addNode(EJsonElementType::OBJECT, keyId);
+			uint32_t count = 0;
+			mCurrent++;
+			skipWhitespace();
+			if (mCurrent < mEnd && *mCurrent == '}') {
+				mCurrent++;
+			} else {
+				while (true) {
+					if (mCurrent == mEnd || *mCurrent != '"') {
+						return error("Expected member name");
+					}
+
+					std::string_view name;
+					if (!parseString(name)) {
+						return false;
+					}
+					const uint32_t memberKeyId = mDocument.internKey(name);
+
+					skipWhitespace();
+					if (mCurrent == mEnd || *mCurrent != ':') {
+						return error("Expected ':' after member name");
+					}
+					mCurrent++;
+					skipWhitespace();
+					if (mCurrent == mEnd) {
+						return error("Expected member value");
+					} else if (!parseValue(memberKeyId)) {
+						return false;
+					}
+					count++;
+
+					skipWhitespace();
+					if (mCurrent == mEnd) {
+						return error("Unterminated object");
+					} else if (*mCurrent == ',') {
+						mCurrent++;
+						skipWhitespace();
+					} else if (*mCurrent == '}') {
+						mCurrent++;
+						break;
+					} else {
+						return error("Expected ',' or '}'");
+					}
+				}
+			}
+
+			JsonTapeNode& node = mDocument.mTape[index];
+			node.Count = count;
+			node.End = static_cast<uint32_t>(mDocument.mTape.size());
+			mDepth--;
+			return true;
+		}
+
+		bool parseArray(const uint32_t keyId) {
+			if (++mDepth > JsonDocument::MAX_DEPTH) {
+				return error("Nested too deeply");
+			}
+
+			const uint32_t index = addNode(EJsonElementType::ARRAY, keyId);
+			uint32_t count = 0;
+			mCurrent++;
+			skipWhitespace();
+			if (mCurrent < mEnd && *mCurrent == ']') {
+				mCurrent++;
+			} else {
+				while (true) {
+					if (mCurrent == mEnd) {
+						return error("Unterminated array");
+					} else if (!parseValue(JsonDocument::NO_KEY)) {
+						return false;
+					}
+					count++;
+
+					skipWhitespace();
+					if (mCurrent == mEnd) {
+						return error("Unterminated array");
+					} else if (*mCurrent == ',') {
+						mCurrent++;
+						skipWhitespace();
+					} else if (*mCurrent == ']') {
+						mCurrent++;
+						break;
+					} else {
+						return error("Expected ',' or ']'");
+					}
+				}
+			}
+
+			JsonTapeNode& node = mDocument.mTape[index];
+			node.Count = count;
+			node.End = static_cast<uint32_t>(mDocument.mTape.size());
+			mDepth--;
+			return true;
+		}
+
+		//mCurrent is on the opening quote. Escapes are decoded in place, which never makes the string longer,
+		// and the closing quote is replaced with a null terminator.
+		bool parseString(std::string_view& outString) {
+			char* start = ++mCurrent;
+			scanToStringSpecial();
+
+			char* write = mCurrent;
+			while (mCurrent < mEnd && *mCurrent == '\\') {
+				if (mEnd - mCurrent < 2) {
+					return error("Unterminated string");
+				}
+
+				const char escaped = mCurrent[1];
+				mCurrent += 2;
+				switch (escaped) {
+					case '"': *write++ = '"'; break;
+					case '\\': *write++ = '\\'; break;
+					case '/': *write++ = '/'; break;
+					case 'b': *write++ = '\b'; break;
+					case 'f': *write++ = '\f'; break;
+					case 'n': *write++ = '\n'; break;
+					case 'r': *write++ = '\r'; break;
+					case 't': *write++ = '\t'; break;
+					case 'u': {
+						uint32_t codepoint;
+						if (!parseHex4(codepoint)) {
+							return false;
+						}
+						//Surrogate pair
+						if (codepoint >= 0xD800 && codepoint <= 0xDBFF && mEnd - mCurrent >= 6 && mCurrent[0] == '\\' && mCurrent[1] == 'u') {
+							char* nextEscape = mCurrent;
+							mCurrent += 2;
+							uint32_t low;
+							if (!parseHex4(low)) {
+								return false;
+							}
+							if (low >= 0xDC00 && low <= 0xDFFF) {
+								codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+							} else {
+								//Lone high surrogate, the next escape is decoded on its own
+								mCurrent = nextEscape;
+								codepoint = UTF8_REPLACEMENT_CHARACTER;
+							}
+						} else if (codepoint >= 0xD800 && codepoint <= 0xDFFF) {
+							codepoint = UTF8_REPLACEMENT_CHARACTER;
+						}
+						write = writeUtf8(write, codepoint);
+						break;
+					}
+					default:
+						return error("Invalid escape in string");
+				}
+
+				//Shift the run up to the next escape or the closing quote down over the removed escape chars
+				char* runStart = mCurrent;
+				scanToStringSpecial();
+				const size_t runLength = static_cast<size_t>(mCurrent - runStart);
+				memmove(write, runStart, runLength);
+				write += runLength;
+			}
+
+			if (mCurrent == mEnd) {
+				return error("Unterminated string");
+			}
+
+			*write = '\0';
+			mCurrent++;
+			outString = std::string_view(start, static_cast<size_t>(write - start));
+			return true;
+		}
+
+		bool parseHex4(uint32_t& outValue) {
+			if (mEnd - mCurrent < 4) {
+				return error("Truncated \\u escape");
+			}
+
+			outValue = 0;
+			for (int i = 0; i < 4; i++) {
+				const char c = mCurrent[i];
+				uint32_t digit;
+				if (c >= '0' && c <= '9') {
+					digit = c - '0';
+				} else if (c >= 'a' && c <= 'f') {
+					digit = c - 'a' + 10;
+				} else if (c >= 'A' && c <= 'F') {
+					digit = c - 'A' + 10;
+				} else {
+					return error("Invalid \\u escape");
+				}
+				outValue = (outValue << 4) | digit;
+			}
+
+			mCurrent += 4;
+			return true;
+		}
+
+		static char* writeUtf8(char* write, const uint32_t codepoint) {
+			if (codepoint < 0x80) {
+				*write++ = static_cast<char>(codepoint);
+			} else if (codepoint < 0x800) {
+				*write++ = static_cast<char>(0xC0 | (codepoint >> 6));
+				*write++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+			} else if (codepoint < 0x10000) {
+				*write++ = static_cast<char>(0xE0 | (codepoint >> 12));
+				*write++ = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+				*write++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+			} else {
+				*write++ = static_cast<char>(0xF0 | (codepoint >> 18));
+				*write++ = static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+				*write++ = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+				*write++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+			}
+			return write;
+		}
+
+		bool parseNumber(const uint32_t keyId) {
+			const char* start = mCurrent;
+			bool isInteger = true;
+			while (mCurrent < mEnd) {
+				const char c = *mCurrent;
+				if (c >= '0' && c <= '9') {
+					mCurrent++;
+				} else if (c == '.' || c == 'e' || c == 'E' || c == '+' || c == '-') {
+					//'-' is also the sign of the number, it doesn't make an integer a double
+					if (c != '-' || mCurrent != start) {
+						isInteger = false;
+					}
+					mCurrent++;
+				} else {
+					break;
+				}
+			}
+
+			if (isInteger) {
+				int64_t value;
+				const std::from_chars_result result = std::from_chars(start, mCurrent, value);
+				if (result.ec == std::errc() && result.ptr == mCurrent) {
+					mDocument.mTape[addNode(EJsonElementType::DATA_LONG, keyId)].Value.Long = value;
+					return true;
+				} else if (result.ec != std::errc::result_out_of_range) {
+					return error("Invalid number");
+				}
+				//Integers too large for int64_t are kept as doubles
+			}
+
+			double value;
+			const std::from_chars_result result = std::from_chars(start, mCurrent, value);
+			if (result.ec != std::errc() || result.ptr != mCurrent) {
+				return error("Invalid number");
+			}
+			mDocument.mTape[addNode(EJsonElementType::DATA_DOUBLE, keyId)].Value.Double = value;
+			return true;
+		}
+	};
+
+	std::shared_ptr<JsonDocument> JsonDocument::parse(std::vector<char>&& source, const char* debugName) {
+		ZoneScoped;
+
+		std::shared_ptr<JsonDocument> document = std::make_shared<JsonDocument>();
+		document->mSource = std::move(source);
+		//Rough guess at node count so the tape is rarely re-allocated for typical formatted JSON
+		document->mTape.reserve(document->mSource.size() / 16);
+
+		JsonParser parser(*document, debugName);
+		if (!parser.parse()) {
+			return nullptr;
+		}
+
+		return document;
+	}
+
+	uint32_t JsonDocument::internKey(const std::string_view key) {
+		const auto result = mKeyIds.emplace(key, static_cast<uint32_t>(mKeys.size()));
+		if (result.second) {
+			mKeys.emplace_back(key);
+		}
+		return result.first->second;
+	}
+
+	JsonElement JsonDocument::toElement(const JsonValue value) {
+		switch (value.getType()) {
+			case EJsonElementType::DATA_LONG:
+				return createElementLong(value.getLong());
+			case EJsonElementType::DATA_DOUBLE:
+				return createElementDouble(value.getDouble());
+			case EJsonElementType::DATA_BOOL:
+				return createElementBool(value.getBool());
+			case EJsonElementType::DATA_STRING:
+				return createElementString(std::string(value.getString()));
+			case EJsonElementType::OBJECT: {
+				JsonElement element = createElementObject();
+				std::unordered_map<std::string, JsonElement>& object = element.getObject();
+				object.reserve(value.size());
+				for (const JsonValue member : value.getChildren()) {
+					object.emplace(std::string(member.getKey()), JsonDocument::toElement(member));
+				}
+				return element;
+			}
+			case EJsonElementType::ARRAY: {
+				JsonElement element = createElementArray();
+				std::vector<JsonElement>& array = element.getArray();
+				array.reserve(value.size());
+				for (const JsonValue child : value.getChildren()) {
+					array.emplace_back(JsonDocument::toElement(child));
+				}
+				return element;
+			}
+			case EJsonElementType::NONE:
+			default:
+				return createElementNull();
+		}
+	}
+
+	JsonValue::ChildIterator& JsonValue::ChildIterator::operator++() {
+		mIndex = mDocument->mTape[mIndex].End;
+		return *this;
+	}
+
+	EJsonElementType JsonValue::getType() const {
+		return isValid() ? mDocument->mTape[mIndex].Type : EJsonElementType::NONE;
+	}
+
+	long JsonValue::getLong() const {
+		return static_cast<long>(getInt64());
+	}
+
+	int64_t JsonValue::getInt64() const {
+		if (isLong()) {
+			return mDocument->mTape[mIndex].Value.Long;
+		}
+
+		LOG_ERR("Attempted to get long value of non-long JsonValue: " << getKey());
+		return 0;
+	}
+
+	double JsonValue::getDouble() const {
+		if (isDouble()) {
+			return mDocument->mTape[mIndex].Value.Double;
+		}
+
+		LOG_ERR("Attempted to get double value of non-double JsonValue: " << getKey());
+		return 0.0;
+	}
+
+	double JsonValue::getNumberAsDouble() const {
+		if (isDouble()) {
+			return mDocument->mTape[mIndex].Value.Double;
+		} else if (isLong()) {
+			return static_cast<double>(mDocument->mTape[mIndex].Value.Long);
+		}
+
+		LOG_WARN("Attempted to get number when element is not a number.");
+		return -1;
+	}
+
+	bool JsonValue::getBool() const {
+		if (isBool()) {
+			return mDocument->mTape[mIndex].Value.Bool;
+		}
+
+		LOG_ERR("Attempted to get bool value of non-bool JsonValue: " << getKey());
+		return false;
+	}
+
+	std::string_view JsonValue::getString() const {
+		if (isString()) {
+			const JsonTapeNode& node = mDocument->mTape[mIndex];
+			return { mDocument->mSource.data() + node.Value.StringOffset, node.Count };
+		}
+
+		LOG_ERR("Attempted to get string value of non-string JsonValue: " << getKey());
+		return {};
+	}
+
+	const char* JsonValue::getCString() const {
+		if (isString()) {
+			return mDocument->mSource.data() + mDocument->mTape[mIndex].Value.StringOffset;
+		}
+
+		LOG_ERR("Attempted to get string value of non-string JsonValue: " << getKey());
+		return "";
+	}
+
+	std::string_view JsonValue::getKey() const {
+		if (isValid()) {
+			const uint32_t keyId = mDocument->mTape[mIndex].KeyId;
+			if (keyId != JsonDocument::NO_KEY) {
+				return mDocument->mKeys[keyId];
+			}
+		}
+		return {};
+	}
+
+	size_t JsonValue::size() const {
+		return isObject() || isArray() ? mDocument->mTape[mIndex].Count : 0;
+	}
+
+	JsonValue::ChildRange JsonValue::getChildren() const {
+		if (isObject() || isArray()) {
+			return { { mDocument, mIndex + 1 }, { mDocument, mDocument->mTape[mIndex].End } };
+		}
+		return { { mDocument, 0 }, { mDocument, 0 } };
+	}
+
+	uint32_t JsonValue::findMember(const char* elementName) const {
+		if (!isObject()) {
+			return JsonValue::INVALID_INDEX;
+		}
+
+		const auto keyItr = mDocument->mKeyIds.find(elementName);
+		if (keyItr == mDocument->mKeyIds.end()) {
+			return JsonValue::INVALID_INDEX;
+		}
+
+		const uint32_t keyId = keyItr->second;
+		const uint32_t end = mDocument->mTape[mIndex].End;
+		uint32_t child = mIndex + 1;
+		while (child < end) {
+			const JsonTapeNode& node = mDocument->mTape[child];
+			if (node.KeyId == keyId) {
+				return child;
+			}
+			child = node.End;
+		}
+
+		return JsonValue::INVALID_INDEX;
+	}
+
+	JsonValue JsonValue::operator[](const char* elementName) const {
+		const uint32_t member = findMember(elementName);
+		if (member == JsonValue::INVALID_INDEX) {
+			LOG_ERR("JsonValue has no member: " << elementName);
+			return {};
+		}
+		return { mDocument, member };
+	}
+
+	std::optional<JsonValue> JsonValue::getElement(const char* elementName) const {
+		const uint32_t member = findMember(elementName);
+		if (member == JsonValue::INVALID_INDEX) {
+			return {};
+		}
+		return JsonValue(mDocument, member);
+	}
+
+	bool JsonValue::hasElement(const char* elementName) const {
+		if (!isObject()) {
+			LOG_ERR("Attempted to find element: " << elementName << " on a non-object element.");
+			return false;
+		}
+		return findMember(elementName) != JsonValue::INVALID_INDEX;
+	}
+
+	JsonValue JsonValue::operator[](const size_t index) const {
+		if (isArray() && index < size()) {
+			uint32_t child = mIndex + 1;
+			for (size_t i = 0; i < index; i++) {
+				child = mDocument->mTape[child].End;
+			}
+			return { mDocument, child };
+		}
+
+		LOG_ERR("JsonValue array index out of range or not an array: " << index);
+		return {};
+	}
+}
@@ -0,0 +1,170 @@
+#pragma once
+
+#include "dough/files/JsonFileData.h"
+
+#include <string_view>
+
+namespace DOH {
+
+	class JsonDocument;
+
+	//A JSON value laid out in JsonDocument's tape, children directly follow their parent.
+	struct JsonTapeNode {
+		EJsonElementType Type;
+		//Interned key when this is an object member, JsonDocument::NO_KEY otherwise.
+		uint32_t KeyId;
+		//Index of the node after this one's subtree, its next sibling if it has one.
+		uint32_t End;
+		//Child count of OBJECT & ARRAY, byte length of DATA_STRING.
+		uint32_t Count;
+		union {
+			int64_t Long;
+			double Double;
+			bool Bool;
+			//Offset into JsonDocument's source buffer, the string is null terminated.
+			uint32_t StringOffset;
+		} Value;
+	};
+
+	/**
+	* Read only handle to a value in a JsonDocument, cheap to copy and only valid while the document is alive.
+	* Mirrors JsonElement's accessors so code reading JSON looks the same, strings are returned as views into the document.
+	* Missing members and type mismatches log an error and return a null value, 0, false or an empty string instead of throwing.
+	*/
+	class JsonValue {
+	public:
+		constexpr static uint32_t INVALID_INDEX = UINT32_MAX;
+
+	private:
+		const JsonDocument* mDocument;
+		uint32_t mIndex;
+
+	public:
+		//Iterates the children of an OBJECT or ARRAY in file order.
+		class ChildIterator {
+		private:
+			const JsonDocument* mDocument;
+			uint32_t mIndex;
+
+		public:
+			ChildIterator(const JsonDocument* document, const uint32_t index)
+			:	mDocument(document),
+				mIndex(index)
+			{}
+
+			inline JsonValue operator*() const { return { mDocument, mIndex }; }
+			ChildIterator& operator++();
+			inline bool operator!=(const ChildIterator& other) const { return mIndex != other.mIndex; }
+			inline bool operator==(const ChildIterator& other) const { return mIndex == other.mIndex; }
+		};
+
+		class ChildRange {
+		private:
+			ChildIterator mBegin;
+			ChildIterator mEnd;
+
+		public:
+			ChildRange(const ChildIterator begin, const ChildIterator end)
+			:	mBegin(begin),
+				mEnd(end)
+			{}
+
+			inline ChildIterator begin() const { return mBegin; }
+			inline ChildIterator end() const { return mEnd; }
+		};
+
+		JsonValue()
+		:	mDocument(nullptr),
+			mIndex(JsonValue::INVALID_INDEX)
+		{}
+		JsonValue(const JsonDocument* document, const uint32_t index)
+		:	mDocument(document),
+			mIndex(index)
+		{}
+
+		EJsonElementType getType() const;
+		inline bool isValid() const { return mIndex != JsonValue::INVALID_INDEX; }
+		inline bool isNull() const { return getType() == EJsonElementType::NONE; }
+		inline bool isLong() const { return getType() == EJsonElementType::DATA_LONG; }
+		inline bool isDouble() const { return getType() == EJsonElementType::DATA_DOUBLE; }
+		inline bool isBool() const { return getType() == EJsonElementType::DATA_BOOL; }
+		inline bool isString() const { return getType() == EJsonElementType::DATA_STRING; }
+		inline bool isObject() const { return getType() == EJsonElementType::OBJECT; }
+		inline bool isArray() const { return getType() == EJsonElementType::ARRAY; }
+
+		long getLong() const;
+		int64_t getInt64() const;
+		double getDouble() const;
+		double getNumberAsDouble() const;
+		inline float getNumberAsFloat() const { return static_cast<float>(getNumberAsDouble()); }
+		bool getBool() const;
+		std::string_view getString() const;
+		//Same as getString, the document keeps strings null terminated.
+		const char* getCString() const;
+		//Name of this value in its parent object, empty if it isn't an object member.
+		std::string_view getKey() const;
+
+		//Child count of an OBJECT or ARRAY, 0 otherwise.
+		size_t size() const;
+		//Children of an OBJECT (use getKey for their names) or ARRAY, empty otherwise.
+		ChildRange getChildren() const;
+		inline ChildRange getArray() const { return getChildren(); }
+		inline ChildRange getObject() const { return getChildren(); }
+
+		//Object member search, members are compared by interned key so a name not in the document fails without comparing strings.
+		JsonValue operator[](const char* elementName) const;
+		std::optional<JsonValue> getElement(const char* elementName) const;
+		bool hasElement(const char* elementName) const;
+		//Array index search, walks the array so prefer getArray() when visiting every element.
+		JsonValue operator[](const size_t index) const;
+
+	private:
+		uint32_t findMember(const char* elementName) const;
+	};
+
+	/**
+	* JSON parsed in a single pass into a flat "tape" of JsonTapeNodes, with interned object keys and strings left in the source buffer.
+	* Strings are unescaped in place and null terminated so no string is allocated, whitespace and strings are scanned 16 bytes
+	* at a time when SSE2 is available.
+	*
+	* Read only, for JSON that needs editing or writing use JsonFileData (JsonFileReader::read builds one from a JsonDocument).
+	*/
+	class JsonDocument {
+		friend class JsonValue;
+		friend class JsonParser;
+
+	public:
+		constexpr static uint32_t NO_KEY = UINT32_MAX;
+		constexpr static uint32_t MAX_DEPTH = 512;
+
+	private:
+		std::vector<char> mSource;
+		std::vector<JsonTapeNode> mTape;
+		std::vector<std::string_view> mKeys;
+		std::unordered_map<std::string_view, uint32_t> mKeyIds;
+
+	public:
+		JsonDocument() = default;
+		JsonDocument(const JsonDocument& copy) = delete;
+		JsonDocument operator=(const JsonDocument& assignment) = delete;
+
+		/**
+		* Parse source, which the document takes ownership of and modifies. Returns nullptr and logs where if source isn't valid JSON.
+		*
+		* @param debugName Name used when logging errors, e.g. the file path.
+		*/
+		static std::shared_ptr<JsonDocument> parse(std::vector<char>&& source, const char* debugName = "");
+
+		inline JsonValue getRoot() const { return { this, mTape.empty() ? JsonValue::INVALID_INDEX : 0u }; }
+		inline size_t getNodeCount() const { return mTape.size(); }
+		inline size_t getKeyCount() const { return mKeys.size(); }
+		inline size_t getSourceByteSize() const { return mSource.size(); }
+
+		//Convert value and its children to a JsonElement tree, e.g. for editing or JsonFileWriter.
+		static JsonElement toElement(const JsonValue value);
+
+	private:
+		//Id of key, adding it if this is the first time it's been seen.
+		uint32_t internKey(const std::string_view key);
+	};
+}
@@ -5,6 +5,7 @@
 #include "dough/Logging.h"
 
 #include <variant>
+#include <climits>
 
 namespace DOH {
 
@@ -1,11 +1,15 @@
 #include "dough/files/ResourceHandler.h"
 
 #include "dough/Utils.h"
+#include "dough/files/FileView.h"
+#include "dough/files/CookedMeshFileData.h"
+#include "dough/files/CookedTextureFileData.h"
 #include "dough/Logging.h"
 #include "dough/files/readers/FntFileReader.h"
 #include "dough/files/readers/JsonFileReader.h"
 #include "dough/files/readers/IndexedAtlasInfoFileReader.h"
 #include "dough/files/writers/JsonFileWriter.h"
+#include "dough/files/writers/JsonStreamWriter.h"
 #include "dough/application/ApplicationInitSettings.h"
 
 #include <stb/stb_image.h>
@@ -15,7 +19,11 @@
 
 #include <tracy/public/tracy/Tracy.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <filesystem>
+#include <iomanip>
+#include <sstream>
 
 //Hash function based off of example from https://vulkan-tutorial.com/Loading_models
 namespace std {
@@ -76,16 +84,54 @@ namespace DOH {
 
 	ResourceHandler ResourceHandler::INSTANCE = ResourceHandler();
 
-	TextureCreationData ResourceHandler::loadTexture(const char* filePath) {
-		return ResourceHandler::INSTANCE.loadTextureImpl(filePath);
+	void ResourceHandler::init() {
+		ResourceHandler::INSTANCE.mAsyncLoader.start();
+	}
+
+	void ResourceHandler::close() {
+		ResourceHandler::INSTANCE.mAsyncLoader.stop();
+	}
+
+	std::future<TextureCreationData> ResourceHandler::loadTextureAsync(const std::string& filePath, const TextureMipSettings& mipSettings) {
+		return ResourceHandler::INSTANCE.mAsyncLoader.submit(
+			[filePath, mipSettings]() { return ResourceHandler::INSTANCE.loadTextureImpl(filePath.c_str(), true, mipSettings); }
+		);
+	}
+
+	std::future<std::shared_ptr<Model3dCreationData>> ResourceHandler::loadObjModelAsync(
+		const std::string& filePath,
+		const AVertexInputLayout& vertexInputLayout
+	) {
+		//Like the Model3dCreationData returned, vertexInputLayout must outlive the load. Usually it's a StaticVertexInputLayout which always does
+		return ResourceHandler::INSTANCE.mAsyncLoader.submit(
+			[filePath, &vertexInputLayout]() { return ResourceHandler::INSTANCE.loadObjModelImpl(filePath, vertexInputLayout, true); }
+		);
+	}
+
+	std::future<std::shared_ptr<JsonDocument>> ResourceHandler::loadJsonDocumentAsync(const std::string& filePath) {
+		return ResourceHandler::INSTANCE.mAsyncLoader.submit(
+			[filePath]() { return ResourceHandler::INSTANCE.loadJsonDocumentImpl(filePath.c_str()); }
+		);
+	}
+
+	TextureCreationData ResourceHandler::loadTexture(
+		const char* filePath,
+		const bool useCookedTexture,
+		const TextureMipSettings& mipSettings
+	) {
+		return ResourceHandler::INSTANCE.loadTextureImpl(filePath, useCookedTexture, mipSettings);
 	}
 
 	std::shared_ptr<IndexedAtlasInfoFileData> ResourceHandler::loadIndexedTextureAtlas(const char* atlasInfoFilePath) {
 		return INSTANCE.loadIndexedTextureAtlasImpl(atlasInfoFilePath);
 	}
 
-	std::shared_ptr<Model3dCreationData> ResourceHandler::loadObjModel(const std::string& filePath, const AVertexInputLayout& vertexInputLayout) {
-		return ResourceHandler::INSTANCE.loadObjModelImpl(filePath, vertexInputLayout);
+	std::shared_ptr<Model3dCreationData> ResourceHandler::loadObjModel(
+		const std::string& filePath,
+		const AVertexInputLayout& vertexInputLayout,
+		const bool useCookedMesh
+	) {
+		return ResourceHandler::INSTANCE.loadObjModelImpl(filePath, vertexInputLayout, useCookedMesh);
 	}
 
 	std::shared_ptr<FntFileData> ResourceHandler::loadFntFile(const char* filePath) {
@@ -96,12 +142,59 @@ namespace DOH {
 		return ResourceHandler::INSTANCE.loadJsonFileImpl(filePath);
 	}
 
+	std::shared_ptr<JsonDocument> ResourceHandler::loadJsonDocument(const char* filePath) {
+		return ResourceHandler::INSTANCE.loadJsonDocumentImpl(filePath);
+	}
+
 	bool ResourceHandler::writeJsonFile(const char* filePath, std::shared_ptr<JsonFileData> fileData) {
 		return ResourceHandler::INSTANCE.writeJsonFileImpl(filePath, fileData);
 	}
 
-	void ResourceHandler::freeImage(void* imageData) {
-		ResourceHandler::INSTANCE.freeImageImpl(imageData);
+	std::shared_ptr<const FileView> ResourceHandler::openFileView(const char* filePath) {
+		return ResourceHandler::INSTANCE.openFileViewImpl(filePath);
+	}
+
+	void ResourceHandler::freeTexture(TextureCreationData& textureData) {
+		ResourceHandler::INSTANCE.freeTextureImpl(textureData);
+	}
+
+	uint32_t ResourceHandler::getMipLevelCount(const uint32_t width, const uint32_t height) {
+		uint32_t mipLevels = 1;
+		for (uint32_t size = std::max(width, height); size > 1; size >>= 1) {
+			mipLevels++;
+		}
+		return mipLevels;
+	}
+
+	uint32_t ResourceHandler::getMipLevelCount(const uint32_t width, const uint32_t height, const TextureMipSettings& mipSettings) {
+		uint32_t mipLevels = ResourceHandler::getMipLevelCount(width, height);
+		if (mipSettings.MaxLevels > 0) {
+			mipLevels = std::min(mipLevels, mipSettings.MaxLevels);
+		}
+
+		//Tiles must halve evenly every level, otherwise filtering reads across tile edges
+		if (mipSettings.TileColumns > 1 || mipSettings.TileRows > 1) {
+			const uint32_t columns = std::max(mipSettings.TileColumns, 1u);
+			const uint32_t rows = std::max(mipSettings.TileRows, 1u);
+			if (width % columns != 0 || height % rows != 0) {
+				return 1;
+			}
+
+			uint32_t tileWidth = width / columns;
+			uint32_t tileHeight = height / rows;
+			uint32_t tileLevels = 1;
+			while (
+				tileWidth % 2 == 0 && tileHeight % 2 == 0 &&
+				tileWidth / 2 >= TextureMipSettings::MIN_TILE_SIZE && tileHeight / 2 >= TextureMipSettings::MIN_TILE_SIZE
+			) {
+				tileWidth /= 2;
+				tileHeight /= 2;
+				tileLevels++;
+			}
+			mipLevels = std::min(mipLevels, tileLevels);
+		}
+
+		return mipLevels;
 	}
 
 	uint32_t ResourceHandler::getNextUniqueTextureId() {
@@ -126,17 +219,48 @@ namespace DOH {
 		return buffer;
 	}
 
-	TextureCreationData ResourceHandler::loadTextureImpl(const char* filePath) {
+	TextureCreationData ResourceHandler::loadTextureImpl(
+		const char* filePath,
+		const bool useCookedTexture,
+		const TextureMipSettings& mipSettings
+	) {
 		ZoneScoped;
 
+		TextureCreationData textureData = {};
+		textureData.Failed = true;
+
+		std::shared_ptr<const FileView> sourceView = openFileViewImpl(filePath);
+		if (sourceView == nullptr) {
+			LOG_ERR("Failed to load image data: " << filePath);
+			return textureData;
+		}
+
+		uint64_t sourceHash = 0;
+		std::string cookedFilePath;
+		if (useCookedTexture) {
+			sourceHash = ResourceHandler::hashFileData(sourceView->getView());
+			cookedFilePath = ResourceHandler::getCookedTextureFilePath(sourceHash, mipSettings);
+
+			TextureCreationData cookedData = loadCookedTextureImpl(cookedFilePath, sourceHash, mipSettings);
+			if (!cookedData.Failed) {
+				return cookedData;
+			}
+		}
+
 		int width = -1;
 		int height = -1;
 		int channels = -1;
-		stbi_uc* pixels = stbi_load(filePath, &width, &height, &channels, STBI_rgb_alpha);
+		stbi_uc* pixels = stbi_load_from_memory(
+			reinterpret_cast<const stbi_uc*>(sourceView->data()),
+			static_cast<int>(sourceView->size()),
+			&width,
+			&height,
+			&channels,
+			STBI_rgb_alpha
+		);
 
 		bool failed = pixels == nullptr || width < 0 || height < 0 || channels < 0;
 
-		TextureCreationData textureData = {};
 		textureData.Width = static_cast<uint32_t>(width);
 		textureData.Height = static_cast<uint32_t>(height);
 		textureData.Channels = static_cast<uint32_t>(channels);
@@ -145,15 +269,104 @@ namespace DOH {
 
 		if (failed) {
 			LOG_ERR("Failed to load image data: " << filePath);
+			return textureData;
+		}
+
+		if (useCookedTexture) {
+			CookedTextureHeader header = {};
+			header.Magic = CookedTextureHeader::MAGIC;
+			header.Version = CookedTextureHeader::VERSION;
+			header.SourceHash = sourceHash;
+			header.Width = textureData.Width;
+			header.Height = textureData.Height;
+			header.Channels = textureData.Channels;
+			header.MipLevels = ResourceHandler::getMipLevelCount(textureData.Width, textureData.Height, mipSettings);
+
+			const std::vector<uint8_t> mipChain = ResourceHandler::generateMipChain(pixels, header.Width, header.Height, header.MipLevels);
+			header.DataSize = mipChain.size();
+
+			//Read back from the cooked file so the mip chain is uploaded the same way as every later load.
+			//If it can't be written the texture is used without mips.
+			if (ResourceHandler::writeCookedFile(
+				cookedFilePath,
+				{
+					{ reinterpret_cast<const char*>(&header), sizeof(CookedTextureHeader) },
+					{ reinterpret_cast<const char*>(mipChain.data()), mipChain.size() }
+				}
+			)) {
+				TextureCreationData cookedData = loadCookedTextureImpl(cookedFilePath, sourceHash, mipSettings);
+				if (!cookedData.Failed) {
+					stbi_image_free(pixels);
+					return cookedData;
+				}
+			} else {
+				LOG_WARN("Failed to write cooked texture, loading without mips: " << filePath);
+			}
 		}
 
 		return textureData;
 	}
 
-	void ResourceHandler::freeImageImpl(void* imageData) {
+	TextureCreationData ResourceHandler::loadCookedTextureImpl(
+		const std::string& cookedFilePath,
+		const uint64_t sourceHash,
+		const TextureMipSettings& mipSettings
+	) {
 		ZoneScoped;
 
-		stbi_image_free(imageData);
+		TextureCreationData textureData = {};
+		textureData.Failed = true;
+
+		std::error_code error;
+		if (!std::filesystem::exists(cookedFilePath, error)) {
+			return textureData;
+		}
+
+		std::shared_ptr<const FileView> view = openFileViewImpl(cookedFilePath.c_str());
+		if (view == nullptr) {
+			return textureData;
+		}
+
+		CookedTextureHeader header = {};
+		if (view->size() < sizeof(CookedTextureHeader)) {
+			LOG_WARN("Cooked texture too small, it will be cooked again: " << cookedFilePath);
+			return textureData;
+		}
+		memcpy(&header, view->data(), sizeof(CookedTextureHeader));
+
+		textureData.Width = header.Width;
+		textureData.Height = header.Height;
+		textureData.Channels = header.Channels;
+		textureData.MipLevels = header.MipLevels;
+		textureData.MipSettings = mipSettings;
+		if (
+			header.Magic != CookedTextureHeader::MAGIC ||
+			header.Version != CookedTextureHeader::VERSION ||
+			header.SourceHash != sourceHash ||
+			header.MipLevels == 0 ||
+			header.MipLevels != ResourceHandler::getMipLevelCount(header.Width, header.Height, mipSettings) ||
+			header.DataSize != textureData.getByteSize() ||
+			header.getFileSize() != view->size()
+		) {
+			LOG_WARN("Cooked texture doesn't match, it will be cooked again: " << cookedFilePath);
+			return textureData;
+		}
+
+		textureData.Data = const_cast<char*>(view->data() + header.getDataOffset());
+		textureData.CookedTextureView = view;
+		textureData.Failed = false;
+		return textureData;
+	}
+
+	void ResourceHandler::freeTextureImpl(TextureCreationData& textureData) {
+		ZoneScoped;
+
+		if (textureData.CookedTextureView != nullptr) {
+			textureData.CookedTextureView.reset();
+		} else {
+			stbi_image_free(textureData.Data);
+		}
+		textureData.Data = nullptr;
 	}
 
 	std::shared_ptr<IndexedAtlasInfoFileData> ResourceHandler::loadIndexedTextureAtlasImpl(const char* atlasInfoFilePath) {
@@ -170,9 +383,37 @@ namespace DOH {
 		return reader.read();
 	}
 
-	std::shared_ptr<Model3dCreationData> ResourceHandler::loadObjModelImpl(const std::string& filePath, const AVertexInputLayout& vertexInputLayout) {
+	std::shared_ptr<Model3dCreationData> ResourceHandler::loadObjModelImpl(
+		const std::string& filePath,
+		const AVertexInputLayout& vertexInputLayout,
+		const bool useCookedMesh
+	) {
 		ZoneScoped;
 
+		if (vertexInputLayout.getVertexInputLayoutType() != EVertexInputLayoutType::STATIC) {
+			THROW("Currently Models only support StaticVertexInputLayouts");
+			return nullptr;
+		}
+
+		//TODO:: Custom vertex input layouts for file reading.
+		// Though, either the read function would have to be file-type specific OR I create a custom format that is created from a pre-existing file.
+		const StaticVertexInputLayout& staticVertexInputLayout = (const StaticVertexInputLayout&) vertexInputLayout;
+
+		uint64_t sourceHash = 0;
+		std::string cookedFilePath;
+		if (useCookedMesh) {
+			std::shared_ptr<const FileView> sourceView = openFileViewImpl(filePath.c_str());
+			if (sourceView != nullptr) {
+				sourceHash = ResourceHandler::hashFileData(sourceView->getView());
+				cookedFilePath = ResourceHandler::getCookedMeshFilePath(sourceHash, staticVertexInputLayout.getVertexType());
+
+				std::shared_ptr<Model3dCreationData> cookedData = loadCookedMeshImpl(cookedFilePath, sourceHash, staticVertexInputLayout);
+				if (cookedData != nullptr) {
+					return cookedData;
+				}
+			}
+		}
+
 		tinyobj::attrib_t attrib;
 		std::vector<tinyobj::shape_t> shapes;
 		std::vector<tinyobj::material_t> materials;
@@ -183,35 +424,27 @@ namespace DOH {
 			THROW("OBJ load fail: " + warn + err);
 		}
 
-		if (vertexInputLayout.getVertexInputLayoutType() != EVertexInputLayoutType::STATIC) {
-			THROW("Currently Models only support StaticVertexInputLayouts");
-			return nullptr;
-		}
-
 		std::shared_ptr<Model3dCreationData> fileData = std::make_shared<Model3dCreationData>(vertexInputLayout);
 
-		//TODO:: Custom vertex input layouts for file reading.
-		// Though, either the read function would have to be file-type specific OR I create a custom format that is created from a pre-existing file.
-		const StaticVertexInputLayout& staticVertexInputLayout = (const StaticVertexInputLayout&) vertexInputLayout;
 		switch (staticVertexInputLayout.getVertexType()) {
 			case EVertexType::VERTEX_3D: {
-				const auto& verticesAndIndices = extractObjFileDataAsVertex3d(attrib, shapes, materials);
-				fileData->Vertices = verticesAndIndices.first;
-				fileData->Indices = verticesAndIndices.second;
+				auto verticesAndIndices = extractObjFileDataAsVertex3d(attrib, shapes, materials);
+				fileData->Vertices = std::move(verticesAndIndices.first);
+				fileData->Indices = std::move(verticesAndIndices.second);
 				break;
 			}
 
 			case EVertexType::VERTEX_3D_TEXTURED: {
-				const auto& verticesAndIndices = extractObjFileDataAsVertex3dTextured(attrib, shapes, materials);
-				fileData->Vertices = verticesAndIndices.first;
-				fileData->Indices = verticesAndIndices.second;
+				auto verticesAndIndices = extractObjFileDataAsVertex3dTextured(attrib, shapes, materials);
+				fileData->Vertices = std::move(verticesAndIndices.first);
+				fileData->Indices = std::move(verticesAndIndices.second);
 				break;
 			}
 
 			case EVertexType::VERTEX_3D_LIT_TEXTURED: {
-				const auto& verticesAndIndices = extractObjFileDataAsVertex3dTextured(attrib, shapes, materials);
-				fileData->Vertices = verticesAndIndices.first;
-				fileData->Indices = verticesAndIndices.second;
+				auto verticesAndIndices = extractObjFileDataAsVertex3dTextured(attrib, shapes, materials);
+				fileData->Vertices = std::move(verticesAndIndices.first);
+				fileData->Indices = std::move(verticesAndIndices.second);
 				break;
 			}
 
@@ -220,9 +453,250 @@ namespace DOH {
 				break;
 		}
 
+		if (!cookedFilePath.empty() && !fileData->Vertices.empty()) {
+			writeCookedMeshImpl(cookedFilePath, sourceHash, *fileData);
+		}
+
+		return fileData;
+	}
+
+	std::shared_ptr<Model3dCreationData> ResourceHandler::loadCookedMeshImpl(
+		const std::string& cookedFilePath,
+		const uint64_t sourceHash,
+		const StaticVertexInputLayout& vertexInputLayout
+	) {
+		ZoneScoped;
+
+		std::error_code error;
+		if (!std::filesystem::exists(cookedFilePath, error)) {
+			return nullptr;
+		}
+
+		std::shared_ptr<const FileView> view = openFileViewImpl(cookedFilePath.c_str());
+		if (view == nullptr) {
+			return nullptr;
+		}
+
+		CookedMeshHeader header = {};
+		if (view->size() < sizeof(CookedMeshHeader)) {
+			LOG_WARN("Cooked mesh too small, it will be cooked again: " << cookedFilePath);
+			return nullptr;
+		}
+		memcpy(&header, view->data(), sizeof(CookedMeshHeader));
+
+		if (
+			header.Magic != CookedMeshHeader::MAGIC ||
+			header.Version != CookedMeshHeader::VERSION ||
+			header.SourceHash != sourceHash ||
+			header.VertexType != static_cast<uint32_t>(vertexInputLayout.getVertexType()) ||
+			header.FloatsPerVertex == 0 ||
+			header.FloatsPerVertex != vertexInputLayout.getStride() / sizeof(float) ||
+			header.VertexFloatCount % header.FloatsPerVertex != 0 ||
+			header.getFileSize() != view->size()
+		) {
+			LOG_WARN("Cooked mesh doesn't match, it will be cooked again: " << cookedFilePath);
+			return nullptr;
+		}
+
+		const float* vertices = reinterpret_cast<const float*>(view->data() + header.getVertexDataOffset());
+		const uint32_t* indices = reinterpret_cast<const uint32_t*>(view->data() + header.getIndexDataOffset());
+		const size_t indexCount = static_cast<size_t>(header.IndexCount);
+
+		//Indices go straight to the GPU, one past the last vertex would be an out of bounds vertex fetch
+		const uint64_t vertexCount = header.VertexFloatCount / header.FloatsPerVertex;
+		const uint32_t maxIndex = indexCount > 0 ? *std::max_element(indices, indices + indexCount) : 0;
+		if (indexCount > 0 && maxIndex >= vertexCount) {
+			LOG_WARN("Cooked mesh has out of range indices, it will be cooked again: " << cookedFilePath);
+			return nullptr;
+		}
+
+		std::shared_ptr<Model3dCreationData> fileData = std::make_shared<Model3dCreationData>(vertexInputLayout);
+		fileData->CookedMeshView = view;
+		fileData->CookedVertices = vertices;
+		fileData->CookedVertexFloatCount = static_cast<size_t>(header.VertexFloatCount);
+		fileData->CookedIndices = indices;
+		fileData->CookedIndexCount = indexCount;
 		return fileData;
 	}
 
+	bool ResourceHandler::writeCookedMeshImpl(const std::string& cookedFilePath, const uint64_t sourceHash, const Model3dCreationData& modelData) {
+		ZoneScoped;
+
+		const StaticVertexInputLayout& vertexInputLayout = (const StaticVertexInputLayout&) modelData.VertexInputLayout;
+
+		CookedMeshHeader header = {};
+		header.Magic = CookedMeshHeader::MAGIC;
+		header.Version = CookedMeshHeader::VERSION;
+		header.SourceHash = sourceHash;
+		header.VertexType = static_cast<uint32_t>(vertexInputLayout.getVertexType());
+		header.FloatsPerVertex = vertexInputLayout.getStride() / sizeof(float);
+		header.VertexFloatCount = modelData.getVertexFloatCount();
+		header.IndexCount = modelData.getIndexCount();
+
+		return ResourceHandler::writeCookedFile(
+			cookedFilePath,
+			{
+				{ reinterpret_cast<const char*>(&header), sizeof(CookedMeshHeader) },
+				{ reinterpret_cast<const char*>(modelData.getVertexData()), static_cast<size_t>(header.VertexFloatCount) * sizeof(float) },
+				{ reinterpret_cast<const char*>(modelData.getIndexData()), static_cast<size_t>(header.IndexCount) * sizeof(uint32_t) }
+			}
+		);
+	}
+
+	bool ResourceHandler::writeCookedFile(const std::string& cookedFilePath, const std::initializer_list<std::string_view> parts) {
+		ZoneScoped;
+
+		std::error_code error;
+		std::filesystem::create_directories(std::filesystem::path(cookedFilePath).parent_path(), error);
+
+		//Written to a file unique to this thread then renamed, so a load reading the cooked file never sees it half written
+		//and two threads cooking the same file don't write into the same file.
+		std::stringstream tempFilePath;
+		tempFilePath << cookedFilePath << "." << std::this_thread::get_id() << ".tmp";
+		{
+			std::ofstream file(tempFilePath.str(), std::ios::binary | std::ios::trunc);
+			if (!file.is_open()) {
+				LOG_WARN("Failed to write cooked file: " << cookedFilePath);
+				return false;
+			}
+
+			for (const std::string_view part : parts) {
+				file.write(part.data(), static_cast<std::streamsize>(part.size()));
+			}
+			if (!file.good()) {
+				file.close();
+				std::filesystem::remove(tempFilePath.str(), error);
+				LOG_WARN("Failed to write cooked file: " << cookedFilePath);
+				return false;
+			}
+		}
+
+		//Fails if another thread has already cooked and opened it, which is fine as it's the same data
+		std::filesystem::rename(tempFilePath.str(), cookedFilePath, error);
+		if (error) {
+			std::filesystem::remove(tempFilePath.str(), error);
+			return std::filesystem::exists(cookedFilePath, error);
+		}
+
+		return true;
+	}
+
+	uint64_t ResourceHandler::hashFileData(const std::string_view data) {
+		ZoneScoped;
+
+		//FNV-1a
+		constexpr uint64_t FNV_PRIME = 1099511628211ull;
+		uint64_t hash = 14695981039346656037ull;
+		for (const char c : data) {
+			hash = (hash ^ static_cast<unsigned char>(c)) * FNV_PRIME;
+		}
+		return hash;
+	}
+
+	std::string ResourceHandler::getCookedMeshFilePath(const uint64_t sourceHash, const EVertexType vertexType) {
+		std::stringstream filePath;
+		filePath << ResourceHandler::COOKED_MESH_DIR << std::hex << std::setw(16) << std::setfill('0') << sourceHash;
+		filePath << "_" << EVertexTypeStrings[static_cast<uint32_t>(vertexType)] << ".dmesh";
+		return filePath.str();
+	}
+
+	std::string ResourceHandler::getCookedTextureFilePath(const uint64_t sourceHash, const TextureMipSettings& mipSettings) {
+		std::stringstream filePath;
+		filePath << ResourceHandler::COOKED_TEXTURE_DIR << std::hex << std::setw(16) << std::setfill('0') << sourceHash
+			<< std::dec << "_m" << mipSettings.MaxLevels << "_t" << mipSettings.TileColumns << "x" << mipSettings.TileRows << ".dtex";
+		return filePath.str();
+	}
+
+	std::vector<uint8_t> ResourceHandler::generateMipChain(
+		const uint8_t* pixels,
+		const uint32_t width,
+		const uint32_t height,
+		const uint32_t mipLevels
+	) {
+		ZoneScoped;
+
+		//Colours are averaged in linear space so minified textures don't darken, then converted back to sRGB through a table fine enough to round trip every 8 bit value
+		constexpr size_t LINEAR_TO_SRGB_TABLE_SIZE = 4096;
+		static const std::array<float, 256> srgbToLinear = []() {
+			std::array<float, 256> table = {};
+			for (size_t i = 0; i < table.size(); i++) {
+				const float srgb = static_cast<float>(i) / 255.0f;
+				table[i] = srgb <= 0.04045f ? srgb / 12.92f : std::pow((srgb + 0.055f) / 1.055f, 2.4f);
+			}
+			return table;
+		}();
+		static const std::array<uint8_t, LINEAR_TO_SRGB_TABLE_SIZE> linearToSrgb = []() {
+			std::array<uint8_t, LINEAR_TO_SRGB_TABLE_SIZE> table = {};
+			for (size_t i = 0; i < table.size(); i++) {
+				const float linear = static_cast<float>(i) / static_cast<float>(LINEAR_TO_SRGB_TABLE_SIZE - 1);
+				const float srgb = linear <= 0.0031308f ? linear * 12.92f : 1.055f * std::pow(linear, 1.0f / 2.4f) - 0.055f;
+				table[i] = static_cast<uint8_t>(std::clamp(srgb * 255.0f + 0.5f, 0.0f, 255.0f));
+			}
+			return table;
+		}();
+
+		size_t byteSize = 0;
+		for (uint32_t level = 0; level < mipLevels; level++) {
+			byteSize += static_cast<size_t>(std::max(width >> level, 1u)) * std::max(height >> level, 1u) * 4;
+		}
+
+		std::vector<uint8_t> mipChain(byteSize);
+		memcpy(mipChain.data(), pixels, static_cast<size_t>(width) * height * 4);
+
+		size_t srcOffset = 0;
+		size_t dstOffset = static_cast<size_t>(width) * height * 4;
+		for (uint32_t level = 1; level < mipLevels; level++) {
+			const uint32_t srcWidth = std::max(width >> (level - 1), 1u);
+			const uint32_t srcHeight = std::max(height >> (level - 1), 1u);
+			const uint32_t dstWidth = std::max(width >> level, 1u);
+			const uint32_t dstHeight = std::max(height >> level, 1u);
+			const uint8_t* src = mipChain.data() + srcOffset;
+			uint8_t* dst = mipChain.data() + dstOffset;
+
+			for (uint32_t y = 0; y < dstHeight; y++) {
+				//Odd sizes drop the last row/column and a level that's already 1 wide or high reuses it
+				const uint32_t srcY0 = std::min(y * 2, srcHeight - 1);
+				const uint32_t srcY1 = std::min(y * 2 + 1, srcHeight - 1);
+				for (uint32_t x = 0; x < dstWidth; x++) {
+					const uint32_t srcX0 = std::min(x * 2, srcWidth - 1);
+					const uint32_t srcX1 = std::min(x * 2 + 1, srcWidth - 1);
+					const uint8_t* texels[4] = {
+						src + (static_cast<size_t>(srcY0) * srcWidth + srcX0) * 4,
+						src + (static_cast<size_t>(srcY0) * srcWidth + srcX1) * 4,
+						src + (static_cast<size_t>(srcY1) * srcWidth + srcX0) * 4,
+						src + (static_cast<size_t>(srcY1) * srcWidth + srcX1) * 4
+					};
+
+					//Weighted by alpha so fully transparent texels don't bleed their colour into the edges of sprites
+					float colour[3] = { 0.0f, 0.0f, 0.0f };
+					float unweightedColour[3] = { 0.0f, 0.0f, 0.0f };
+					float alphaSum = 0.0f;
+					for (const uint8_t* texel : texels) {
+						const float alpha = static_cast<float>(texel[3]) / 255.0f;
+						for (uint32_t c = 0; c < 3; c++) {
+							const float linear = srgbToLinear[texel[c]];
+							colour[c] += linear * alpha;
+							unweightedColour[c] += linear;
+						}
+						alphaSum += alpha;
+					}
+
+					uint8_t* out = dst + (static_cast<size_t>(y) * dstWidth + x) * 4;
+					for (uint32_t c = 0; c < 3; c++) {
+						const float linear = alphaSum > 0.0f ? colour[c] / alphaSum : unweightedColour[c] / 4.0f;
+						out[c] = linearToSrgb[static_cast<size_t>(std::clamp(linear, 0.0f, 1.0f) * static_cast<float>(LINEAR_TO_SRGB_TABLE_SIZE - 1) + 0.5f)];
+					}
+					out[3] = static_cast<uint8_t>((static_cast<uint32_t>(texels[0][3]) + texels[1][3] + texels[2][3] + texels[3][3] + 2) / 4);
+				}
+			}
+
+			srcOffset = dstOffset;
+			dstOffset += static_cast<size_t>(dstWidth) * dstHeight * 4;
+		}
+
+		return mipChain;
+	}
+
 	std::shared_ptr<FntFileData> ResourceHandler::loadFntFileImpl(const char* filePath) {
 		ZoneScoped;
 
@@ -245,6 +719,62 @@ namespace DOH {
 		return jsonReader.read();
 	}
 
+	std::shared_ptr<JsonDocument> ResourceHandler::loadJsonDocumentImpl(const char* filePath) {
+		ZoneScoped;
+
+		JsonFileReader jsonReader(filePath);
+		if (!jsonReader.isOpen()) {
+			LOG_ERR("Failed to open file: " << filePath);
+			return nullptr;
+		}
+		return jsonReader.readDocument();
+	}
+
+	std::shared_ptr<const FileView> ResourceHandler::openFileViewImpl(const char* filePath) {
+		ZoneScoped;
+
+		std::error_code error;
+		const int64_t lastWriteTime = static_cast<int64_t>(std::filesystem::last_write_time(filePath, error).time_since_epoch().count());
+		const uintmax_t fileSize = error ? 0 : std::filesystem::file_size(filePath, error);
+		if (error) {
+			LOG_ERR("Failed to open file view: " << filePath);
+			return nullptr;
+		}
+
+		std::lock_guard<std::mutex> lock(mFileViewCacheMutex);
+
+		const auto cached = mFileViewCache.find(filePath);
+		if (
+			cached != mFileViewCache.end() &&
+			cached->second.LastWriteTime == lastWriteTime &&
+			cached->second.FileSize == fileSize
+		) {
+			std::shared_ptr<FileView> view = cached->second.View.lock();
+			if (view != nullptr) {
+				return view;
+			}
+		}
+
+		std::shared_ptr<FileView> view = FileView::create(filePath);
+		if (view == nullptr) {
+			LOG_ERR("Failed to open file view: " << filePath);
+			return nullptr;
+		}
+
+		if (mFileViewCache.size() >= ResourceHandler::FILE_VIEW_CACHE_PRUNE_SIZE) {
+			for (auto itr = mFileViewCache.begin(); itr != mFileViewCache.end();) {
+				if (itr->second.View.expired()) {
+					itr = mFileViewCache.erase(itr);
+				} else {
+					itr++;
+				}
+			}
+		}
+		mFileViewCache[filePath] = { view, lastWriteTime, fileSize };
+
+		return view;
+	}
+
 	bool ResourceHandler::writeJsonFileImpl(const char* filePath, std::shared_ptr<JsonFileData> fileData) {
 		ZoneScoped;
 
@@ -253,15 +783,15 @@ namespace DOH {
 		return jsonWriter.writeCompact(*fileData);
 	}
 
-	const std::string ResourceHandler::getCurrentLineAsBuffer(const std::vector<char>& chars, const size_t startIndex) {
+	const std::string ResourceHandler::getCurrentLineAsBuffer(const std::string_view chars, const size_t startIndex) {
 		//ZoneScoped;
 
 		const size_t lineLength = ResourceHandler::getLengthOfCurrentLine(chars, startIndex);
-		return std::string(chars.begin() + startIndex, chars.begin() + startIndex + lineLength) + "\0";
+		return std::string(chars.substr(startIndex, lineLength)) + "\0";
 	}
 
 	const size_t ResourceHandler::getLengthTillNextTargetChar(
-		const std::vector<char>& chars,
+		const std::string_view chars,
 		const char targetChar,
 		const size_t startIndex
 	) {
@@ -284,7 +814,7 @@ namespace DOH {
 		return 1;
 	}
 
-	const size_t ResourceHandler::getLengthOfCurrentLine(const std::vector<char>& chars, const size_t currentLineStartIndex) {
+	const size_t ResourceHandler::getLengthOfCurrentLine(const std::string_view chars, const size_t currentLineStartIndex) {
 		//ZoneScoped;
 
 		return ResourceHandler::getLengthTillNextTargetChar(chars, '\n', currentLineStartIndex) + 1; //+1 to include '\n'
@@ -320,7 +850,7 @@ namespace DOH {
 	std::shared_ptr<ApplicationInitSettings> ResourceHandler::loadAppInitSettings(const char* fileName) {
 		ZoneScoped;
 
-		std::shared_ptr<JsonFileData> initSettingsJson = ResourceHandler::loadJsonFile(fileName);
+		std::shared_ptr<JsonDocument> initSettingsJson = ResourceHandler::loadJsonDocument(fileName);
 
 		if (initSettingsJson == nullptr) {
 			LOG_ERR("ResourceHandler::loadAppInitSettings failed to load json file: " << fileName);
@@ -329,43 +859,43 @@ namespace DOH {
 		}
 
 		std::shared_ptr<ApplicationInitSettings> initSettings = std::make_shared<ApplicationInitSettings>(fileName);
-		std::unordered_map<std::string, JsonElement>& rootObj = initSettingsJson->getRoot().getObject();
-		initSettings->ApplicationName = rootObj.at(ApplicationInitSettings::APPLICATION_NAME_LABEL).getString();
-		initSettings->WindowWidth = static_cast<uint32_t>(rootObj.at(ApplicationInitSettings::WINDOW_WIDTH_LABEL).getLong());
-		initSettings->WindowHeight = static_cast<uint32_t>(rootObj.at(ApplicationInitSettings::WINDOW_HEIGHT_LABEL).getLong());
-		initSettings->WindowDisplayMode = static_cast<EWindowDisplayMode>(rootObj.at(ApplicationInitSettings::WINDOW_DISPLAY_MODE_LABEL).getLong());
-		initSettings->TargetForegroundFps = rootObj.at(ApplicationInitSettings::TARGET_FOREGROUND_FPS_LABEL).getNumberAsFloat();
-		initSettings->TargetForegroundUps = rootObj.at(ApplicationInitSettings::TARGET_FOREGROUND_UPS_LABEL).getNumberAsFloat();
-		initSettings->RunInBackground = rootObj.at(ApplicationInitSettings::RUN_IN_BACKGROUND_LABEL).getBool();
-		initSettings->TargetBackgroundFps = rootObj.at(ApplicationInitSettings::TARGET_BACKGROUND_FPS_LABEL).getNumberAsFloat();
-		initSettings->TargetBackgroundUps = rootObj.at(ApplicationInitSettings::TARGET_BACKGROUND_UPS_LABEL).getNumberAsFloat();
+		const JsonValue rootObj = initSettingsJson->getRoot();
+		initSettings->ApplicationName = rootObj[ApplicationInitSettings::APPLICATION_NAME_LABEL].getString();
+		initSettings->WindowWidth = static_cast<uint32_t>(rootObj[ApplicationInitSettings::WINDOW_WIDTH_LABEL].getLong());
+		initSettings->WindowHeight = static_cast<uint32_t>(rootObj[ApplicationInitSettings::WINDOW_HEIGHT_LABEL].getLong());
+		initSettings->WindowDisplayMode = static_cast<EWindowDisplayMode>(rootObj[ApplicationInitSettings::WINDOW_DISPLAY_MODE_LABEL].getLong());
+		initSettings->TargetForegroundFps = rootObj[ApplicationInitSettings::TARGET_FOREGROUND_FPS_LABEL].getNumberAsFloat();
+		initSettings->TargetForegroundUps = rootObj[ApplicationInitSettings::TARGET_FOREGROUND_UPS_LABEL].getNumberAsFloat();
+		initSettings->RunInBackground = rootObj[ApplicationInitSettings::RUN_IN_BACKGROUND_LABEL].getBool();
+		initSettings->TargetBackgroundFps = rootObj[ApplicationInitSettings::TARGET_BACKGROUND_FPS_LABEL].getNumberAsFloat();
+		initSettings->TargetBackgroundUps = rootObj[ApplicationInitSettings::TARGET_BACKGROUND_UPS_LABEL].getNumberAsFloat();
 
 		return initSettings;
 	}
 
 	void ResourceHandler::wrtieAppInitSettings(const char* fileName, std::shared_ptr<ApplicationInitSettings> initSettings) {
-		std::shared_ptr<JsonFileData> initSettingsJson = std::make_shared<JsonFileData>();
-		
-		auto& rootInsert = initSettingsJson->FileData.insert({ JSON_ROOT_OBJECT_NAME, createElementObject()});
-		if (!rootInsert.second) {
-			LOG_ERR("ResourceHandler::writeAppInitSettings failed to create root for JsonFileData: " << fileName);
-			return;
-		}
-		std::unordered_map<std::string, JsonElement>& root = rootInsert.first->second.getObject();
-		//root.insert({ ApplicationInitSettings::FILE_NAME_LABEL, { EJsonElementType::DATA_STRING, fileName } });
-		root.insert({ ApplicationInitSettings::APPLICATION_NAME_LABEL, { EJsonElementType::DATA_STRING, initSettings->ApplicationName } });
-		root.insert({ ApplicationInitSettings::WINDOW_WIDTH_LABEL, { EJsonElementType::DATA_LONG, static_cast<long>(initSettings->WindowWidth) } });
-		root.insert({ ApplicationInitSettings::WINDOW_HEIGHT_LABEL, { EJsonElementType::DATA_LONG, static_cast<long>(initSettings->WindowHeight) } });
-		root.insert({ ApplicationInitSettings::WINDOW_DISPLAY_MODE_LABEL, { EJsonElementType::DATA_LONG, static_cast<long>(initSettings->WindowDisplayMode) } });
-		root.insert({ ApplicationInitSettings::TARGET_FOREGROUND_FPS_LABEL, { EJsonElementType::DATA_DOUBLE, static_cast<double>(initSettings->TargetForegroundFps) } });
-		root.insert({ ApplicationInitSettings::TARGET_FOREGROUND_UPS_LABEL, { EJsonElementType::DATA_DOUBLE, static_cast<double>(initSettings->TargetForegroundUps) } });
-		root.insert({ ApplicationInitSettings::RUN_IN_BACKGROUND_LABEL, { EJsonElementType::DATA_BOOL, initSettings->RunInBackground } });
-		root.insert({ ApplicationInitSettings::TARGET_BACKGROUND_FPS_LABEL, { EJsonElementType::DATA_DOUBLE, static_cast<double>(initSettings->TargetBackgroundFps) } });
-		root.insert({ ApplicationInitSettings::TARGET_BACKGROUND_UPS_LABEL, { EJsonElementType::DATA_DOUBLE, static_cast<double>(initSettings->TargetBackgroundUps) } });
+		ZoneScoped;
 
 		//NOTE:: By default app init settings files are stored in the same directory as the .exe
 		//TODO:: Is this necessary? Why not just use FilePath instead of FileName?
-		ResourceHandler::writeJsonFile(fileName, initSettingsJson);
+		//Written directly as there's no need to build a JsonFileData first
+		JsonStreamWriter writer(fileName);
+		writer.beginObject();
+		//writer.writeString(ApplicationInitSettings::FILE_NAME_LABEL, fileName);
+		writer.writeString(ApplicationInitSettings::APPLICATION_NAME_LABEL, initSettings->ApplicationName);
+		writer.writeLong(ApplicationInitSettings::WINDOW_WIDTH_LABEL, static_cast<int64_t>(initSettings->WindowWidth));
+		writer.writeLong(ApplicationInitSettings::WINDOW_HEIGHT_LABEL, static_cast<int64_t>(initSettings->WindowHeight));
+		writer.writeLong(ApplicationInitSettings::WINDOW_DISPLAY_MODE_LABEL, static_cast<int64_t>(initSettings->WindowDisplayMode));
+		writer.writeDouble(ApplicationInitSettings::TARGET_FOREGROUND_FPS_LABEL, static_cast<double>(initSettings->TargetForegroundFps));
+		writer.writeDouble(ApplicationInitSettings::TARGET_FOREGROUND_UPS_LABEL, static_cast<double>(initSettings->TargetForegroundUps));
+		writer.writeBool(ApplicationInitSettings::RUN_IN_BACKGROUND_LABEL, initSettings->RunInBackground);
+		writer.writeDouble(ApplicationInitSettings::TARGET_BACKGROUND_FPS_LABEL, static_cast<double>(initSettings->TargetBackgroundFps));
+		writer.writeDouble(ApplicationInitSettings::TARGET_BACKGROUND_UPS_LABEL, static_cast<double>(initSettings->TargetBackgroundUps));
+		writer.endObject();
+
+		if (!writer.close()) {
+			LOG_ERR("ResourceHandler::writeAppInitSettings failed to write: " << fileName);
+		}
 	}
 	
 	std::pair<std::vector<float>, std::vector<uint32_t>> ResourceHandler::extractObjFileDataAsVertex3d(
@@ -379,7 +909,13 @@ namespace DOH {
 		std::vector<Vertex3d> vertices;
 		std::vector<uint32_t> indices;
 
-		uint32_t uniqueVertexIndex = 0;
+		size_t indexCount = 0;
+		for (const tinyobj::shape_t& shape : shapes) {
+			indexCount += shape.mesh.indices.size();
+		}
+		indices.reserve(indexCount);
+		uniqueVertices.reserve(indexCount);
+
 		for (const tinyobj::shape_t& shape : shapes) {
 			for (const tinyobj::index_t& index : shape.mesh.indices) {
 				Vertex3d vertex = {};
@@ -405,13 +941,13 @@ namespace DOH {
 					//}
 				}
 
-				if (uniqueVertices.count(vertex) == 0) {
-					uniqueVertices[vertex] = uniqueVertexIndex;
+				//Single lookup, a new vertex is given the next index
+				const auto [uniqueVertex, inserted] = uniqueVertices.try_emplace(vertex, static_cast<uint32_t>(vertices.size()));
+				if (inserted) {
 					vertices.push_back(vertex);
-					uniqueVertexIndex++;
 				}
 
-				indices.push_back(uniqueVertices[vertex]);
+				indices.push_back(uniqueVertex->second);
 			}
 		}
 
@@ -428,7 +964,7 @@ namespace DOH {
 			verticesAsFloats.emplace_back(vertex.Colour.a);
 		}
 
-		return { verticesAsFloats, indices };
+		return { std::move(verticesAsFloats), std::move(indices) };
 	}
 
 	std::pair<std::vector<float>, std::vector<uint32_t>> ResourceHandler::extractObjFileDataAsVertex3dTextured(
@@ -442,7 +978,13 @@ namespace DOH {
 		std::vector<Vertex3dTextured> vertices;
 		std::vector<uint32_t> indices;
 
-		uint32_t uniqueVertexIndex = 0;
+		size_t indexCount = 0;
+		for (const tinyobj::shape_t& shape : shapes) {
+			indexCount += shape.mesh.indices.size();
+		}
+		indices.reserve(indexCount);
+		uniqueVertices.reserve(indexCount);
+
 		for (const tinyobj::shape_t& shape : shapes) {
 			for (const tinyobj::index_t& index : shape.mesh.indices) {
 				Vertex3dTextured vertex = {};
@@ -462,13 +1004,13 @@ namespace DOH {
 					};
 				}
 
-				if (uniqueVertices.count(vertex) == 0) {
-					uniqueVertices[vertex] = uniqueVertexIndex;
+				//Single lookup, a new vertex is given the next index
+				const auto [uniqueVertex, inserted] = uniqueVertices.try_emplace(vertex, static_cast<uint32_t>(vertices.size()));
+				if (inserted) {
 					vertices.push_back(vertex);
-					uniqueVertexIndex++;
 				}
 
-				indices.push_back(uniqueVertices[vertex]);
+				indices.push_back(uniqueVertex->second);
 			}
 		}
 
@@ -487,7 +1029,7 @@ namespace DOH {
 			verticesAsFloats.emplace_back(vertex.TexCoord.y);
 		}
 
-		return { verticesAsFloats, indices };
+		return { std::move(verticesAsFloats), std::move(indices) };
 	}
 
 	std::pair<std::vector<float>, std::vector<uint32_t>> ResourceHandler::extractObjFileDataAsVertex3dLitTextured(
@@ -501,7 +1043,13 @@ namespace DOH {
 		std::vector<Vertex3dLitTextured> vertices;
 		std::vector<uint32_t> indices;
 
-		uint32_t uniqueVertexIndex = 0;
+		size_t indexCount = 0;
+		for (const tinyobj::shape_t& shape : shapes) {
+			indexCount += shape.mesh.indices.size();
+		}
+		indices.reserve(indexCount);
+		uniqueVertices.reserve(indexCount);
+
 		for (const tinyobj::shape_t& shape : shapes) {
 			for (const tinyobj::index_t& index : shape.mesh.indices) {
 				Vertex3dLitTextured vertex = {};
@@ -538,13 +1086,13 @@ namespace DOH {
 					};
 				}
 
-				if (uniqueVertices.count(vertex) == 0) {
-					uniqueVertices[vertex] = uniqueVertexIndex;
+				//Single lookup, a new vertex is given the next index
+				const auto [uniqueVertex, inserted] = uniqueVertices.try_emplace(vertex, static_cast<uint32_t>(vertices.size()));
+				if (inserted) {
 					vertices.push_back(vertex);
-					uniqueVertexIndex++;
 				}
 
-				indices.push_back(uniqueVertices[vertex]);
+				indices.push_back(uniqueVertex->second);
 			}
 		}
 
@@ -566,6 +1114,6 @@ namespace DOH {
 			verticesAsFloats.emplace_back(vertex.TexCoord.y);
 		}
 
-		return { verticesAsFloats, indices };
+		return { std::move(verticesAsFloats), std::move(indices) };
 	}
 }
@@ -2,6 +2,11 @@
 
 #include "dough/rendering/Config.h"
 #include "dough/rendering/VertexInputLayout.h"
+#include "dough/files/AsyncAssetLoader.h"
+#include "dough/rendering/textures/TextureMipSettings.h"
+
+#include <mutex>
+#include <string_view>
 
 namespace tinyobj {
 	struct attrib_t;
@@ -13,17 +18,34 @@ namespace DOH {
 
 	struct FntFileData;
 	struct JsonFileData;
+	class JsonDocument;
+	class FileView;
 	struct ObjFileData;
 	struct IndexedAtlasInfoFileData;
 	struct ApplicationInitSettings;
 
+	//Release with ResourceHandler::freeTexture.
 	struct TextureCreationData {
+		//4 channel texels of every mip level, largest first, each max(Width >> level, 1) by max(Height >> level, 1)
 		void* Data;
 		uint32_t Width = 0;
 		uint32_t Height = 0;
 		uint32_t Channels = 0;
+		uint32_t MipLevels = 1;
+		//What MipLevels was limited by when cooked
+		TextureMipSettings MipSettings;
+		//Set when Data points into a cooked texture, keeps the mapped file open. Otherwise Data was allocated by stb_image.
+		std::shared_ptr<const FileView> CookedTextureView;
 
 		bool Failed; //NOTE:: Other "CreationData" or "FileData" types are stored in a shard_ptr, this allows for an equivalent to "!= nullptr" check
+
+		inline size_t getByteSize() const {
+			size_t size = 0;
+			for (uint32_t level = 0; level < MipLevels; level++) {
+				size += static_cast<size_t>(std::max(Width >> level, 1u)) * std::max(Height >> level, 1u) * 4;
+			}
+			return size;
+		}
 	};
 
 	struct Model3dCreationData {
@@ -42,6 +64,19 @@ namespace DOH {
 		std::vector<float> Vertices;
 		std::vector<uint32_t> Indices;
 
+		//Set instead of Vertices and Indices when loaded from a cooked mesh, keeps the mapped file that CookedVertices and CookedIndices point into open.
+		std::shared_ptr<const FileView> CookedMeshView;
+		const float* CookedVertices = nullptr;
+		size_t CookedVertexFloatCount = 0;
+		const uint32_t* CookedIndices = nullptr;
+		size_t CookedIndexCount = 0;
+
+		//Vertex and index data, wherever it's held
+		inline const float* getVertexData() const { return CookedMeshView != nullptr ? CookedVertices : Vertices.data(); }
+		inline size_t getVertexFloatCount() const { return CookedMeshView != nullptr ? CookedVertexFloatCount : Vertices.size(); }
+		inline const uint32_t* getIndexData() const { return CookedMeshView != nullptr ? CookedIndices : Indices.data(); }
+		inline size_t getIndexCount() const { return CookedMeshView != nullptr ? CookedIndexCount : Indices.size(); }
+
 		//IMPORTANT:: Since model file reading only supports statically defined types the VertexInputLayout is defined by EVertexType
 		const AVertexInputLayout& VertexInputLayout;
 	};
@@ -54,15 +89,47 @@ namespace DOH {
 		:	mNextAvailableTextureId(0)
 		{}
 
-		uint32_t mNextAvailableTextureId;
+		struct CachedFileView {
+			std::weak_ptr<FileView> View;
+			//Checked so a file changed on disk since it was opened is opened again
+			int64_t LastWriteTime;
+			uintmax_t FileSize;
+		};
+		//Only holds views that are in use somewhere else, the cache never keeps a file open by itself.
+		//Expired entries are removed when the cache reaches FILE_VIEW_CACHE_PRUNE_SIZE.
+		constexpr static size_t FILE_VIEW_CACHE_PRUNE_SIZE = 64;
 
-		TextureCreationData loadTextureImpl(const char* filePath);
-		void freeImageImpl(void* imageData);
+		uint32_t mNextAvailableTextureId;
+		AsyncAssetLoader mAsyncLoader;
+		std::unordered_map<std::string, CachedFileView> mFileViewCache;
+		std::mutex mFileViewCacheMutex;
+
+		TextureCreationData loadTextureImpl(const char* filePath, const bool useCookedTexture, const TextureMipSettings& mipSettings);
+		//Failed is set if there's no valid cooked texture at cookedFilePath for sourceHash and mipSettings
+		TextureCreationData loadCookedTextureImpl(
+			const std::string& cookedFilePath,
+			const uint64_t sourceHash,
+			const TextureMipSettings& mipSettings
+		);
+		void freeTextureImpl(TextureCreationData& textureData);
 		std::shared_ptr<IndexedAtlasInfoFileData> loadIndexedTextureAtlasImpl(const char* atlasInfoFilePath);
 		std::shared_ptr<FntFileData> loadFntFileImpl(const char* filePath);
 		std::shared_ptr<JsonFileData> loadJsonFileImpl(const char* filePath);
+		std::shared_ptr<JsonDocument> loadJsonDocumentImpl(const char* filePath);
+		std::shared_ptr<const FileView> openFileViewImpl(const char* filePath);
 		bool writeJsonFileImpl(const char* filePath, std::shared_ptr<JsonFileData> fileData);
-		std::shared_ptr<Model3dCreationData> loadObjModelImpl(const std::string& filePath, const AVertexInputLayout& vertexInputLayout);
+		std::shared_ptr<Model3dCreationData> loadObjModelImpl(const std::string& filePath, const AVertexInputLayout& vertexInputLayout, const bool useCookedMesh);
+		//Returns nullptr if there's no valid cooked mesh at cookedFilePath for sourceHash
+		std::shared_ptr<Model3dCreationData> loadCookedMeshImpl(const std::string& cookedFilePath, const uint64_t sourceHash, const StaticVertexInputLayout& vertexInputLayout);
+		bool writeCookedMeshImpl(const std::string& cookedFilePath, const uint64_t sourceHash, const Model3dCreationData& modelData);
+
+		static uint64_t hashFileData(const std::string_view data);
+		static std::string getCookedMeshFilePath(const uint64_t sourceHash, const EVertexType vertexType);
+		static std::string getCookedTextureFilePath(const uint64_t sourceHash, const TextureMipSettings& mipSettings);
+		//Write parts one after another to a new file at cookedFilePath, without a reader ever seeing it half written.
+		static bool writeCookedFile(const std::string& cookedFilePath, const std::initializer_list<std::string_view> parts);
+		//Every mip level of 4 channel sRGB pixels, largest first. Each texel of a level is the alpha weighted average in linear space of 2x2 texels of the level before.
+		static std::vector<uint8_t> generateMipChain(const uint8_t* pixels, const uint32_t width, const uint32_t height, const uint32_t mipLevels);
 
 		static std::pair<std::vector<float>, std::vector<uint32_t>> extractObjFileDataAsVertex3d(
 			const tinyobj::attrib_t& attrib,
@@ -82,29 +149,69 @@ namespace DOH {
 
 	public:
 		constexpr static uint32_t INVALID_TEXTURE_ID = UINT32_MAX;
+		//Where loadObjModel writes cooked meshes, see CookedMeshFileData.h
+		constexpr static const char* COOKED_MESH_DIR = "localCookedMeshes/";
+		//Where loadTexture writes cooked textures, see CookedTextureFileData.h
+		constexpr static const char* COOKED_TEXTURE_DIR = "localCookedTextures/";
 
 		ResourceHandler(const ResourceHandler& copy) = delete;
 		ResourceHandler operator=(const ResourceHandler& assignment) = delete;
 
 		static ResourceHandler& get() { return INSTANCE; }
 
-		static TextureCreationData loadTexture(const char* filePath);
-		static void freeImage(void* imageData);
+		//Start and stop the worker threads used by the load...Async functions, called by Application.
+		static void init();
+		static void close();
+
+		/**
+		* Load...Async functions read and decode on a worker thread and return a future of what the matching load function returns.
+		* Nothing is created on the GPU, poll the future with wait_for(0) on the main thread and create any GPU resources once it's ready.
+		* If the worker threads aren't running the load is done straight away and the future is already ready.
+		*/
+		static std::future<TextureCreationData> loadTextureAsync(const std::string& filePath, const TextureMipSettings& mipSettings = {});
+		static std::future<std::shared_ptr<Model3dCreationData>> loadObjModelAsync(const std::string& filePath, const AVertexInputLayout& vertexInputLayout);
+		static std::future<std::shared_ptr<JsonDocument>> loadJsonDocumentAsync(const std::string& filePath);
+		static inline AsyncAssetLoader& getAsyncLoader() { return INSTANCE.mAsyncLoader; }
+
+		/**
+		* Loads from the cooked texture of filePath's current contents if there is one, otherwise the image is decoded, its mip chain
+		* generated and a cooked texture written for next time. useCookedTexture = false only decodes the image, without mips.
+		* mipSettings limits the mip chain, textures loaded with different settings are cooked separately.
+		*/
+		static TextureCreationData loadTexture(
+			const char* filePath,
+			const bool useCookedTexture = true,
+			const TextureMipSettings& mipSettings = {}
+		);
+		static void freeTexture(TextureCreationData& textureData);
+		//Levels in a full mip chain down to 1x1
+		static uint32_t getMipLevelCount(const uint32_t width, const uint32_t height);
+		//Levels in a mip chain limited by mipSettings, at least 1
+		static uint32_t getMipLevelCount(const uint32_t width, const uint32_t height, const TextureMipSettings& mipSettings);
 		static std::shared_ptr<IndexedAtlasInfoFileData> loadIndexedTextureAtlas(const char* atlasInfoFilePath);
+		//Copy of the whole file, prefer openFileView when the contents are only read.
 		static std::vector<char> readFile(const std::string& filePath);
+		/**
+		* Read only view of a whole file, memory mapped where possible so the file isn't copied into memory.
+		* Opening a file that already has a view in use (and hasn't changed on disk since) returns that view.
+		* Returns nullptr if the file can't be opened.
+		*/
+		static std::shared_ptr<const FileView> openFileView(const char* filePath);
 		static uint32_t getNextUniqueTextureId();
 		constexpr static inline bool isValidTextureId(uint32_t id) { return id != ResourceHandler::INVALID_TEXTURE_ID; }
 		//TODO:: allow for VertexType to be specified when loading
 		static std::shared_ptr<Model3dCreationData> loadObjModel(const std::string& filePath);
 		static std::shared_ptr<FntFileData> loadFntFile(const char* filePath);
 		static std::shared_ptr<JsonFileData> loadJsonFile(const char* filePath);
+		//Read only and faster to load than loadJsonFile, prefer this unless the data is edited or written back.
+		static std::shared_ptr<JsonDocument> loadJsonDocument(const char* filePath);
 		static bool writeJsonFile(const char* filePath, std::shared_ptr<JsonFileData> fileData);
 
 
 		//------String parsing helpers-----
-		static const std::string getCurrentLineAsBuffer(const std::vector<char>& chars, const size_t startIndex);
-		static const size_t getLengthTillNextTargetChar(const std::vector<char>& chars, const char targetChar, const size_t startIndex);
-		static const size_t getLengthOfCurrentLine(const std::vector<char>& chars, const size_t currentLineStartIndex);
+		static const std::string getCurrentLineAsBuffer(const std::string_view chars, const size_t startIndex);
+		static const size_t getLengthTillNextTargetChar(const std::string_view chars, const char targetChar, const size_t startIndex);
+		static const size_t getLengthOfCurrentLine(const std::string_view chars, const size_t currentLineStartIndex);
 
 		//-----File type helpers-----
 		static const bool isFileOfType(const char* filePath, const char* type);
@@ -116,6 +223,14 @@ namespace DOH {
 		static std::shared_ptr<ApplicationInitSettings> loadAppInitSettings(const char* fileName);
 		static void wrtieAppInitSettings(const char* fileName, std::shared_ptr<ApplicationInitSettings> initSettings);
 
-		static std::shared_ptr<Model3dCreationData> loadObjModel(const std::string& filePath, const AVertexInputLayout& vertexInputLayout);
+		/**
+		* Loads from the cooked mesh of filePath's current contents if there is one, otherwise the obj is parsed and a cooked mesh written
+		* for next time. useCookedMesh = false always parses the obj and doesn't write a cooked mesh.
+		*/
+		static std::shared_ptr<Model3dCreationData> loadObjModel(
+			const std::string& filePath,
+			const AVertexInputLayout& vertexInputLayout,
+			const bool useCookedMesh = true
+		);
 	};
 }
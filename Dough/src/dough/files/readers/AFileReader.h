@@ -2,6 +2,7 @@
 
 #include "dough/Core.h"
 #include "dough/files/AFileData.h"
+#include "dough/files/FileView.h"
 
 namespace DOH {
 
@@ -13,7 +14,9 @@ namespace DOH {
 	template<typename T, typename = std::enable_if<std::is_base_of<AFileData, T>::value>>
 	class AFileReader {
 	protected:
-		std::vector<char> mChars;
+		std::shared_ptr<const FileView> mFileView;
+		//The whole file while open, read directly from mFileView
+		std::string_view mChars;
 		const char* mFilepath;
 		bool mOpen;
 
@@ -30,6 +33,6 @@ namespace DOH {
 		virtual std::shared_ptr<T> read(const bool closeWhenRead) = 0;
 
 		inline const bool isOpen() const { return mOpen; }
-		inline void close() { mChars.clear(); mOpen = false; }
+		inline void close() { mFileView.reset(); mChars = {}; mOpen = false; }
 	};
 }
@@ -33,8 +33,11 @@ namespace DOH {
 		ZoneScoped;
 
 		if (!mOpen) {
-			mChars = ResourceHandler::readFile(mFilepath);
-			mOpen = true;
+			mFileView = ResourceHandler::openFileView(mFilepath);
+			if (mFileView != nullptr) {
+				mChars = mFileView->getView();
+				mOpen = true;
+			}
 		} else {
 			LOG_WARN("Attempting open already open reader");
 		}
@@ -17,6 +17,6 @@ namespace DOH {
 		virtual std::shared_ptr<FntFileData> read(const bool closeWhenRead = true) override;
 
 		inline const bool isOpen() const { return mOpen; }
-		inline void close() { mChars.clear(); mOpen = false; }
+		inline void close() { mFileView.reset(); mChars = {}; mOpen = false; }
 	};
 }
@@ -31,8 +31,11 @@ namespace DOH {
 		ZoneScoped;
 
 		if (!mOpen) {
-			mChars = ResourceHandler::readFile(mFilepath);
-			mOpen = true;
+			mFileView = ResourceHandler::openFileView(mFilepath);
+			if (mFileView != nullptr) {
+				mChars = mFileView->getView();
+				mOpen = true;
+			}
 		} else {
 			LOG_WARN("Attempting to open an already open reader");
 		}
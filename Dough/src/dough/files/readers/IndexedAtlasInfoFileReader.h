@@ -15,6 +15,6 @@ namespace DOH {
 		virtual std::shared_ptr<IndexedAtlasInfoFileData> read(const bool closeWhenRead = true) override;
 
 		inline const bool isOpen() const { return mOpen; }
-		inline void close() { mChars.clear(); mOpen = false; }
+		inline void close() { mFileView.reset(); mChars = {}; mOpen = false; }
 	};
 }
@@ -0,0 +1,602 @@
+#include "dough/files/readers/JsonStreamReader.h"
+
+#include "dough/files/ResourceHandler.h"
+#include "dough/Logging.h"
+
+#include <tracy/public/tracy/Tracy.hpp>
+
+#include <charconv>
+#include <fstream>
+
+namespace DOH {
+
+	//Recursive descent over a stream read one chunk at a time, sending events to the handler as each value is read.
+	class JsonStreamParser {
+	private:
+		constexpr static uint32_t UTF8_REPLACEMENT_CHARACTER = 0xFFFD;
+		constexpr static size_t MIN_CHUNK_SIZE = 64;
+
+		std::istream& mStream;
+		AJsonStreamHandler& mHandler;
+		const char* mDebugName;
+
+		std::vector<char> mChunk;
+		size_t mChunkPos;
+		size_t mChunkLength;
+		//Offset in the stream of mChunk[0]
+		size_t mChunkStreamOffset;
+
+		//Position for error messages, counted as whitespace is skipped
+		uint32_t mDebugLineNumber;
+		size_t mDebugLineStartOffset;
+
+		//Only the current member's name is ever needed, a container's name isn't used after its start event
+		std::string mKeyBuffer;
+		//Used for string values split over chunks or containing escapes, others are sent as a view into the chunk
+		std::string mStringBuffer;
+		std::string mNumberBuffer;
+
+		uint32_t mDepth;
+		bool mStopped;
+
+	public:
+		JsonStreamParser(std::istream& stream, AJsonStreamHandler& handler, const char* debugName, const size_t chunkSize)
+		:	mStream(stream),
+			mHandler(handler),
+			mDebugName(debugName),
+			mChunk(std::max(chunkSize, JsonStreamParser::MIN_CHUNK_SIZE)),
+			mChunkPos(0),
+			mChunkLength(0),
+			mChunkStreamOffset(0),
+			mDebugLineNumber(1),
+			mDebugLineStartOffset(0),
+			mDepth(0),
+			mStopped(false)
+		{}
+
+		EJsonStreamResult parse() {
+			//UTF-8 BOM
+			if (refill() && mChunkLength >= 3 && memcmp(mChunk.data(), "\xEF\xBB\xBF", 3) == 0) {
+				mChunkPos = 3;
+			}
+
+			skipWhitespace();
+			if (!hasChar()) {
+				error("Empty JSON");
+				return EJsonStreamResult::FAILED;
+			} else if (!parseValue({})) {
+				return mStopped ? EJsonStreamResult::STOPPED : EJsonStreamResult::FAILED;
+			}
+
+			skipWhitespace();
+			if (hasChar() && peek() != '\0') {
+				error("Unexpected content after root value");
+				return EJsonStreamResult::FAILED;
+			}
+
+			return EJsonStreamResult::COMPLETED;
+		}
+
+		inline size_t getBytesRead() const { return mChunkStreamOffset + mChunkLength; }
+
+	private:
+		bool error(const char* message) const {
+			const size_t column = getStreamOffset() - mDebugLineStartOffset + 1;
+			LOG_ERR("Malformed JSON: " << message << " at line " << mDebugLineNumber << " char " << column << " in " << mDebugName);
+			return false;
+		}
+
+		inline size_t getStreamOffset() const { return mChunkStreamOffset + mChunkPos; }
+
+		//Replace the chunk with the next one from the stream, false when the stream has ended.
+		bool refill() {
+			mChunkStreamOffset += mChunkLength;
+			mStream.read(mChunk.data(), static_cast<std::streamsize>(mChunk.size()));
+			mChunkLength = static_cast<size_t>(mStream.gcount());
+			mChunkPos = 0;
+			return mChunkLength > 0;
+		}
+
+		inline bool hasChar() { return mChunkPos < mChunkLength || refill(); }
+		//Only valid after hasChar() returned true
+		inline char peek() const { return mChunk[mChunkPos]; }
+
+		inline bool handle(const EJsonStreamAction action) {
+			if (action == EJsonStreamAction::STOP) {
+				mStopped = true;
+				return false;
+			}
+			return true;
+		}
+
+		void skipWhitespace() {
+			while (hasChar()) {
+				const char c = mChunk[mChunkPos];
+				if (c == '\n') {
+					mDebugLineNumber++;
+					mDebugLineStartOffset = getStreamOffset() + 1;
+				} else if (c != ' ' && c != '\t' && c != '\r') {
+					return;
+				}
+				mChunkPos++;
+			}
+		}
+
+		bool expectLiteral(const char* literal, const char* message) {
+			for (const char* c = literal; *c != '\0'; c++) {
+				if (!hasChar() || peek() != *c) {
+					return error(message);
+				}
+				mChunkPos++;
+			}
+			return true;
+		}
+
+		bool parseValue(const std::string_view key) {
+			switch (peek()) {
+				case '{':
+					return parseContainer(key, true);
+				case '[':
+					return parseContainer(key, false);
+				case '"': {
+					std::string_view string;
+					mChunkPos++;
+					if (!parseString(mStringBuffer, true, string)) {
+						return false;
+					}
+					return handle(mHandler.onString(key, string));
+				}
+				case 't':
+					return expectLiteral("true", "Expected true") && handle(mHandler.onBool(key, true));
+				case 'f':
+					return expectLiteral("false", "Expected false") && handle(mHandler.onBool(key, false));
+				case 'n':
+					return expectLiteral("null", "Expected null") && handle(mHandler.onNull(key));
+				case '-': case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9':
+					return parseNumber(key);
+				default:
+					return error("Unexpected character");
+			}
+		}
+
+		bool parseContainer(const std::string_view key, const bool isObject) {
+			if (mDepth + 1 > JsonStreamReader::MAX_DEPTH) {
+				return error("Nested too deeply");
+			}
+
+			const EJsonStreamAction startAction = isObject ? mHandler.onObjectStart(key) : mHandler.onArrayStart(key);
+			if (startAction == EJsonStreamAction::SKIP) {
+				return skipContainer();
+			} else if (!handle(startAction)) {
+				return false;
+			}
+
+			mDepth++;
+			mChunkPos++;
+			const char close = isObject ? '}' : ']';
+			skipWhitespace();
+			if (hasChar() && peek() == close) {
+				mChunkPos++;
+			} else {
+				while (true) {
+					if (!hasChar()) {
+						return error(isObject ? "Unterminated object" : "Unterminated array");
+					}
+
+					if (isObject) {
+						if (peek() != '"') {
+							return error("Expected member name");
+						}
+						std::string_view name;
+						mChunkPos++;
+						if (!parseString(mKeyBuffer, false, name)) {
+							return false;
+						}
+
+						skipWhitespace();
+						if (!hasChar() || peek() != ':') {
+							return error("Expected ':' after member name");
+						}
+						mChunkPos++;
+						skipWhitespace();
+						if (!hasChar()) {
+							return error("Expected member value");
+						} else if (!parseValue(name)) {
+							return false;
+						}
+					} else if (!parseValue({})) {
+						return false;
+					}
+
+					skipWhitespace();
+					if (!hasChar()) {
+						return error(isObject ? "Unterminated object" : "Unterminated array");
+					} else if (peek() == ',') {
+						mChunkPos++;
+						skipWhitespace();
+					} else if (peek() == close) {
+						mChunkPos++;
+						break;
+					} else {
+						return error(isObject ? "Expected ',' or '}'" : "Expected ',' or ']'");
+					}
+				}
+			}
+
+			mDepth--;
+			return handle(isObject ? mHandler.onObjectEnd() : mHandler.onArrayEnd());
+		}
+
+		//Skip past the end of the object or array starting at the current char. Brackets are only matched up, the contents aren't validated.
+		bool skipContainer() {
+			uint32_t depth = 0;
+			bool inString = false;
+			while (hasChar()) {
+				const char c = mChunk[mChunkPos];
+				mChunkPos++;
+
+				if (inString) {
+					if (c == '\\') {
+						if (!hasChar()) {
+							break;
+						}
+						mChunkPos++;
+					} else if (c == '"') {
+						inString = false;
+					}
+				} else if (c == '"') {
+					inString = true;
+				} else if (c == '{' || c == '[') {
+					depth++;
+				} else if (c == '}' || c == ']') {
+					if (--depth == 0) {
+						return true;
+					}
+				} else if (c == '\n') {
+					mDebugLineNumber++;
+					mDebugLineStartOffset = getStreamOffset();
+				}
+			}
+
+			return error("Unterminated object or array");
+		}
+
+		//The opening quote has been read. A string found whole in the current chunk without escapes is returned as a view
+		// into the chunk when allowChunkView is set, otherwise it's built in buffer.
+		bool parseString(std::string& buffer, const bool allowChunkView, std::string_view& outString) {
+			buffer.clear();
+			bool buffered = !allowChunkView;
+			while (true) {
+				if (!hasChar()) {
+					return error("Unterminated string");
+				}
+
+				const char* start = mChunk.data() + mChunkPos;
+				const char* end = mChunk.data() + mChunkLength;
+				const char* special = start;
+				while (special < end && *special != '"' && *special != '\\') {
+					special++;
+				}
+
+				if (special == end) {
+					buffer.append(start, end);
+					buffered = true;
+					mChunkPos = mChunkLength;
+				} else if (*special == '"') {
+					mChunkPos += static_cast<size_t>(special - start) + 1;
+					if (buffered) {
+						buffer.append(start, special);
+						outString = buffer;
+					} else {
+						outString = std::string_view(start, static_cast<size_t>(special - start));
+					}
+					return true;
+				} else {
+					buffer.append(start, special);
+					buffered = true;
+					mChunkPos += static_cast<size_t>(special - start) + 1;
+					if (!parseEscape(buffer)) {
+						return false;
+					}
+				}
+			}
+		}
+
+		//The backslash has been read
+		bool parseEscape(std::string& buffer) {
+			if (!hasChar()) {
+				return error("Unterminated string");
+			}
+
+			const char escaped = peek();
+			mChunkPos++;
+			switch (escaped) {
+				case '"': buffer.push_back('"'); return true;
+				case '\\': buffer.push_back('\\'); return true;
+				case '/': buffer.push_back('/'); return true;
+				case 'b': buffer.push_back('\b'); return true;
+				case 'f': buffer.push_back('\f'); return true;
+				case 'n': buffer.push_back('\n'); return true;
+				case 'r': buffer.push_back('\r'); return true;
+				case 't': buffer.push_back('\t'); return true;
+				case 'u': {
+					uint32_t codepoint;
+					if (!parseHex4(codepoint)) {
+						return false;
+					}
+
+					if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+						//Surrogate pair, a high surrogate followed by anything other than a low one is replaced on its own
+						if (hasChar() && peek() == '\\') {
+							mChunkPos++;
+							if (hasChar() && peek() == 'u') {
+								mChunkPos++;
+								uint32_t low;
+								if (!parseHex4(low)) {
+									return false;
+								}
+								const bool isLow = low >= 0xDC00 && low <= 0xDFFF;
+								appendUtf8(buffer, isLow ? 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00) : UTF8_REPLACEMENT_CHARACTER);
+								return true;
+							}
+							appendUtf8(buffer, UTF8_REPLACEMENT_CHARACTER);
+							return parseEscape(buffer);
+						}
+						codepoint = UTF8_REPLACEMENT_CHARACTER;
+					} else if (codepoint >= 0xDC00 && codepoint <= 0xDFFF) {
+						codepoint = UTF8_REPLACEMENT_CHARACTER;
+					}
+					appendUtf8(buffer, codepoint);
+					return true;
+				}
+				default:
+					return error("Invalid escape in string");
+			}
+		}
+
+		bool parseHex4(uint32_t& outValue) {
+			outValue = 0;
+			for (int i = 0; i < 4; i++) {
+				if (!hasChar()) {
+					return error("Truncated \\u escape");
+				}
+
+				const char c = peek();
+				uint32_t digit;
+				if (c >= '0' && c <= '9') {
+					digit = c - '0';
+				} else if (c >= 'a' && c <= 'f') {
+					digit = c - 'a' + 10;
+				} else if (c >= 'A' && c <= 'F') {
+					digit = c - 'A' + 10;
+				} else {
+					return error("Invalid \\u escape");
+				}
+				outValue = (outValue << 4) | digit;
+				mChunkPos++;
+			}
+
+			return true;
+		}
+
+		static void appendUtf8(std::string& buffer, const uint32_t codepoint) {
+			if (codepoint < 0x80) {
+				buffer.push_back(static_cast<char>(codepoint));
+			} else if (codepoint < 0x800) {
+				buffer.push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+				buffer.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+			} else if (codepoint < 0x10000) {
+				buffer.push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+				buffer.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+				buffer.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+			} else {
+				buffer.push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+				buffer.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+				buffer.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+				buffer.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+			}
+		}
+
+		bool parseNumber(const std::string_view key) {
+			//Copied out as a number can be split over chunks
+			mNumberBuffer.clear();
+			bool isInteger = true;
+			while (hasChar()) {
+				const char c = peek();
+				if (c >= '0' && c <= '9') {
+					mNumberBuffer.push_back(c);
+				} else if (c == '.' || c == 'e' || c == 'E' || c == '+' || c == '-') {
+					//'-' is also the sign of the number, it doesn't make an integer a double
+					if (c != '-' || !mNumberBuffer.empty()) {
+						isInteger = false;
+					}
+					mNumberBuffer.push_back(c);
+				} else {
+					break;
+				}
+				mChunkPos++;
+			}
+
+			const char* start = mNumberBuffer.data();
+			const char* end = start + mNumberBuffer.size();
+			if (isInteger) {
+				int64_t value;
+				const std::from_chars_result result = std::from_chars(start, end, value);
+				if (result.ec == std::errc() && result.ptr == end) {
+					return handle(mHandler.onLong(key, value));
+				} else if (result.ec != std::errc::result_out_of_range) {
+					return error("Invalid number");
+				}
+				//Integers too large for int64_t are sent as doubles
+			}
+
+			double value;
+			const std::from_chars_result result = std::from_chars(start, end, value);
+			if (result.ec != std::errc() || result.ptr != end) {
+				return error("Invalid number");
+			}
+			return handle(mHandler.onDouble(key, value));
+		}
+	};
+
+	JsonStreamReader::JsonStreamReader(const char* jsonFilePath, const size_t chunkSize)
+	:	mFilepath(jsonFilePath),
+		mChunkSize(chunkSize),
+		mBytesRead(0)
+	{
+		if (!ResourceHandler::isFileOfType(jsonFilePath, ".json")) {
+			LOG_ERR("Invalid file type for reader (.json): " << jsonFilePath);
+		}
+	}
+
+	EJsonStreamResult JsonStreamReader::read(AJsonStreamHandler& handler) {
+		ZoneScoped;
+
+		mBytesRead = 0;
+		std::ifstream file(mFilepath, std::ios::binary);
+		if (!file.is_open()) {
+			LOG_ERR("Failed to open file: " << mFilepath);
+			return EJsonStreamResult::FAILED;
+		}
+
+		return JsonStreamReader::readStream(file, handler, mFilepath, mChunkSize, &mBytesRead);
+	}
+
+	EJsonStreamResult JsonStreamReader::readStream(
+		std::istream& stream,
+		AJsonStreamHandler& handler,
+		const char* debugName,
+		const size_t chunkSize,
+		size_t* outBytesRead
+	) {
+		ZoneScoped;
+
+		JsonStreamParser parser(stream, handler, debugName, chunkSize);
+		const EJsonStreamResult result = parser.parse();
+		if (outBytesRead != nullptr) {
+			*outBytesRead = parser.getBytesRead();
+		}
+		return result;
+	}
+
+	JsonStreamMemberCollector::JsonStreamMemberCollector(const std::vector<std::string>& wantedNames)
+	:	mWantedNames(wantedNames),
+		mWantedFound(wantedNames.size(), false),
+		mFoundCount(0),
+		mFound(createElementObject()),
+		mDepth(0)
+	{}
+
+	EJsonStreamAction JsonStreamMemberCollector::onObjectStart(const std::string_view key) {
+		return onContainerStart(key, createElementObject());
+	}
+
+	EJsonStreamAction JsonStreamMemberCollector::onObjectEnd() {
+		return onContainerEnd();
+	}
+
+	EJsonStreamAction JsonStreamMemberCollector::onArrayStart(const std::string_view key) {
+		return onContainerStart(key, createElementArray());
+	}
+
+	EJsonStreamAction JsonStreamMemberCollector::onArrayEnd() {
+		return onContainerEnd();
+	}
+
+	EJsonStreamAction JsonStreamMemberCollector::onLong(const std::string_view key, const int64_t value) {
+		return onValue(key, createElementLong(static_cast<long>(value)));
+	}
+
+	EJsonStreamAction JsonStreamMemberCollector::onDouble(const std::string_view key, const double value) {
+		return onValue(key, createElementDouble(value));
+	}
+
+	EJsonStreamAction JsonStreamMemberCollector::onBool(const std::string_view key, const bool value) {
+		return onValue(key, createElementBool(value));
+	}
+
+	EJsonStreamAction JsonStreamMemberCollector::onString(const std::string_view key, const std::string_view value) {
+		return onValue(key, createElementString(std::string(value)));
+	}
+
+	EJsonStreamAction JsonStreamMemberCollector::onNull(const std::string_view key) {
+		return onValue(key, createElementNull());
+	}
+
+	size_t JsonStreamMemberCollector::findWanted(const std::string_view key) const {
+		if (mDepth == 1) {
+			for (size_t i = 0; i < mWantedNames.size(); i++) {
+				if (!mWantedFound[i] && mWantedNames[i] == key) {
+					return i;
+				}
+			}
+		}
+
+		return mWantedNames.size();
+	}
+
+	JsonElement* JsonStreamMemberCollector::addElement(const std::string_view key, JsonElement&& element) {
+		if (!mBuildStack.empty()) {
+			JsonElement& parent = *mBuildStack.back();
+			if (parent.isArray()) {
+				return &parent.getArray().emplace_back(std::move(element));
+			} else {
+				return &parent.getObject().emplace(std::string(key), std::move(element)).first->second;
+			}
+		}
+
+		const size_t wantedIndex = findWanted(key);
+		if (wantedIndex < mWantedNames.size()) {
+			mWantedFound[wantedIndex] = true;
+			mFoundCount++;
+			return &mFound.getObject().emplace(std::string(key), std::move(element)).first->second;
+		}
+
+		return nullptr;
+	}
+
+	EJsonStreamAction JsonStreamMemberCollector::onContainerStart(const std::string_view key, JsonElement&& element) {
+		if (mDepth == 0) {
+			if (!element.isObject()) {
+				LOG_WARN("JsonStreamMemberCollector root isn't an object");
+				return EJsonStreamAction::STOP;
+			}
+			mDepth++;
+			return EJsonStreamAction::CONTINUE;
+		}
+
+		JsonElement* added = addElement(key, std::move(element));
+		if (added == nullptr) {
+			return EJsonStreamAction::SKIP;
+		}
+
+		mBuildStack.emplace_back(added);
+		mDepth++;
+		return EJsonStreamAction::CONTINUE;
+	}
+
+	EJsonStreamAction JsonStreamMemberCollector::onContainerEnd() {
+		mDepth--;
+		if (!mBuildStack.empty()) {
+			mBuildStack.pop_back();
+			if (mBuildStack.empty() && hasFoundAll()) {
+				return EJsonStreamAction::STOP;
+			}
+		}
+
+		return EJsonStreamAction::CONTINUE;
+	}
+
+	EJsonStreamAction JsonStreamMemberCollector::onValue(const std::string_view key, JsonElement&& element) {
+		if (mDepth == 0) {
+			LOG_WARN("JsonStreamMemberCollector root isn't an object");
+			return EJsonStreamAction::STOP;
+		}
+
+		if (addElement(key, std::move(element)) != nullptr && mBuildStack.empty() && hasFoundAll()) {
+			return EJsonStreamAction::STOP;
+		}
+
+		return EJsonStreamAction::CONTINUE;
+	}
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "dough/files/JsonFileData.h"
+
+#include <istream>
+#include <string_view>
+
+namespace DOH {
+
+	enum class EJsonStreamAction {
+		CONTINUE,
+		//From onObjectStart/onArrayStart only, the container's contents are skipped without events and it gets no end event.
+		SKIP,
+		//Stop reading, JsonStreamReader::read returns EJsonStreamResult::STOPPED.
+		STOP
+	};
+
+	enum class EJsonStreamResult {
+		COMPLETED,
+		STOPPED,
+		FAILED
+	};
+
+	/**
+	* Receives JsonStreamReader's events in file order, every event defaults to doing nothing and continuing.
+	* key is the member name when the value is an object member and empty for array elements and the root value.
+	* Views (keys and string values) are only valid during the call, copy what needs keeping.
+	*/
+	class AJsonStreamHandler {
+	public:
+		virtual ~AJsonStreamHandler() = default;
+
+		virtual EJsonStreamAction onObjectStart(const std::string_view /*key*/) { return EJsonStreamAction::CONTINUE; }
+		virtual EJsonStreamAction onObjectEnd() { return EJsonStreamAction::CONTINUE; }
+		virtual EJsonStreamAction onArrayStart(const std::string_view /*key*/) { return EJsonStreamAction::CONTINUE; }
+		virtual EJsonStreamAction onArrayEnd() { return EJsonStreamAction::CONTINUE; }
+		virtual EJsonStreamAction onLong(const std::string_view /*key*/, const int64_t /*value*/) { return EJsonStreamAction::CONTINUE; }
+		virtual EJsonStreamAction onDouble(const std::string_view /*key*/, const double /*value*/) { return EJsonStreamAction::CONTINUE; }
+		virtual EJsonStreamAction onBool(const std::string_view /*key*/, const bool /*value*/) { return EJsonStreamAction::CONTINUE; }
+		virtual EJsonStreamAction onString(const std::string_view /*key*/, const std::string_view /*value*/) { return EJsonStreamAction::CONTINUE; }
+		virtual EJsonStreamAction onNull(const std::string_view /*key*/) { return EJsonStreamAction::CONTINUE; }
+	};
+
+	/**
+	* Collects the named members of the root object as JsonElements and stops reading once all of them have been found.
+	* Other root members are skipped without being parsed into events, so only the wanted members are ever held in memory.
+	*/
+	class JsonStreamMemberCollector : public AJsonStreamHandler {
+	private:
+		std::vector<std::string> mWantedNames;
+		std::vector<bool> mWantedFound;
+		size_t mFoundCount;
+		//Root object of found members, keyed by name
+		JsonElement mFound;
+		//Element being built for the wanted member currently being read and its open containers
+		std::vector<JsonElement*> mBuildStack;
+		uint32_t mDepth;
+
+	public:
+		JsonStreamMemberCollector(const std::vector<std::string>& wantedNames);
+
+		inline JsonElement& getFound() { return mFound; }
+		inline bool hasFoundAll() const { return mFoundCount == mWantedNames.size(); }
+
+		virtual EJsonStreamAction onObjectStart(const std::string_view key) override;
+		virtual EJsonStreamAction onObjectEnd() override;
+		virtual EJsonStreamAction onArrayStart(const std::string_view key) override;
+		virtual EJsonStreamAction onArrayEnd() override;
+		virtual EJsonStreamAction onLong(const std::string_view key, const int64_t value) override;
+		virtual EJsonStreamAction onDouble(const std::string_view key, const double value) override;
+		virtual EJsonStreamAction onBool(const std::string_view key, const bool value) override;
+		virtual EJsonStreamAction onString(const std::string_view key, const std::string_view value) override;
+		virtual EJsonStreamAction onNull(const std::string_view key) override;
+
+	private:
+		//Index of key in mWantedNames if it's a root member that hasn't been found yet, mWantedNames.size() otherwise.
+		size_t findWanted(const std::string_view key) const;
+		//Add element to the member being built, or start a new member if key is wanted at the root. Returns where it was added or nullptr if it isn't wanted.
+		JsonElement* addElement(const std::string_view key, JsonElement&& element);
+		EJsonStreamAction onContainerStart(const std::string_view key, JsonElement&& element);
+		EJsonStreamAction onContainerEnd();
+		EJsonStreamAction onValue(const std::string_view key, JsonElement&& element);
+	};
+
+	/**
+	* Event driven (SAX style) JSON reader that reads a file in fixed size chunks instead of loading it all, for files too large to
+	* hold as a JsonDocument or JsonFileData. Memory use is the chunk plus the longest single string, no matter how large the file is.
+	*
+	* Malformed JSON is logged with its line and column and read() returns EJsonStreamResult::FAILED, events already sent are not undone.
+	*/
+	class JsonStreamReader {
+	public:
+		constexpr static size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+		constexpr static uint32_t MAX_DEPTH = 512;
+
+	private:
+		const char* mFilepath;
+		size_t mChunkSize;
+		size_t mBytesRead;
+
+	public:
+		JsonStreamReader(const char* jsonFilePath, const size_t chunkSize = JsonStreamReader::DEFAULT_CHUNK_SIZE);
+		JsonStreamReader(const JsonStreamReader& copy) = delete;
+		JsonStreamReader operator=(const JsonStreamReader& assignment) = delete;
+
+		EJsonStreamResult read(AJsonStreamHandler& handler);
+		//Bytes read from the file by the last read(), less than the file size if the handler stopped early.
+		inline size_t getBytesRead() const { return mBytesRead; }
+
+		/**
+		* Read JSON from any stream, e.g. a std::istringstream.
+		*
+		* @param debugName Name used when logging errors.
+		* @param outBytesRead Optional, set to the bytes read from stream.
+		*/
+		static EJsonStreamResult readStream(
+			std::istream& stream,
+			AJsonStreamHandler& handler,
+			const char* debugName = "",
+			const size_t chunkSize = JsonStreamReader::DEFAULT_CHUNK_SIZE,
+			size_t* outBytesRead = nullptr
+		);
+	};
+}
@@ -0,0 +1,354 @@
+#include "dough/files/writers/JsonStreamWriter.h"
+
+#include <tracy/public/tracy/Tracy.hpp>
+
+#include <charconv>
+#include <cmath>
+
+namespace DOH {
+
+	//Longest int64_t or shortest round trip double, plus the ".0" added to whole doubles
+	static constexpr size_t MAX_NUMBER_CHARS = 32;
+
+	JsonStreamWriter::JsonStreamWriter(const char* filePath, const size_t bufferSize)
+	:	mFilePath(filePath),
+		mFile(filePath, std::ios::binary | std::ios::trunc),
+		mBuffer(std::max(bufferSize, MAX_NUMBER_CHARS)),
+		mBufferUsed(0),
+		mBytesWritten(0),
+		mHasValue(false),
+		mFailed(false)
+	{
+		if (!mFile.is_open()) {
+			fail("failed to open output file");
+		}
+	}
+
+	JsonStreamWriter::~JsonStreamWriter() {
+		if (mFile.is_open()) {
+			close();
+		}
+	}
+
+	void JsonStreamWriter::beginObject() {
+		if (beginValue(false, {})) {
+			append('{');
+			mContainerStack.emplace_back(true);
+			mHasValue = false;
+		}
+	}
+
+	void JsonStreamWriter::beginObject(const std::string_view key) {
+		if (beginValue(true, key)) {
+			append('{');
+			mContainerStack.emplace_back(true);
+			mHasValue = false;
+		}
+	}
+
+	void JsonStreamWriter::endObject() {
+		if (mFailed) {
+			return;
+		} else if (mContainerStack.empty() || !mContainerStack.back()) {
+			fail("endObject called without a matching beginObject");
+			return;
+		}
+
+		mContainerStack.pop_back();
+		append('}');
+		mHasValue = true;
+	}
+
+	void JsonStreamWriter::beginArray() {
+		if (beginValue(false, {})) {
+			append('[');
+			mContainerStack.emplace_back(false);
+			mHasValue = false;
+		}
+	}
+
+	void JsonStreamWriter::beginArray(const std::string_view key) {
+		if (beginValue(true, key)) {
+			append('[');
+			mContainerStack.emplace_back(false);
+			mHasValue = false;
+		}
+	}
+
+	void JsonStreamWriter::endArray() {
+		if (mFailed) {
+			return;
+		} else if (mContainerStack.empty() || mContainerStack.back()) {
+			fail("endArray called without a matching beginArray");
+			return;
+		}
+
+		mContainerStack.pop_back();
+		append(']');
+		mHasValue = true;
+	}
+
+	void JsonStreamWriter::writeLong(const int64_t value) {
+		if (beginValue(false, {})) {
+			appendLong(value);
+		}
+	}
+
+	void JsonStreamWriter::writeLong(const std::string_view key, const int64_t value) {
+		if (beginValue(true, key)) {
+			appendLong(value);
+		}
+	}
+
+	void JsonStreamWriter::writeDouble(const double value) {
+		if (beginValue(false, {})) {
+			appendDouble(value);
+		}
+	}
+
+	void JsonStreamWriter::writeDouble(const std::string_view key, const double value) {
+		if (beginValue(true, key)) {
+			appendDouble(value);
+		}
+	}
+
+	void JsonStreamWriter::writeBool(const bool value) {
+		if (beginValue(false, {})) {
+			value ? append("true", 4) : append("false", 5);
+		}
+	}
+
+	void JsonStreamWriter::writeBool(const std::string_view key, const bool value) {
+		if (beginValue(true, key)) {
+			value ? append("true", 4) : append("false", 5);
+		}
+	}
+
+	void JsonStreamWriter::writeString(const std::string_view value) {
+		if (beginValue(false, {})) {
+			writeEscapedString(value);
+		}
+	}
+
+	void JsonStreamWriter::writeString(const std::string_view key, const std::string_view value) {
+		if (beginValue(true, key)) {
+			writeEscapedString(value);
+		}
+	}
+
+	void JsonStreamWriter::writeNull() {
+		if (beginValue(false, {})) {
+			append("null", 4);
+		}
+	}
+
+	void JsonStreamWriter::writeNull(const std::string_view key) {
+		if (beginValue(true, key)) {
+			append("null", 4);
+		}
+	}
+
+	void JsonStreamWriter::writeElement(const JsonElement& element) {
+		if (beginValue(false, {})) {
+			writeElementValue(element);
+		}
+	}
+
+	void JsonStreamWriter::writeElement(const std::string_view key, const JsonElement& element) {
+		if (beginValue(true, key)) {
+			writeElementValue(element);
+		}
+	}
+
+	bool JsonStreamWriter::close() {
+		ZoneScoped;
+
+		if (!mFile.is_open()) {
+			return !mFailed;
+		}
+
+		if (!mFailed && !mContainerStack.empty()) {
+			fail("closed with objects or arrays left open");
+		}
+
+		if (!mFailed) {
+			if (mHasValue) {
+				append('\n');
+			}
+			flush();
+		}
+
+		mFile.close();
+		return !mFailed;
+	}
+
+	bool JsonStreamWriter::beginValue(const bool hasKey, const std::string_view key) {
+		if (mFailed) {
+			return false;
+		}
+
+		const bool inObject = !mContainerStack.empty() && mContainerStack.back();
+		if (hasKey != inObject) {
+			fail(inObject ? "value in an object written without a key" : "key given for a value that isn't in an object");
+			return false;
+		} else if (mContainerStack.empty() && mHasValue) {
+			fail("more than one root value written");
+			return false;
+		} else if (mContainerStack.size() >= JsonStreamWriter::MAX_DEPTH) {
+			fail("nested too deeply");
+			return false;
+		}
+
+		if (mHasValue) {
+			append(',');
+		}
+		if (hasKey) {
+			writeEscapedString(key);
+			append(':');
+		}
+		mHasValue = true;
+		return true;
+	}
+
+	void JsonStreamWriter::writeElementValue(const JsonElement& element) {
+		switch (element.Type) {
+			case EJsonElementType::DATA_LONG:
+				appendLong(std::get<long>(element.Element));
+				break;
+			case EJsonElementType::DATA_DOUBLE:
+				appendDouble(std::get<double>(element.Element));
+				break;
+			case EJsonElementType::DATA_BOOL:
+				std::get<bool>(element.Element) ? append("true", 4) : append("false", 5);
+				break;
+			case EJsonElementType::DATA_STRING:
+				writeEscapedString(std::get<std::string>(element.Element));
+				break;
+			case EJsonElementType::OBJECT: {
+				append('{');
+				bool first = true;
+				for (const auto& [name, member] : std::get<std::unordered_map<std::string, JsonElement>>(element.Element)) {
+					if (!first) {
+						append(',');
+					}
+					first = false;
+					writeEscapedString(name);
+					append(':');
+					writeElementValue(member);
+				}
+				append('}');
+				break;
+			}
+			case EJsonElementType::ARRAY: {
+				append('[');
+				bool first = true;
+				for (const JsonElement& child : std::get<std::vector<JsonElement>>(element.Element)) {
+					if (!first) {
+						append(',');
+					}
+					first = false;
+					writeElementValue(child);
+				}
+				append(']');
+				break;
+			}
+
+			case EJsonElementType::NONE:
+			default:
+				append("null", 4);
+				break;
+		}
+	}
+
+	void JsonStreamWriter::writeEscapedString(const std::string_view string) {
+		append('"');
+
+		//Runs of chars that don't need escaping are appended in one go
+		const char* run = string.data();
+		const char* end = run + string.size();
+		for (const char* c = run; c < end; c++) {
+			const unsigned char uc = static_cast<unsigned char>(*c);
+			if (uc >= 0x20 && uc != '"' && uc != '\\') {
+				continue;
+			}
+
+			append(run, static_cast<size_t>(c - run));
+			run = c + 1;
+			switch (uc) {
+				case '"': append("\\\"", 2); break;
+				case '\\': append("\\\\", 2); break;
+				case '\n': append("\\n", 2); break;
+				case '\r': append("\\r", 2); break;
+				case '\t': append("\\t", 2); break;
+				case '\b': append("\\b", 2); break;
+				case '\f': append("\\f", 2); break;
+				default: {
+					constexpr const char* HEX_DIGITS = "0123456789abcdef";
+					const char escaped[6] = { '\\', 'u', '0', '0', HEX_DIGITS[uc >> 4], HEX_DIGITS[uc & 0xF] };
+					append(escaped, sizeof(escaped));
+					break;
+				}
+			}
+		}
+		append(run, static_cast<size_t>(end - run));
+
+		append('"');
+	}
+
+	void JsonStreamWriter::appendLong(const int64_t value) {
+		if (mBuffer.size() - mBufferUsed < MAX_NUMBER_CHARS) {
+			flush();
+		}
+
+		char* begin = mBuffer.data() + mBufferUsed;
+		const std::to_chars_result result = std::to_chars(begin, begin + MAX_NUMBER_CHARS, value);
+		mBufferUsed += static_cast<size_t>(result.ptr - begin);
+	}
+
+	void JsonStreamWriter::appendDouble(const double value) {
+		if (!std::isfinite(value)) {
+			append("null", 4);
+			return;
+		}
+
+		if (mBuffer.size() - mBufferUsed < MAX_NUMBER_CHARS) {
+			flush();
+		}
+
+		char* begin = mBuffer.data() + mBufferUsed;
+		//Shortest representation that reads back as exactly value
+		std::to_chars_result result = std::to_chars(begin, begin + MAX_NUMBER_CHARS - 2, value);
+		bool isWhole = true;
+		for (const char* c = begin; c < result.ptr; c++) {
+			if (*c == '.' || *c == 'e') {
+				isWhole = false;
+				break;
+			}
+		}
+		if (isWhole) {
+			*result.ptr++ = '.';
+			*result.ptr++ = '0';
+		}
+		mBufferUsed += static_cast<size_t>(result.ptr - begin);
+	}
+
+	void JsonStreamWriter::flush() {
+		if (mBufferUsed == 0 || !mFile.is_open()) {
+			return;
+		}
+
+		mFile.write(mBuffer.data(), static_cast<std::streamsize>(mBufferUsed));
+		mBytesWritten += mBufferUsed;
+		mBufferUsed = 0;
+		if (!mFile.good()) {
+			fail("failed writing to output file");
+		}
+	}
+
+	void JsonStreamWriter::fail(const char* message) {
+		if (!mFailed) {
+			LOG_ERR("JsonStreamWriter " << message << ": " << mFilePath);
+			mFailed = true;
+		}
+	}
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "dough/files/JsonFileData.h"
+
+#include <cstring>
+#include <fstream>
+#include <string_view>
+
+namespace DOH {
+
+	/**
+	* Writes compact JSON straight to a file through a reusable buffer, either value by value without building a JsonElement
+	* tree or from an existing JsonElement tree with writeElement. The buffer is written to the file whenever it fills.
+	*
+	* Values inside an object must be given a key and values inside an array (or the root value) must not, a value written in
+	* the wrong place logs an error and fails the writer. Once failed nothing else is written and close() returns false.
+	*
+	* Doubles are written with the shortest representation that reads back to the same value, always with a '.' or exponent
+	* so they read back as doubles. NaN and infinity aren't valid JSON so are written as null.
+	*/
+	class JsonStreamWriter {
+	public:
+		constexpr static size_t DEFAULT_BUFFER_SIZE = 64 * 1024;
+		constexpr static uint32_t MAX_DEPTH = 512;
+
+	private:
+		const char* mFilePath;
+		std::ofstream mFile;
+		std::vector<char> mBuffer;
+		size_t mBufferUsed;
+		size_t mBytesWritten;
+		//Open containers, true for objects
+		std::vector<bool> mContainerStack;
+		//Whether the innermost open container (or the root) has had a value written yet, for deciding when to write ','
+		bool mHasValue;
+		bool mFailed;
+
+	public:
+		JsonStreamWriter(const char* filePath, const size_t bufferSize = JsonStreamWriter::DEFAULT_BUFFER_SIZE);
+		JsonStreamWriter(const JsonStreamWriter& copy) = delete;
+		JsonStreamWriter operator=(const JsonStreamWriter& assignment) = delete;
+		~JsonStreamWriter();
+
+		void beginObject();
+		void beginObject(const std::string_view key);
+		void endObject();
+		void beginArray();
+		void beginArray(const std::string_view key);
+		void endArray();
+
+		void writeLong(const int64_t value);
+		void writeLong(const std::string_view key, const int64_t value);
+		void writeDouble(const double value);
+		void writeDouble(const std::string_view key, const double value);
+		void writeBool(const bool value);
+		void writeBool(const std::string_view key, const bool value);
+		void writeString(const std::string_view value);
+		void writeString(const std::string_view key, const std::string_view value);
+		void writeNull();
+		void writeNull(const std::string_view key);
+
+		//Write element and its children, iterated by reference so nothing is copied.
+		void writeElement(const JsonElement& element);
+		void writeElement(const std::string_view key, const JsonElement& element);
+
+		/**
+		* Write what's left in the buffer, ending with a new line, and close the file. Called by the destructor if not called before.
+		* Logs and returns false if anything failed or a container was left open.
+		*/
+		bool close();
+
+		inline bool isOpen() const { return mFile.is_open(); }
+		inline bool hasFailed() const { return mFailed; }
+		inline size_t getBytesWritten() const { return mBytesWritten + mBufferUsed; }
+		inline const char* getFilePath() const { return mFilePath; }
+
+	private:
+		bool beginValue(const bool hasKey, const std::string_view key);
+		void writeElementValue(const JsonElement& element);
+		void writeEscapedString(const std::string_view string);
+		void appendLong(const int64_t value);
+		void appendDouble(const double value);
+		void flush();
+		void fail(const char* message);
+
+		inline void append(const char c) {
+			if (mBufferUsed == mBuffer.size()) {
+				flush();
+			}
+			mBuffer[mBufferUsed++] = c;
+		}
+
+		inline void append(const char* chars, const size_t length) {
+			if (length > mBuffer.size() - mBufferUsed) {
+				flush();
+				//Larger than the whole buffer, written straight to the file
+				if (length > mBuffer.size()) {
+					mFile.write(chars, static_cast<std::streamsize>(length));
+					mBytesWritten += length;
+					return;
+				}
+			}
+			memcpy(mBuffer.data() + mBufferUsed, chars, length);
+			mBufferUsed += length;
+		}
+	};
+}
@@ -3,7 +3,7 @@
 #include "dough/files/ResourceHandler.h"
 #include "dough/Logging.h"
 #include "dough/input/AInputLayer.h"
-#include "dough/files/JsonFileData.h"
+#include "dough/files/JsonDocument.h"
 #include "dough/input/InputCodes.h"
 
 namespace DOH {
@@ -20,48 +20,44 @@ namespace DOH {
 	
 	void InputActionMap::addActionsFromFile(const char* filePath) {
 		if (ResourceHandler::isFileOfType(filePath, ".json")) {
-			std::shared_ptr<JsonFileData> fileData = ResourceHandler::loadJsonFile(filePath);
+			std::shared_ptr<JsonDocument> fileData = ResourceHandler::loadJsonDocument(filePath);
 			if (fileData == nullptr) {
 				LOG_WARN("InputActionMap::loadActionsFromFile failed to load json data: " << filePath);
+				return;
 			}
 
-			std::unordered_map<std::string, JsonElement>& root = fileData->getRoot().getObject();
-			for (std::pair<std::string, JsonElement> actionEntry : root) {
-				std::unordered_map<std::string, JsonElement>& actionData = actionEntry.second.getObject();
+			for (const JsonValue actionData : fileData->getRoot().getObject()) {
+				const std::string_view actionName = actionData.getKey();
 				InputAction action = {};
 				uint32_t stepIndex = 0;
 				//If no actions (for any device type) have been found.
 				bool emptyAction = true;
-				const auto& kbmEntry = actionData.find(InputAction::JSON_KEYBOARD_AND_MOUSE_STRING);
-				if (kbmEntry != actionData.end()) {
-					std::vector<JsonElement>& steps = kbmEntry->second.getArray();
-
-					for (JsonElement& stepJsonElement : steps) {
-						std::unordered_map<std::string, JsonElement>& step = stepJsonElement.getObject();
-						JsonElement& typeElement = step.at(InputAction::JSON_ACTION_TYPE_STRING);
+				const std::optional<JsonValue> kbmEntry = actionData.getElement(InputAction::JSON_KEYBOARD_AND_MOUSE_STRING);
+				if (kbmEntry.has_value()) {
+					for (const JsonValue step : kbmEntry->getArray()) {
+						const JsonValue typeElement = step[InputAction::JSON_ACTION_TYPE_STRING];
 						EDeviceInputType type = EDeviceInputType::NONE;
 
 						if (typeElement.isString()) {
-							const std::string& typeString = typeElement.getString();
-							type = InputAction::getEDeviceInputTypeFromString(typeString.c_str());
+							type = InputAction::getEDeviceInputTypeFromString(typeElement.getCString());
 						} else if (typeElement.isLong()) {
 							type = static_cast<EDeviceInputType>(typeElement.getLong());
 						} else {
 							LOG_ERR(
 								"InputActionMap::addActionsFromFile action type represented by unsupported type. " << filePath <<
-								"\t action: " << actionEntry.first << " t: " << typeElement.Element.index()
+								"\t action: " << actionName << " t: " << EJsonElementTypeStrings[static_cast<uint32_t>(typeElement.getType())]
 							);
 							continue;
 						}
 
-						JsonElement& valueElement = step.at(InputAction::JSON_ACTION_VALUE_STRING);
+						const JsonValue valueElement = step[InputAction::JSON_ACTION_VALUE_STRING];
 						int value = -1;
 						if (valueElement.isLong()) {
 							value = static_cast<int>(valueElement.getLong());
 						} else {
 							LOG_ERR(
 								"InputActionMap::addActionsFromFile action value represented by unsupported type. " << filePath <<
-								"\t action: " << actionEntry.first << " v: " << valueElement.Element.index()
+								"\t action: " << actionName << " v: " << EJsonElementTypeStrings[static_cast<uint32_t>(valueElement.getType())]
 							);
 							continue;
 						}
@@ -71,13 +67,12 @@ namespace DOH {
 					}
 
 					if (stepIndex > 0) {
-						mActions.emplace(actionEntry.first.c_str(), action);
+						mActions.emplace(std::string(actionName), action);
 						emptyAction = false;
 					}
 				}
 
-				const auto& conEntry = actionData.find(InputAction::JSON_CONTROLLER_STRING);
-				if (conEntry != actionData.end()) {
+				if (actionData.getElement(InputAction::JSON_CONTROLLER_STRING).has_value()) {
 					//TODO:: Controller support.
 
 					//TEMP:: Prevent multiple warnings from same file.
@@ -89,7 +84,7 @@ namespace DOH {
 				}
 
 				if (emptyAction) {
-					LOG_WARN("No inputs found for action: " << actionEntry.first << " - " << filePath);
+					LOG_WARN("No inputs found for action: " << actionName << " - " << filePath);
 				}
 			}
 	
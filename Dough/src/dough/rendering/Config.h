@@ -58,7 +58,7 @@ namespace DOH {
 	// Vulkan doesn't require input data to be specifically named so any spare unused data in vertex can be used as padding/saved for any changes later.
 	// VERTEX_2D/3D standard, then anything with _TEXTURED_ includes tex coords and texArr index, assumes texture arrays are used all throughout
 
-	constexpr static std::array<const char*, 9> EVertexTypeStrings = {
+	constexpr static std::array<const char*, 10> EVertexTypeStrings = {
 		"NONE",
 
 		"VERTEX_2D",
@@ -69,7 +69,8 @@ namespace DOH {
 		"VERTEX_3D_TEXTURED_INDEXED",
 		"VERTEX_3D_LIT_TEXTURED",
 
-		"VERTEX_CIRCLE_3D"
+		"VERTEX_CIRCLE_3D",
+		"VERTEX_QUAD_INSTANCE_3D"
 	};
 
 	enum class EVertexType {
@@ -141,9 +142,20 @@ namespace DOH {
 		*	y Fade IMPORTANT:: Fade value MUST be non-zero. There is a max(Fade, 0.0001) in the shader.
 		* 1 float TexIndex
 		*/
-		VERTEX_CIRCLE_3D
+		VERTEX_CIRCLE_3D,
 
 		//TODO:: VERTEX_CIRCLE_3D_DECORATED ? and turn VERTEX_CIRCLE_3D into VERTEX_CIRCLE_3D_SIMPLE
+
+		/**
+		* Per-instance input, one per quad. Corners are generated in the vertex shader from gl_VertexIndex.
+		* vec3 float Pos
+		* vec2 float Size
+		* 1 float Rotation (radians)
+		* vec4 float Colour
+		* vec4 float TexCoords (botLeft.x, botLeft.y, topRight.x, topRight.y)
+		* 1 float TexIndex
+		*/
+		VERTEX_QUAD_INSTANCE_3D
 	};
 
 	struct Vertex2d {
@@ -336,6 +348,40 @@ namespace DOH {
 		}
 	};
 
+	//Expected input for instanced Quad batch rendering, bound with VK_VERTEX_INPUT_RATE_INSTANCE
+	struct VertexQuadInstance3d {
+		glm::vec3 Pos;
+		glm::vec2 Size;
+		float Rotation;
+		glm::vec4 Colour;
+		glm::vec4 TexCoords;
+		float TexIndex;
+
+		constexpr static const uint32_t COMPONENT_COUNT = 15;
+		constexpr static const uint32_t BYTE_SIZE = COMPONENT_COUNT * DataType::getDataTypeSize(EDataType::FLOAT);
+		constexpr static const EVertexType ENUM = EVertexType::VERTEX_QUAD_INSTANCE_3D;
+
+		static std::vector<VkVertexInputAttributeDescription> asAttributeDescriptions(uint32_t binding) {
+			return {
+				{ 0, binding, VK_FORMAT_R32G32B32_SFLOAT	, offsetof(VertexQuadInstance3d, Pos) },
+				{ 1, binding, VK_FORMAT_R32G32_SFLOAT		, offsetof(VertexQuadInstance3d, Size) },
+				{ 2, binding, VK_FORMAT_R32_SFLOAT			, offsetof(VertexQuadInstance3d, Rotation) },
+				{ 3, binding, VK_FORMAT_R32G32B32A32_SFLOAT	, offsetof(VertexQuadInstance3d, Colour) },
+				{ 4, binding, VK_FORMAT_R32G32B32A32_SFLOAT	, offsetof(VertexQuadInstance3d, TexCoords) },
+				{ 5, binding, VK_FORMAT_R32_SFLOAT			, offsetof(VertexQuadInstance3d, TexIndex) }
+			};
+		}
+
+		bool operator==(const VertexQuadInstance3d& other) const {
+			return Pos == other.Pos &&
+				Size == other.Size &&
+				Rotation == other.Rotation &&
+				Colour == other.Colour &&
+				TexCoords == other.TexCoords &&
+				TexIndex == other.TexIndex;
+		}
+	};
+
 	static std::vector<VkVertexInputAttributeDescription> getVertexTypeAsAttribDesc(
 		const EVertexType vertexType,
 		const uint32_t binding
@@ -357,6 +403,8 @@ namespace DOH {
 				return Vertex3dLitTextured::asAttributeDescriptions(binding);
 			case EVertexType::VERTEX_CIRCLE_3D:
 				return VertexCircle3d::asAttributeDescriptions(binding);
+			case EVertexType::VERTEX_QUAD_INSTANCE_3D:
+				return VertexQuadInstance3d::asAttributeDescriptions(binding);
 			default:
 				return {};
 		}
@@ -380,6 +428,8 @@ namespace DOH {
 				return Vertex3dLitTextured::COMPONENT_COUNT;
 			case EVertexType::VERTEX_CIRCLE_3D:
 				return VertexCircle3d::COMPONENT_COUNT;
+			case EVertexType::VERTEX_QUAD_INSTANCE_3D:
+				return VertexQuadInstance3d::COMPONENT_COUNT;
 			default:
 				return 0;
 		}
@@ -403,6 +453,8 @@ namespace DOH {
 				return sizeof(Vertex3dLitTextured);
 			case EVertexType::VERTEX_CIRCLE_3D:
 				return sizeof(VertexCircle3d);
+			case EVertexType::VERTEX_QUAD_INSTANCE_3D:
+				return sizeof(VertexQuadInstance3d);
 			default:
 				return 0;
 		}
@@ -0,0 +1,288 @@
+#include "dough/rendering/DeviceMemoryAllocatorVulkan.h"
+
+#include "dough/Utils.h"
+
+#include <tracy/public/tracy/Tracy.hpp>
+
+#include <algorithm>
+
+namespace DOH {
+
+	DeviceMemoryAllocatorVulkan::DeviceMemoryAllocatorVulkan(VkDevice logicDevice, VkPhysicalDevice physicalDevice)
+	:	mLogicDevice(logicDevice),
+		mPhysicalDevice(physicalDevice),
+		mMemoryProperties({}),
+		mMaxMemoryAllocationCount(0),
+		mDeviceAllocationCount(0)
+	{}
+
+	void DeviceMemoryAllocatorVulkan::init() {
+		ZoneScoped;
+
+		vkGetPhysicalDeviceMemoryProperties(mPhysicalDevice, &mMemoryProperties);
+
+		VkPhysicalDeviceProperties deviceProperties = {};
+		vkGetPhysicalDeviceProperties(mPhysicalDevice, &deviceProperties);
+		mMaxMemoryAllocationCount = deviceProperties.limits.maxMemoryAllocationCount;
+
+		//NOTE:: Slots are at least MIN_SIZE_CLASS_BYTE_SIZE apart, this is assumed to be enough for nonCoherentAtomSize.
+		if (deviceProperties.limits.nonCoherentAtomSize > MIN_SIZE_CLASS_BYTE_SIZE) {
+			LOG_WARN("Device nonCoherentAtomSize is larger than the smallest memory size class: " << deviceProperties.limits.nonCoherentAtomSize);
+		}
+
+		mPools.resize(static_cast<size_t>(mMemoryProperties.memoryTypeCount) * 2 * SIZE_CLASS_COUNT);
+		mMemoryTypeStats.resize(mMemoryProperties.memoryTypeCount);
+	}
+
+	void DeviceMemoryAllocatorVulkan::close() {
+		ZoneScoped;
+
+		for (auto& pool : mPools) {
+			for (auto& block : pool) {
+				if (block->getUsedSlotCount() > 0) {
+					LOG_WARN("Device memory block closed with " << block->getUsedSlotCount() << " allocations still in use");
+				}
+				freeDeviceMemory(block->Memory);
+			}
+			pool.clear();
+		}
+
+		for (uint32_t i = 0; i < mMemoryTypeStats.size(); i++) {
+			if (mMemoryTypeStats[i].DedicatedAllocationCount > 0) {
+				LOG_WARN(
+					"Device memory type " << i << " has " << mMemoryTypeStats[i].DedicatedAllocationCount <<
+					" dedicated allocations not freed before allocator close"
+				);
+			}
+			mMemoryTypeStats[i] = {};
+		}
+	}
+
+	DeviceMemoryAllocation DeviceMemoryAllocatorVulkan::allocate(
+		const VkMemoryRequirements& memRequirements,
+		VkMemoryPropertyFlags props,
+		bool linear
+	) {
+		ZoneScoped;
+
+		DeviceMemoryAllocation allocation = {};
+		allocation.MemoryTypeIndex = findMemoryTypeIndex(memRequirements.memoryTypeBits, props);
+		allocation.Size = memRequirements.size;
+
+		DeviceMemoryTypeStats& stats = mMemoryTypeStats[allocation.MemoryTypeIndex];
+
+		//Block slots are offset by multiples of their size class so a size class of at least the alignment is always aligned.
+		const VkDeviceSize slotByteSize = std::max(memRequirements.size, memRequirements.alignment);
+		if (slotByteSize > MAX_SIZE_CLASS_BYTE_SIZE) {
+			allocation.Memory = allocateDeviceMemory(allocation.MemoryTypeIndex, memRequirements.size, &allocation.MappedData);
+			allocation.Offset = 0;
+
+			stats.DedicatedAllocationCount++;
+			stats.DedicatedBytes += memRequirements.size;
+			return allocation;
+		}
+
+		const uint32_t sizeClassIndex = getSizeClassIndex(slotByteSize);
+		const uint32_t poolIndex = getPoolIndex(allocation.MemoryTypeIndex, linear, sizeClassIndex);
+		auto& pool = mPools[poolIndex];
+
+		DeviceMemoryBlock* block = nullptr;
+		for (auto& poolBlock : pool) {
+			if (!poolBlock->FreeSlots.empty()) {
+				block = poolBlock.get();
+				break;
+			}
+		}
+		if (block == nullptr) {
+			block = &createBlock(poolIndex, allocation.MemoryTypeIndex, getSizeClassByteSize(sizeClassIndex));
+		}
+
+		const uint32_t slot = block->FreeSlots.back();
+		block->FreeSlots.pop_back();
+		block->UsedBytes += memRequirements.size;
+
+		allocation.Memory = block->Memory;
+		allocation.Offset = slot * block->SlotByteSize;
+		allocation.MappedData = block->MappedData != nullptr ? block->MappedData + allocation.Offset : nullptr;
+		allocation.Block = block;
+		allocation.Slot = slot;
+
+		stats.BlockAllocationCount++;
+		stats.UsedBytes += memRequirements.size;
+		stats.SlotBytes += block->SlotByteSize;
+
+		return allocation;
+	}
+
+	DeviceMemoryAllocation DeviceMemoryAllocatorVulkan::allocateBufferMemory(VkBuffer buffer, VkMemoryPropertyFlags props) {
+		ZoneScoped;
+
+		VkMemoryRequirements memRequirements;
+		vkGetBufferMemoryRequirements(mLogicDevice, buffer, &memRequirements);
+
+		DeviceMemoryAllocation allocation = allocate(memRequirements, props, true);
+
+		VK_TRY(
+			vkBindBufferMemory(mLogicDevice, buffer, allocation.Memory, allocation.Offset),
+			"Failed to bind buffer memory."
+		);
+
+		return allocation;
+	}
+
+	DeviceMemoryAllocation DeviceMemoryAllocatorVulkan::allocateImageMemory(VkImage image, VkMemoryPropertyFlags props) {
+		ZoneScoped;
+
+		VkMemoryRequirements memRequirements;
+		vkGetImageMemoryRequirements(mLogicDevice, image, &memRequirements);
+
+		DeviceMemoryAllocation allocation = allocate(memRequirements, props, false);
+
+		VK_TRY(
+			vkBindImageMemory(mLogicDevice, image, allocation.Memory, allocation.Offset),
+			"Failed to bind image memory"
+		);
+
+		return allocation;
+	}
+
+	void DeviceMemoryAllocatorVulkan::free(DeviceMemoryAllocation& allocation) {
+		ZoneScoped;
+
+		if (!allocation.isValid()) {
+			return;
+		}
+
+		DeviceMemoryTypeStats& stats = mMemoryTypeStats[allocation.MemoryTypeIndex];
+
+		if (allocation.isDedicated()) {
+			freeDeviceMemory(allocation.Memory);
+
+			stats.DedicatedAllocationCount--;
+			stats.DedicatedBytes -= allocation.Size;
+		} else {
+			DeviceMemoryBlock& block = *allocation.Block;
+			block.FreeSlots.push_back(allocation.Slot);
+			block.UsedBytes -= allocation.Size;
+
+			stats.BlockAllocationCount--;
+			stats.UsedBytes -= allocation.Size;
+			stats.SlotBytes -= block.SlotByteSize;
+
+			//Keep the last block of a pool around, even when empty, so a pool that is repeatedly emptied and filled doesn't thrash
+			if (block.getUsedSlotCount() == 0 && mPools[block.PoolIndex].size() > 1) {
+				freeBlock(block.PoolIndex, block);
+			}
+		}
+
+		allocation = {};
+	}
+
+	uint32_t DeviceMemoryAllocatorVulkan::findMemoryTypeIndex(uint32_t typeFilter, VkMemoryPropertyFlags props) const {
+		for (uint32_t i = 0; i < mMemoryProperties.memoryTypeCount; i++) {
+			if ((typeFilter & (1 << i)) && (mMemoryProperties.memoryTypes[i].propertyFlags & props) == props) {
+				return i;
+			}
+		}
+
+		THROW("Failed to find suitable memory type.");
+
+		return 0;
+	}
+
+	VkDeviceMemory DeviceMemoryAllocatorVulkan::allocateDeviceMemory(const uint32_t memoryTypeIndex, const VkDeviceSize size, void** mappedData) {
+		ZoneScoped;
+
+		if (mDeviceAllocationCount >= mMaxMemoryAllocationCount) {
+			LOG_WARN("Device memory allocation count has reached maxMemoryAllocationCount: " << mMaxMemoryAllocationCount);
+		}
+
+		VkMemoryAllocateInfo allocation = {};
+		allocation.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		allocation.allocationSize = size;
+		allocation.memoryTypeIndex = memoryTypeIndex;
+
+		VkDeviceMemory memory = VK_NULL_HANDLE;
+		VK_TRY(
+			vkAllocateMemory(mLogicDevice, &allocation, nullptr, &memory),
+			"Failed to allocate device memory."
+		);
+		mDeviceAllocationCount++;
+
+		*mappedData = nullptr;
+		if ((getMemoryTypeFlags(memoryTypeIndex) & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0) {
+			VK_TRY(
+				vkMapMemory(mLogicDevice, memory, 0, VK_WHOLE_SIZE, 0, mappedData),
+				"Failed to map device memory."
+			);
+		}
+
+		return memory;
+	}
+
+	void DeviceMemoryAllocatorVulkan::freeDeviceMemory(VkDeviceMemory memory) {
+		//NOTE:: Freeing memory implicitly unmaps it.
+		vkFreeMemory(mLogicDevice, memory, nullptr);
+		mDeviceAllocationCount--;
+	}
+
+	DeviceMemoryBlock& DeviceMemoryAllocatorVulkan::createBlock(
+		const uint32_t poolIndex,
+		const uint32_t memoryTypeIndex,
+		const VkDeviceSize slotByteSize
+	) {
+		ZoneScoped;
+
+		std::unique_ptr<DeviceMemoryBlock> block = std::make_unique<DeviceMemoryBlock>();
+		//Size classes and block sizes are powers of two so the block always divides into whole slots
+		block->ByteSize = std::clamp(slotByteSize * MIN_BLOCK_SLOT_COUNT, MIN_BLOCK_BYTE_SIZE, MAX_BLOCK_BYTE_SIZE);
+		block->SlotByteSize = slotByteSize;
+		block->SlotCount = static_cast<uint32_t>(block->ByteSize / slotByteSize);
+		block->PoolIndex = poolIndex;
+
+		void* mappedData = nullptr;
+		block->Memory = allocateDeviceMemory(memoryTypeIndex, block->ByteSize, &mappedData);
+		block->MappedData = static_cast<char*>(mappedData);
+
+		//Reversed so slots are handed out from the start of the block first
+		block->FreeSlots.resize(block->SlotCount);
+		for (uint32_t i = 0; i < block->SlotCount; i++) {
+			block->FreeSlots[i] = block->SlotCount - 1 - i;
+		}
+
+		DeviceMemoryTypeStats& stats = mMemoryTypeStats[memoryTypeIndex];
+		stats.BlockCount++;
+		stats.BlockBytes += block->ByteSize;
+
+		mPools[poolIndex].emplace_back(std::move(block));
+		return *mPools[poolIndex].back();
+	}
+
+	void DeviceMemoryAllocatorVulkan::freeBlock(const uint32_t poolIndex, DeviceMemoryBlock& block) {
+		ZoneScoped;
+
+		DeviceMemoryTypeStats& stats = mMemoryTypeStats[getPoolMemoryTypeIndex(poolIndex)];
+		stats.BlockCount--;
+		stats.BlockBytes -= block.ByteSize;
+
+		freeDeviceMemory(block.Memory);
+
+		auto& pool = mPools[poolIndex];
+		const auto itr = std::find_if(
+			pool.begin(),
+			pool.end(),
+			[&block](const std::unique_ptr<DeviceMemoryBlock>& poolBlock) { return poolBlock.get() == &block; }
+		);
+		if (itr != pool.end()) {
+			pool.erase(itr);
+		}
+	}
+
+	uint32_t DeviceMemoryAllocatorVulkan::getSizeClassIndex(const VkDeviceSize size) {
+		uint32_t sizeClassIndex = 0;
+		while (getSizeClassByteSize(sizeClassIndex) < size) {
+			sizeClassIndex++;
+		}
+		return sizeClassIndex;
+	}
+}
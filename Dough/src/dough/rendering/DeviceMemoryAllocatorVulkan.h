@@ -0,0 +1,129 @@
+#pragma once
+
+#include "dough/rendering/IGPUResourceVulkan.h"
+
+#include <vector>
+#include <memory>
+
+namespace DOH {
+
+	//A single vkAllocateMemory split into equally sized slots of one size class.
+	struct DeviceMemoryBlock {
+		VkDeviceMemory Memory = VK_NULL_HANDLE;
+		VkDeviceSize ByteSize = 0;
+		VkDeviceSize SlotByteSize = 0;
+		//Persistently mapped address of the start of the block, nullptr if the memory type isn't host visible.
+		char* MappedData = nullptr;
+		uint32_t PoolIndex = 0;
+		uint32_t SlotCount = 0;
+		std::vector<uint32_t> FreeSlots;
+		//Bytes requested by the allocations in this block, without size class rounding.
+		VkDeviceSize UsedBytes = 0;
+
+		inline uint32_t getUsedSlotCount() const { return SlotCount - static_cast<uint32_t>(FreeSlots.size()); }
+	};
+
+	/**
+	* A range of device memory handed out by DeviceMemoryAllocatorVulkan.
+	* Resources are bound at Offset into Memory. MappedData is only set for host visible memory and already includes Offset.
+	*/
+	struct DeviceMemoryAllocation {
+		VkDeviceMemory Memory = VK_NULL_HANDLE;
+		VkDeviceSize Offset = 0;
+		VkDeviceSize Size = 0;
+		void* MappedData = nullptr;
+
+		//Block the allocation is a slot of, nullptr for dedicated allocations.
+		DeviceMemoryBlock* Block = nullptr;
+		uint32_t Slot = 0;
+		uint32_t MemoryTypeIndex = 0;
+
+		inline bool isValid() const { return Memory != VK_NULL_HANDLE; }
+		inline bool isDedicated() const { return Block == nullptr; }
+	};
+
+	struct DeviceMemoryTypeStats {
+		uint32_t BlockCount = 0;
+		VkDeviceSize BlockBytes = 0;
+		uint32_t BlockAllocationCount = 0;
+		//Bytes requested by block allocations.
+		VkDeviceSize UsedBytes = 0;
+		//Bytes of the slots given to block allocations, the difference from UsedBytes is lost to size class rounding.
+		VkDeviceSize SlotBytes = 0;
+		uint32_t DedicatedAllocationCount = 0;
+		VkDeviceSize DedicatedBytes = 0;
+	};
+
+	/**
+	* Block based device memory allocator so GPU resources don't each need their own vkAllocateMemory.
+	*
+	* Requests are rounded up to a power of two size class (at least the resource's alignment) and given a slot in a block
+	* of that size class. Each memory type has separate pools for linear (buffers) and non-linear (optimal tiling images)
+	* resources so bufferImageGranularity never has to be considered. Requests larger than the largest size class get a
+	* dedicated allocation. Blocks are capped at MAX_BLOCK_BYTE_SIZE so a single large slot doesn't keep much unused memory
+	* allocated. Host visible blocks are mapped once when created and stay mapped until freed.
+	*/
+	class DeviceMemoryAllocatorVulkan {
+	public:
+		static constexpr VkDeviceSize MIN_SIZE_CLASS_BYTE_SIZE = 256;
+		//256 B to 1 MiB
+		static constexpr uint32_t SIZE_CLASS_COUNT = 13;
+		static constexpr VkDeviceSize MAX_SIZE_CLASS_BYTE_SIZE = MIN_SIZE_CLASS_BYTE_SIZE << (SIZE_CLASS_COUNT - 1);
+		static constexpr VkDeviceSize MIN_BLOCK_BYTE_SIZE = 2 * 1024 * 1024;
+		static constexpr VkDeviceSize MAX_BLOCK_BYTE_SIZE = 4 * 1024 * 1024;
+		//Slots per block until MAX_BLOCK_BYTE_SIZE is reached, the largest size classes get fewer.
+		static constexpr uint32_t MIN_BLOCK_SLOT_COUNT = 8;
+		static_assert(MAX_SIZE_CLASS_BYTE_SIZE <= MAX_BLOCK_BYTE_SIZE, "Every size class must fit in a block");
+
+	private:
+		VkDevice mLogicDevice;
+		VkPhysicalDevice mPhysicalDevice;
+		VkPhysicalDeviceMemoryProperties mMemoryProperties;
+		uint32_t mMaxMemoryAllocationCount;
+
+		//Indexed by getPoolIndex()
+		std::vector<std::vector<std::unique_ptr<DeviceMemoryBlock>>> mPools;
+		std::vector<DeviceMemoryTypeStats> mMemoryTypeStats;
+
+		//Number of live vkAllocateMemory allocations, blocks and dedicated.
+		uint32_t mDeviceAllocationCount;
+
+	public:
+		DeviceMemoryAllocatorVulkan(VkDevice logicDevice, VkPhysicalDevice physicalDevice);
+
+		DeviceMemoryAllocatorVulkan(const DeviceMemoryAllocatorVulkan& copy) = delete;
+		DeviceMemoryAllocatorVulkan operator=(const DeviceMemoryAllocatorVulkan& assignment) = delete;
+
+		void init();
+		//Free all blocks, any allocation not yet freed is invalid after this.
+		void close();
+
+		DeviceMemoryAllocation allocate(const VkMemoryRequirements& memRequirements, VkMemoryPropertyFlags props, bool linear);
+		//Allocate and bind memory for buffer.
+		DeviceMemoryAllocation allocateBufferMemory(VkBuffer buffer, VkMemoryPropertyFlags props);
+		//Allocate and bind memory for image. Images are assumed to be optimal tiling.
+		DeviceMemoryAllocation allocateImageMemory(VkImage image, VkMemoryPropertyFlags props);
+		void free(DeviceMemoryAllocation& allocation);
+
+		inline uint32_t getMemoryTypeCount() const { return mMemoryProperties.memoryTypeCount; }
+		inline VkMemoryPropertyFlags getMemoryTypeFlags(const uint32_t memoryTypeIndex) const { return mMemoryProperties.memoryTypes[memoryTypeIndex].propertyFlags; }
+		inline const DeviceMemoryTypeStats& getMemoryTypeStats(const uint32_t memoryTypeIndex) const { return mMemoryTypeStats[memoryTypeIndex]; }
+		inline uint32_t getDeviceAllocationCount() const { return mDeviceAllocationCount; }
+		inline uint32_t getMaxMemoryAllocationCount() const { return mMaxMemoryAllocationCount; }
+
+	private:
+		uint32_t findMemoryTypeIndex(uint32_t typeFilter, VkMemoryPropertyFlags props) const;
+		VkDeviceMemory allocateDeviceMemory(const uint32_t memoryTypeIndex, const VkDeviceSize size, void** mappedData);
+		void freeDeviceMemory(VkDeviceMemory memory);
+		DeviceMemoryBlock& createBlock(const uint32_t poolIndex, const uint32_t memoryTypeIndex, const VkDeviceSize slotByteSize);
+		void freeBlock(const uint32_t poolIndex, DeviceMemoryBlock& block);
+
+		inline uint32_t getPoolIndex(const uint32_t memoryTypeIndex, const bool linear, const uint32_t sizeClassIndex) const {
+			return ((memoryTypeIndex * 2) + (linear ? 0 : 1)) * SIZE_CLASS_COUNT + sizeClassIndex;
+		}
+		inline uint32_t getPoolMemoryTypeIndex(const uint32_t poolIndex) const { return poolIndex / (SIZE_CLASS_COUNT * 2); }
+
+		static uint32_t getSizeClassIndex(const VkDeviceSize size);
+		static constexpr VkDeviceSize getSizeClassByteSize(const uint32_t sizeClassIndex) { return MIN_SIZE_CLASS_BYTE_SIZE << sizeClassIndex; }
+	};
+}
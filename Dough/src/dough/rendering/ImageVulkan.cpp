@@ -2,18 +2,19 @@
 
 namespace DOH {
 
-	ImageVulkan::ImageVulkan(VkImage image, VkDeviceMemory imageMemory, VkImageView imageView)
-	:	IGPUResourceVulkan((image != VK_NULL_HANDLE) || (imageMemory != VK_NULL_HANDLE) || (imageView != VK_NULL_HANDLE)),
+	ImageVulkan::ImageVulkan(DeviceMemoryAllocatorVulkan& allocator, VkImage image, const DeviceMemoryAllocation& imageMemory, VkImageView imageView)
+	:	IGPUResourceVulkan((image != VK_NULL_HANDLE) || imageMemory.isValid() || (imageView != VK_NULL_HANDLE)),
 		mImage(image),
 		mImageMemory(imageMemory),
-		mImageView(imageView)
+		mImageView(imageView),
+		mAllocator(allocator)
 	{}
 
 	ImageVulkan::~ImageVulkan() {
 		if (isUsingGpuResource()) {
 			LOG_ERR(
 				"Image Vulkan GPU resource NOT released before destructor was called." <<
-				"Image: " << mImage << " ImageView: " << mImageView << " Memory: " << mImageMemory
+				"Image: " << mImage << " ImageView: " << mImageView << " Memory: " << mImageMemory.Memory
 			);
 
 			//NOTE:: This is to stop the IGPUResource::~IGPUReource from logging a misleading error message.
@@ -24,7 +25,7 @@ namespace DOH {
 	void ImageVulkan::close(VkDevice logicDevice) {
 		vkDestroyImageView(logicDevice, mImageView, nullptr);
 		vkDestroyImage(logicDevice, mImage, nullptr);
-		vkFreeMemory(logicDevice, mImageMemory, nullptr);
+		mAllocator.free(mImageMemory);
 
 		mUsingGpuResource = false;
 	}
@@ -1,26 +1,30 @@
 #pragma once
 
 #include "dough/rendering/IGPUResourceVulkan.h"
+#include "dough/rendering/DeviceMemoryAllocatorVulkan.h"
 
 namespace DOH {
 
 	class ImageVulkan : public IGPUResourceVulkan {
 	private:
 		VkImage mImage;
-		VkDeviceMemory mImageMemory;
+		DeviceMemoryAllocation mImageMemory;
 		VkImageView mImageView;
+		//Frees mImageMemory on close
+		DeviceMemoryAllocatorVulkan& mAllocator;
 
 	public:
 		//TODO:: Currently just stores image handles, in future have the class be able of creating
 		//	images with different settings.
 		//	Incorporate or remove the use of RenderingContextVulkan::createImage()
-		ImageVulkan(VkImage image, VkDeviceMemory imageMemory, VkImageView imageView);
+		ImageVulkan(DeviceMemoryAllocatorVulkan& allocator, VkImage image, const DeviceMemoryAllocation& imageMemory, VkImageView imageView);
 
 		virtual ~ImageVulkan() override;
 		virtual void close(VkDevice logicDevice) override;
 
 		inline VkImage get() const { return mImage; }
-		inline VkDeviceMemory getMemory() const { return mImageMemory; }
+		inline VkDeviceMemory getMemory() const { return mImageMemory.Memory; }
+		inline const DeviceMemoryAllocation& getMemoryAllocation() const { return mImageMemory; }
 		inline VkImageView getImageView() const { return mImageView; }
 
 	};
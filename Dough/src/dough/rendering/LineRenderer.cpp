@@ -44,16 +44,8 @@ namespace DOH {
 		{
 			//Scene
 			const StaticVertexInputLayout& sceneVertexLayout = StaticVertexInputLayout::get(SCENE_LINE_VERTEX_TYPE);
-			const uint32_t line3dBatchSizeBytes = LINE_BATCH_MAX_LINE_COUNT * sceneVertexLayout.getStride();
+			//Vertex buffer is the batch's allocation from the context's upload ring, set each frame when drawing
 			std::shared_ptr<VertexArrayVulkan> vao = mContext.createVertexArray();
-			std::shared_ptr<VertexBufferVulkan> vbo = mContext.createVertexBuffer(
-				sceneVertexLayout,
-				static_cast<VkDeviceSize>(line3dBatchSizeBytes),
-				VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-				VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
-			);
-			vao->addVertexBuffer(vbo);
-			vao->getVertexBuffers()[0]->map(mContext.getLogicDevice(), line3dBatchSizeBytes);
 
 			//TODO:: Index buffer usage?
 
@@ -87,26 +79,17 @@ namespace DOH {
 			mSceneLineList->GraphicsPipeline = mContext.createGraphicsPipeline(*mSceneLineList->GraphicsPipelineInfo);
 			mSceneLineList->GraphicsPipeline->init(
 				mContext.getLogicDevice(),
-				mContext.getSwapChain().getExtent(),
 				mContext.getRenderPass(ERenderPass::APP_SCENE).get()
 			);
-			mSceneLineList->Batch = std::make_unique<RenderBatchLineList>(SCENE_LINE_VERTEX_TYPE, LINE_BATCH_MAX_LINE_COUNT);
+			mSceneLineList->Batch = std::make_unique<RenderBatchLineList>(SCENE_LINE_VERTEX_TYPE, LINE_BATCH_MAX_LINE_COUNT, false);
 			mSceneLineList->GraphicsPipeline->addRenderableToDraw(mSceneLineList->Renderable);
 		}
 
 		{
 			//UI
 			const StaticVertexInputLayout& uiVertexLayout = StaticVertexInputLayout::get(UI_LINE_VERTEX_TYPE);
-			const uint32_t line2dBatchSizeBytes = LINE_BATCH_MAX_LINE_COUNT * uiVertexLayout.getStride();
+			//Vertex buffer is the batch's allocation from the context's upload ring, set each frame when drawing
 			std::shared_ptr<VertexArrayVulkan> vao = mContext.createVertexArray();
-			std::shared_ptr<VertexBufferVulkan> vbo = mContext.createVertexBuffer(
-				uiVertexLayout,
-				static_cast<VkDeviceSize>(line2dBatchSizeBytes),
-				VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-				VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
-			);
-			vao->addVertexBuffer(vbo);
-			vao->getVertexBuffers()[0]->map(mContext.getLogicDevice(), line2dBatchSizeBytes);
 
 			//TODO:: Index buffer usage
 
@@ -138,10 +121,9 @@ namespace DOH {
 			mUiLineList->GraphicsPipeline = mContext.createGraphicsPipeline(*mUiLineList->GraphicsPipelineInfo);
 			mUiLineList->GraphicsPipeline->init(
 				mContext.getLogicDevice(),
-				mContext.getSwapChain().getExtent(),
 				mContext.getRenderPass(ERenderPass::APP_UI).get()
 			);
-			mUiLineList->Batch = std::make_unique<RenderBatchLineList>(UI_LINE_VERTEX_TYPE, LINE_BATCH_MAX_LINE_COUNT);
+			mUiLineList->Batch = std::make_unique<RenderBatchLineList>(UI_LINE_VERTEX_TYPE, LINE_BATCH_MAX_LINE_COUNT, false);
 			mUiLineList->GraphicsPipeline->addRenderableToDraw(mUiLineList->Renderable);
 		}
 	}
@@ -164,6 +146,7 @@ namespace DOH {
 			if (mWarnOnNullSceneCameraData) {
 				LOG_WARN("ShapeRenderer::drawSceneImpl mSceneCameraData is null");
 			}
+			mSceneLineList->Batch->reset();
 			return;
 		}
 
@@ -178,11 +161,9 @@ namespace DOH {
 			}
 
 			mSceneLineList->Renderable->getVao().setDrawCount(mSceneLineList->Batch->getVertexCount());
-			mSceneLineList->Renderable->getVao().getVertexBuffers()[0]->setDataMapped(
-				mContext.getLogicDevice(),
-				mSceneLineList->Batch->getData().data(),
-				lineCount * RenderBatchLineList::LINE_3D_SIZE
-			);
+			//Lines were written straight into the upload ring by the batch
+			mSceneLineList->Renderable->getVao().setSharedVertexBuffer(mSceneLineList->BatchAllocation.Buffer, mSceneLineList->BatchAllocation.Offset);
+			debugInfo.LineRendererUploadBytes += lineCount * RenderBatchLineList::LINE_3D_SIZE;
 
 			mSceneLineList->GraphicsPipeline->recordDrawCommand(imageIndex, cmd, *mSceneLineList->Renderable, currentBindings, 0);
 			debugInfo.SceneDrawCalls++;
@@ -202,6 +183,7 @@ namespace DOH {
 			if (mWarnOnNullUiCameraData) {
 				LOG_WARN("LineRenderer::drawUiImpl mUiCameraData is null");
 			}
+			mUiLineList->Batch->reset();
 			return;
 		}
 
@@ -217,11 +199,9 @@ namespace DOH {
 
 			mUiLineList->Renderable->getVao().setDrawCount(mUiLineList->Batch->getVertexCount());
 
-			mUiLineList->Renderable->getVao().getVertexBuffers()[0]->setDataMapped(
-				mContext.getLogicDevice(),
-				mUiLineList->Batch->getData().data(),
-				lineCount * RenderBatchLineList::LINE_2D_SIZE
-			);
+			//Lines were written straight into the upload ring by the batch
+			mUiLineList->Renderable->getVao().setSharedVertexBuffer(mUiLineList->BatchAllocation.Buffer, mUiLineList->BatchAllocation.Offset);
+			debugInfo.LineRendererUploadBytes += lineCount * RenderBatchLineList::LINE_2D_SIZE;
 
 			mUiLineList->GraphicsPipeline->recordDrawCommand(imageIndex, cmd, *mUiLineList->Renderable, currentBindings, 0);
 			debugInfo.UiDrawCalls++;
@@ -230,25 +210,35 @@ namespace DOH {
 		mUiLineList->Batch->reset();
 	}
 
-	void LineRenderer::onSwapChainResizeImpl(SwapChainVulkan& swapChain) {
+	void LineRenderer::onRenderPassesRecreatedImpl() {
 		ZoneScoped;
 
-		mSceneLineList->GraphicsPipeline->resize(
+		mSceneLineList->GraphicsPipeline->recreate(
 			mContext.getLogicDevice(),
-			swapChain.getExtent(),
 			mContext.getRenderPass(ERenderPass::APP_SCENE).get()
 		);
-		mUiLineList->GraphicsPipeline->resize(
+		mUiLineList->GraphicsPipeline->recreate(
 			mContext.getLogicDevice(),
-			swapChain.getExtent(),
 			mContext.getRenderPass(ERenderPass::APP_UI).get()
 		);
 	}
 
+	void LineRenderer::prepareBatch(LineRenderingObjects& lineList) {
+		UploadRingVulkan& uploadRing = mContext.getUploadRing();
+		if (lineList.BatchAllocationFrame != uploadRing.getFrameNumber()) {
+			ZoneScoped;
+
+			lineList.BatchAllocation = uploadRing.allocate(lineList.Batch->getDataByteSize());
+			lineList.BatchAllocationFrame = uploadRing.getFrameNumber();
+			lineList.Batch->setDataTarget(lineList.BatchAllocation.Data);
+		}
+	}
+
 	void LineRenderer::drawLineSceneImpl(const glm::vec3& start, const glm::vec3& end, const glm::vec4& colour) {
 		ZoneScoped;
 
 		if (mSceneLineList->Batch->hasSpace()) {
+			prepareBatch(*mSceneLineList);
 			mSceneLineList->Batch->add3d(start, end, colour);
 		} else {
 			LOG_WARN("Scene line batch max line count reached: " << mSceneLineList->Batch->getMaxLineCount());
@@ -259,6 +249,7 @@ namespace DOH {
 		ZoneScoped;
 
 		if (mUiLineList->Batch->hasSpace()) {
+			prepareBatch(*mUiLineList);
 			mUiLineList->Batch->add2d(start, end, colour);
 		} else {
 			LOG_WARN("UI line batch max line count reached: " << mUiLineList->Batch->getMaxLineCount());
@@ -269,6 +260,7 @@ namespace DOH {
 		ZoneScoped;
 
 		if (mSceneLineList->Batch->hasSpace(4)) {
+			prepareBatch(*mSceneLineList);
 			glm::vec3 botLeft = { quad.Position.x, quad.Position.y, quad.Position.z };
 			glm::vec3 botRight = { quad.Position.x + quad.Size.x, quad.Position.y, quad.Position.z };
 			glm::vec3 topLeft = { quad.Position.x, quad.Position.y + quad.Size.y, quad.Position.z };
@@ -287,6 +279,7 @@ namespace DOH {
 		ZoneScoped;
 
 		if (mUiLineList->Batch->hasSpace(4)) {
+			prepareBatch(*mUiLineList);
 			glm::vec3 botLeft = { quad.Position.x, quad.Position.y, quad.Position.z };
 			glm::vec3 botRight = { quad.Position.x + quad.Size.x, quad.Position.y, quad.Position.z };
 			glm::vec3 topLeft = { quad.Position.x, quad.Position.y + quad.Size.y, quad.Position.z };
@@ -320,11 +313,11 @@ namespace DOH {
 		}
 	}
 
-	void LineRenderer::onSwapChainResize(SwapChainVulkan& swapChain) {
+	void LineRenderer::onRenderPassesRecreated() {
 		if (INSTANCE != nullptr) {
-			INSTANCE->onSwapChainResizeImpl(swapChain);
+			INSTANCE->onRenderPassesRecreatedImpl();
 		} else {
-			LOG_WARN("LineRenderer::onSwapChainResize called when not initialised.");
+			LOG_WARN("LineRenderer::onRenderPassesRecreated called when not initialised.");
 		}
 	}
 
@@ -5,6 +5,7 @@
 #include "dough/rendering/pipeline/GraphicsPipelineVulkan.h"
 #include "dough/rendering/renderables/SimpleRenderable.h"
 #include "dough/rendering/RenderPassVulkan.h"
+#include "dough/rendering/buffer/UploadRingVulkan.h"
 
 namespace DOH {
 
@@ -26,6 +27,9 @@ namespace DOH {
 		std::shared_ptr<SimpleRenderable> Renderable;
 		std::unique_ptr<GraphicsPipelineInstanceInfo> GraphicsPipelineInfo;
 		std::unique_ptr<RenderBatchLineList> Batch; //TODO:: Allow for RenderBatchLineStrip
+		//Upload ring allocation Batch is writing to and the ring frame number it was made in.
+		UploadRingAllocation BatchAllocation;
+		uint64_t BatchAllocationFrame = UINT64_MAX;
 
 		virtual void addOwnedResourcesToClose(RenderingContextVulkan& context) override;
 	};
@@ -69,11 +73,14 @@ namespace DOH {
 	private:
 		void initImpl();
 		void closeImpl();
-		void onSwapChainResizeImpl(SwapChainVulkan& swapChain);
+		void onRenderPassesRecreatedImpl();
 
 		void drawSceneImpl(uint32_t imageIndex, VkCommandBuffer cmd, CurrentBindingsState& currentBindings);
 		void drawUiImpl(uint32_t imageIndex, VkCommandBuffer cmd, CurrentBindingsState& currentBindings);
 
+		//Point the batch at a new upload ring allocation if it isn't writing to one from the current frame.
+		void prepareBatch(LineRenderingObjects& lineList);
+
 		void drawLineSceneImpl(const glm::vec3& start, const glm::vec3& end, const glm::vec4& colour);
 		void drawLineUiImpl(const glm::vec2& start, const glm::vec2& end, const glm::vec4& colour);
 
@@ -90,7 +97,7 @@ namespace DOH {
 
 		static void init(RenderingContextVulkan& context);
 		static void close();
-		static void onSwapChainResize(SwapChainVulkan& swapChain);
+		static void onRenderPassesRecreated();
 
 	public:
 		LineRenderer(RenderingContextVulkan& context);
@@ -9,23 +9,24 @@ namespace DOH {
 	ModelVulkan::ModelVulkan(std::shared_ptr<Model3dCreationData> modelCreationData) {
 		ZoneScoped;
 
+		//For a cooked mesh the data is copied into the staging buffers straight from the mapped file
 		auto& context = Application::get().getRenderer().getContext();
 		std::shared_ptr<VertexBufferVulkan> vbo = context.createStagedVertexBuffer(
 			modelCreationData->VertexInputLayout,
-			modelCreationData->Vertices.data(),
-			modelCreationData->Vertices.size() * sizeof(float),
+			modelCreationData->getVertexData(),
+			modelCreationData->getVertexFloatCount() * sizeof(float),
 			VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
 			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
 		);
 		std::shared_ptr<IndexBufferVulkan> ibo = context.createStagedIndexBuffer(
-			modelCreationData->Indices.data(),
-			modelCreationData->Indices.size() * sizeof(uint32_t)
+			modelCreationData->getIndexData(),
+			modelCreationData->getIndexCount() * sizeof(uint32_t)
 		);
 
 		mVao = context.createVertexArray();
 		mVao->addVertexBuffer(vbo);
 		mVao->setIndexBuffer(ibo);
-		mVao->setDrawCount(static_cast<uint32_t>(modelCreationData->Indices.size()));
+		mVao->setDrawCount(static_cast<uint32_t>(modelCreationData->getIndexCount()));
 
 		mUsingGpuResource = true;
 	}
@@ -70,9 +70,16 @@ namespace DOH {
 			Application::get().getRenderer().areValidationLayersEnabled()
 		);
 
+		mMemoryAllocator = std::make_unique<DeviceMemoryAllocatorVulkan>(mLogicDevice, mPhysicalDevice);
+		mMemoryAllocator->init();
+
+		mPipelineCache = std::make_unique<PipelineCacheVulkan>(mLogicDevice);
+		mPipelineCache->init(*mPhysicalDeviceProperties);
+
 		createQueues(queueFamilyIndices);
 
 		createCommandPool(queueFamilyIndices);
+		mStagingUploadQueue = std::make_unique<StagingUploadQueueVulkan>(mLogicDevice, *mMemoryAllocator, mCommandPool, mGraphicsQueue);
 
 		mDepthFormat = RendererVulkan::findSupportedFormat(
 			{ VK_FORMAT_D32_SFLOAT, VK_FORMAT_D32_SFLOAT_S8_UINT, VK_FORMAT_D24_UNORM_S8_UINT },
@@ -112,6 +119,9 @@ namespace DOH {
 		createEngineDescriptorPool();
 		createEngineDescriptorSets();
 
+		mUploadRing = std::make_unique<UploadRingVulkan>(*this, MAX_FRAMES_IN_FLIGHT);
+		mUploadRing->init();
+
 		ShapeRenderer::init(*this);
 		TextRenderer::init(*this);
 		LineRenderer::init(*this);
@@ -126,6 +136,7 @@ namespace DOH {
 		imGuiInitInfo.QueueFamily = queueFamilyIndices.GraphicsFamily.value();
 		imGuiInitInfo.VulkanInstance = vulkanInstance;
 		imGuiInitInfo.ImageFormat = mSwapChain->getImageFormat();
+		imGuiInitInfo.PipelineCache = mPipelineCache->get();
 
 		mImGuiWrapper->init(window, imGuiInitInfo);
 		mImGuiWrapper->uploadFonts(*this);
@@ -165,9 +176,16 @@ namespace DOH {
 			mCommandBuffers.data()
 		);
 
+		if (mStagingUploadQueue != nullptr) {
+			mStagingUploadQueue->close();
+		}
+
 		TextRenderer::close();
 		ShapeRenderer::close();
 		LineRenderer::close();
+		if (mUploadRing != nullptr) {
+			mUploadRing->addOwnedResourcesToClose(*this);
+		}
 		if (mImGuiWrapper != nullptr) {
 			mImGuiWrapper->close(mLogicDevice);
 		}
@@ -207,6 +225,15 @@ namespace DOH {
 		}
 
 		vkDestroyCommandPool(mLogicDevice, mCommandPool, nullptr);
+
+		if (mPipelineCache != nullptr) {
+			mPipelineCache->close();
+		}
+
+		//Closed last as every buffer and image closed above returns its memory to the allocator.
+		if (mMemoryAllocator != nullptr) {
+			mMemoryAllocator->close();
+		}
 	}
 
 	void RenderingContextVulkan::releaseFrameGpuResources(size_t releaseFrameIndex) {
@@ -243,10 +270,12 @@ namespace DOH {
 		) {
 			Application::get().getRenderer().deviceWaitIdle("Device waiting idle for swap chain recreation");
 
-			closeRenderPasses();
+			//Viewport and scissor are dynamic state, so pipelines only depend on the render passes which only depend on
+			// the swap chain image format. The render passes, and so the pipelines, only need recreating if that changed.
+			const VkFormat prevImageFormat = mSwapChain->getImageFormat();
+
 			closeAppSceneDepthResources();
 			closeFrameBuffers();
-			mImGuiWrapper->closeRenderPass(mLogicDevice);
 			mImGuiWrapper->closeFrameBuffers(mLogicDevice);
 
 			mSwapChainCreationInfo->setWidth(width);
@@ -258,23 +287,29 @@ namespace DOH {
 				mSwapChain = createSwapChain(*mSwapChainCreationInfo);
 			}
 
-			createRenderPasses();
-			mImGuiWrapper->createRenderPass(mLogicDevice, mSwapChain->getImageFormat());
-			createAppSceneDepthResources();
-			createFrameBuffers();
-			mImGuiWrapper->createFrameBuffers(mLogicDevice, mSwapChain->getImageViews(), mSwapChain->getExtent());
+			if (mSwapChain->getImageFormat() != prevImageFormat) {
+				LOG_INFO("Swap chain image format changed, recreating render passes and pipelines");
+
+				closeRenderPasses();
+				mImGuiWrapper->closeRenderPass(mLogicDevice);
+				createRenderPasses();
+				mImGuiWrapper->createRenderPass(mLogicDevice, mSwapChain->getImageFormat());
 
-			ShapeRenderer::onSwapChainResize(*mSwapChain);
-			TextRenderer::onSwapChainResize(*mSwapChain);
-			LineRenderer::onSwapChainResize(*mSwapChain);
+				ShapeRenderer::onRenderPassesRecreated();
+				TextRenderer::onRenderPassesRecreated();
+				LineRenderer::onRenderPassesRecreated();
 
-			const VkExtent2D extent = mSwapChain->getExtent();
-			for (auto& pipelineGroup : mCurrentRenderState->getRenderPassGraphicsPipelineMap()) {
-				const VkRenderPass rp = getRenderPass(pipelineGroup.first).get();
-				for (auto& pipeline : pipelineGroup.second) {
-					pipeline.second->resize(mLogicDevice, extent, rp);
+				for (auto& pipelineGroup : mCurrentRenderState->getRenderPassGraphicsPipelineMap()) {
+					const VkRenderPass rp = getRenderPass(pipelineGroup.first).get();
+					for (auto& pipeline : pipelineGroup.second) {
+						pipeline.second->recreate(mLogicDevice, rp);
+					}
 				}
 			}
+
+			createAppSceneDepthResources();
+			createFrameBuffers();
+			mImGuiWrapper->createFrameBuffers(mLogicDevice, mSwapChain->getImageViews(), mSwapChain->getExtent());
 		}
 	}
 
@@ -285,6 +320,10 @@ namespace DOH {
 		AppDebugInfo& debugInfo = Application::get().getDebugInfo();
 		debugInfo.resetPerFrameData();
 
+		//Submitted before this frame's commands so anything uploaded during update/render can be drawn this frame.
+		mStagingUploadQueue->submit();
+		mStagingUploadQueue->update();
+
 		uint32_t imageIndex = mSwapChain->aquireNextImageIndex(
 			mLogicDevice,
 			mFramesInFlightFences[mCurrentFrame],
@@ -295,6 +334,9 @@ namespace DOH {
 		TextRenderer::resetLocalDebugInfo();
 		//TODO:: LineRenderer::resetLocalDebugInfo();
 
+		//After the upload submit above, so fonts whose pages were uploaded last frame can be drawn this frame.
+		TextRenderer::beginFrame(imageIndex);
+
 		for (std::pair<const char*, std::reference_wrapper<ICamera>>& camera : mCamerasToUpdate) {
 			camera.second.get().getGpuData()->updateGpuData(
 				mLogicDevice,
@@ -331,6 +373,11 @@ namespace DOH {
 
 		mCurrentFrame = getNextFrameIndex(mCurrentFrame);
 		mGpuResourceCloseFrame = getNextGpuResourceCloseFrameIndex(mGpuResourceCloseFrame);
+
+		//Batches write straight into the upload ring while the app is updating, before the next drawFrame, so wait for the GPU
+		// to finish with the next frame here rather than at image acquisition to make its region of the ring safe to write to.
+		vkWaitForFences(mLogicDevice, 1, &mFramesInFlightFences[mCurrentFrame], VK_TRUE, UINT64_MAX);
+		mUploadRing->beginFrame(mCurrentFrame);
 	}
 
 	void RenderingContextVulkan::drawScene(uint32_t imageIndex, VkCommandBuffer cmd, CurrentBindingsState& currentBindings) {
@@ -651,12 +698,12 @@ namespace DOH {
 				VK_IMAGE_TILING_OPTIMAL,
 				VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT
 			);
-			VkDeviceMemory depthImageMem = createImageMemory(
+			DeviceMemoryAllocation depthImageMem = createImageMemory(
 				depthImage,
 				VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
 			);
 			VkImageView depthImageView = createImageView(depthImage, mDepthFormat, VK_IMAGE_ASPECT_DEPTH_BIT);
-			mAppSceneDepthImages.emplace_back(depthImage, depthImageMem, depthImageView);
+			mAppSceneDepthImages.emplace_back(*mMemoryAllocator, depthImage, depthImageMem, depthImageView);
 		}
 	}
 
@@ -804,7 +851,7 @@ namespace DOH {
 			}
 
 			const auto pipeline = createGraphicsPipeline(instanceInfo);
-			pipeline->init(mLogicDevice, mSwapChain->getExtent(), getRenderPass(instanceInfo.getRenderPass()).get());
+			pipeline->init(mLogicDevice, getRenderPass(instanceInfo.getRenderPass()).get());
 			if (pipeline != nullptr) {
 				mCurrentRenderState->addPipelineToRenderPass(instanceInfo.getRenderPass(), name, pipeline);
 				return { *pipeline };
@@ -1119,7 +1166,7 @@ namespace DOH {
 		endSingleTimeCommands(cmdBuffer);
 	}
 
-	VkImageView RenderingContextVulkan::createImageView(VkImage image, VkFormat format, VkImageAspectFlags aspectFlags) const {
+	VkImageView RenderingContextVulkan::createImageView(VkImage image, VkFormat format, VkImageAspectFlags aspectFlags, uint32_t mipLevels) const {
 		ZoneScoped;
 
 		VkImageViewCreateInfo view{};
@@ -1129,7 +1176,7 @@ namespace DOH {
 		view.format = format;
 		view.subresourceRange.aspectMask = aspectFlags;
 		view.subresourceRange.baseMipLevel = 0;
-		view.subresourceRange.levelCount = 1;
+		view.subresourceRange.levelCount = mipLevels;
 		view.subresourceRange.baseArrayLayer = 0;
 		view.subresourceRange.layerCount = 1;
 
@@ -1141,7 +1188,7 @@ namespace DOH {
 		return imageView;
 	}
 
-	VkSampler RenderingContextVulkan::createSampler() {
+	VkSampler RenderingContextVulkan::createSampler(uint32_t mipLevels) {
 		ZoneScoped;
 
 		VkSamplerCreateInfo samplerCreate{};
@@ -1160,7 +1207,7 @@ namespace DOH {
 		samplerCreate.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
 		samplerCreate.mipLodBias = 0.0f;
 		samplerCreate.minLod = 0.0f;
-		samplerCreate.maxLod = 0.0f;
+		samplerCreate.maxLod = static_cast<float>(mipLevels - 1);
 
 		VkSampler sampler;
 		VK_TRY(
@@ -1234,7 +1281,7 @@ namespace DOH {
 				VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
 				VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
 			);
-			cameraGpuData->ValueBuffers[i]->map(mLogicDevice, sizeof(UniformBufferObject));
+			cameraGpuData->ValueBuffers[i]->map();
 			cameraGpuData->ValueBuffers[i]->setDataMapped(mLogicDevice, &camera.getProjectionViewMatrix(), sizeof(glm::mat4x4));
 
 			DescriptorSetUpdate cameraUpdate = {
@@ -1269,7 +1316,8 @@ namespace DOH {
 		uint32_t height,
 		VkFormat format,
 		VkImageTiling tiling,
-		VkImageUsageFlags usage
+		VkImageUsageFlags usage,
+		uint32_t mipLevels
 	) {
 		ZoneScoped;
 
@@ -1279,7 +1327,7 @@ namespace DOH {
 		imageCreateInfo.extent.width = width;
 		imageCreateInfo.extent.height = height;
 		imageCreateInfo.extent.depth = 1;
-		imageCreateInfo.mipLevels = 1;
+		imageCreateInfo.mipLevels = mipLevels;
 		imageCreateInfo.arrayLayers = 1;
 		imageCreateInfo.format = format;
 		imageCreateInfo.tiling = tiling;
@@ -1297,40 +1345,6 @@ namespace DOH {
 		return image;
 	}
 
-	VkDeviceMemory RenderingContextVulkan::createImageMemory(
-		VkDevice logicDevice,
-		VkPhysicalDevice physicalDevice,
-		VkImage image,
-		VkMemoryPropertyFlags props
-	) {
-		ZoneScoped;
-
-		VkDeviceMemory imageMemory;
-		VkMemoryRequirements memRequirements;
-		vkGetImageMemoryRequirements(logicDevice, image, &memRequirements);
-
-		VkMemoryAllocateInfo allocation{};
-		allocation.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-		allocation.allocationSize = memRequirements.size;
-		allocation.memoryTypeIndex = RendererVulkan::findPhysicalDeviceMemoryType(
-			physicalDevice,
-			memRequirements.memoryTypeBits,
-			props
-		);
-
-		VK_TRY(
-			vkAllocateMemory(logicDevice, &allocation, nullptr, &imageMemory),
-			"Failed to allocate image memory"
-		);
-
-		VK_TRY(
-			vkBindImageMemory(logicDevice, image, imageMemory, 0),
-			"Failed to bind image memory"
-		);
-
-		return imageMemory;
-	}
-
 	RenderPassVulkan& RenderingContextVulkan::getRenderPass(const ERenderPass renderPass) const {
 		switch (renderPass) {
 			case ERenderPass::APP_SCENE:
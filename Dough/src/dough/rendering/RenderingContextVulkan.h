@@ -11,6 +11,10 @@
 #include "dough/rendering/text/FontBitmap.h"
 #include "dough/rendering/pipeline/GraphicsPipelineVulkan.h"
 #include "dough/rendering/pipeline/ShaderDescriptorSetLayoutsVulkan.h"
+#include "dough/rendering/pipeline/PipelineCacheVulkan.h"
+#include "dough/rendering/buffer/UploadRingVulkan.h"
+#include "dough/rendering/DeviceMemoryAllocatorVulkan.h"
+#include "dough/rendering/StagingUploadQueueVulkan.h"
 
 #include <queue>
 
@@ -57,6 +61,7 @@ namespace DOH {
 		VkPipelineLayout PipelineLayout = VK_NULL_HANDLE;
 		//NOTE:: Assumes only one VertexBuffer is bound at a time
 		VkBuffer VertexBuffer = VK_NULL_HANDLE;
+		VkDeviceSize VertexBufferOffset = 0;
 		VkBuffer IndexBuffer = VK_NULL_HANDLE;
 		VkRenderPass RenderPass = VK_NULL_HANDLE;
 
@@ -123,6 +128,9 @@ namespace DOH {
 		std::unique_ptr<RenderingDeviceInfo> mRenderingDeviceInfo;
 
 		std::unique_ptr<VkPhysicalDeviceProperties> mPhysicalDeviceProperties;
+		//All buffer and image memory of the engine is sub-allocated from this.
+		std::unique_ptr<DeviceMemoryAllocatorVulkan> mMemoryAllocator;
+		std::unique_ptr<PipelineCacheVulkan> mPipelineCache;
 		std::unique_ptr<SwapChainCreationInfo> mSwapChainCreationInfo;
 
 		VkQueue mGraphicsQueue;
@@ -135,6 +143,9 @@ namespace DOH {
 
 		std::unique_ptr<ImGuiWrapper> mImGuiWrapper;
 
+		//Per-frame vertex data of the built-in renderers is sub-allocated from this.
+		std::unique_ptr<UploadRingVulkan> mUploadRing;
+
 		std::vector<VkFramebuffer> mAppSceneFrameBuffers;
 		std::vector<VkFramebuffer> mAppUiFrameBuffers;
 
@@ -150,6 +161,9 @@ namespace DOH {
 
 		VkCommandPool mCommandPool;
 
+		//Staged buffer and texture uploads are batched into this and submitted at the start of each drawFrame.
+		std::unique_ptr<StagingUploadQueueVulkan> mStagingUploadQueue;
+
 		std::queue<std::shared_ptr<IGPUResourceVulkan>> mGpuResourcesToClose;
 		//The number of gpu objects to close at frame: array index
 		std::array<size_t, GPU_RESOURCE_CLOSE_FRAME_INDEX_COUNT> mGpuResourcesFrameCloseCount;
@@ -236,7 +250,7 @@ namespace DOH {
 		inline void closeGpuResourceImmediately(IGPUResourceVulkan& res) const { res.close(mLogicDevice); }
 		void releaseFrameGpuResources(size_t frameIndex);
 
-		//TODO:: Prefer grouping commands together then flushing rather than only single commands
+		//NOTE:: Prefer getStagingUploadQueue() for uploads, single time commands wait on the whole queue.
 		
 		//	Creates a command buffer and begins it, the caller MUST call endSingleTimeCommands at some point,
 		//	at which point the queue waits upon its exectuion
@@ -248,7 +262,7 @@ namespace DOH {
 		void beginCommandBuffer(VkCommandBuffer cmd, VkCommandBufferUsageFlags usage = 0);
 		void endCommandBuffer(VkCommandBuffer cmd);
 
-		//TODO:: These functions call begin and end single time commands individually
+		//NOTE:: These functions call begin and end single time commands individually, StagingUploadQueueVulkan::uploadImage records all three in a batch
 		void copyBufferToImage(VkBuffer buffer, VkImage image, uint32_t width, uint32_t height);
 		void transitionStagedImageLayout(
 			VkImage image,
@@ -271,25 +285,33 @@ namespace DOH {
 			uint32_t height,
 			VkFormat format,
 			VkImageTiling tiling,
-			VkImageUsageFlags usage
+			VkImageUsageFlags usage,
+			uint32_t mipLevels = 1
 		) {
-			return createImage(mLogicDevice, mPhysicalDevice, width, height, format, tiling, usage);
+			return createImage(mLogicDevice, mPhysicalDevice, width, height, format, tiling, usage, mipLevels);
 		};
-		inline VkDeviceMemory createImageMemory(VkImage image, VkMemoryPropertyFlags props) {
-			return createImageMemory(mLogicDevice, mPhysicalDevice, image, props);
+		//Allocate and bind memory for image, the allocation must be freed through getMemoryAllocator().
+		inline DeviceMemoryAllocation createImageMemory(VkImage image, VkMemoryPropertyFlags props) {
+			return mMemoryAllocator->allocateImageMemory(image, props);
 		};
-		VkImageView createImageView(VkImage image, VkFormat format, VkImageAspectFlags aspectFlags) const;
-		VkSampler createSampler();
+		VkImageView createImageView(VkImage image, VkFormat format, VkImageAspectFlags aspectFlags, uint32_t mipLevels = 1) const;
+		//mipLevels is of the images sampled, every level is sampled with trilinear filtering.
+		VkSampler createSampler(uint32_t mipLevels = 1);
 		//Tell the renderer to update the camera's GPU-side data before the frame is rendered
 		void addCameraToUpdateList(const char* name, ICamera& camera);
 
 		inline uint32_t getAppFrameBufferCount() const { return static_cast<uint32_t>(mAppSceneFrameBuffers.size() + mAppUiFrameBuffers.size()); }
 		inline ImGuiWrapper& getImGuiWrapper() const { return *mImGuiWrapper; }
+		inline UploadRingVulkan& getUploadRing() const { return *mUploadRing; }
+		inline DeviceMemoryAllocatorVulkan& getMemoryAllocator() const { return *mMemoryAllocator; }
+		inline StagingUploadQueueVulkan& getStagingUploadQueue() const { return *mStagingUploadQueue; }
+		inline PipelineCacheVulkan& getPipelineCache() const { return *mPipelineCache; }
 		inline SwapChainVulkan& getSwapChain() const { return *mSwapChain; }
 		inline void setLogicDevice(VkDevice logicDevice) { mLogicDevice = logicDevice; }
 		void setPhysicalDevice(VkPhysicalDevice physicalDevice);
 		inline RenderingDeviceInfo& getRenderingDeviceInfo() const { return *mRenderingDeviceInfo; }
 		inline size_t getCurrentFrame() const { return mCurrentFrame; }
+		static constexpr size_t getMaxFramesInFlight() { return MAX_FRAMES_IN_FLIGHT; }
 		inline VkDescriptorPool getEngineDescriptorPool() const { return mEngineDescriptorPool; }
 		inline VkDescriptorPool getCustomDescriptorPool() const { return mCustomDescriptorPool; }
 
@@ -309,13 +331,8 @@ namespace DOH {
 			uint32_t height,
 			VkFormat format,
 			VkImageTiling tiling,
-			VkImageUsageFlags usage
-		);
-		static VkDeviceMemory createImageMemory(
-			VkDevice logicDevice,
-			VkPhysicalDevice physicalDevice,
-			VkImage image,
-			VkMemoryPropertyFlags props
+			VkImageUsageFlags usage,
+			uint32_t mipLevels = 1
 		);
 
 		static VkPushConstantRange pushConstantInfo(VkShaderStageFlagBits stage, uint32_t size, uint32_t offset);
@@ -326,23 +343,23 @@ namespace DOH {
 
 		//-----Single Resources-----
 		//-----Pipeline-----
-		inline std::shared_ptr<GraphicsPipelineVulkan> createGraphicsPipeline(GraphicsPipelineInstanceInfo& instanceInfo) const { return std::make_shared<GraphicsPipelineVulkan>(instanceInfo); }
+		inline std::shared_ptr<GraphicsPipelineVulkan> createGraphicsPipeline(GraphicsPipelineInstanceInfo& instanceInfo) const { return std::make_shared<GraphicsPipelineVulkan>(instanceInfo, *mPipelineCache); }
 
 		//-----Context-----
 		inline std::shared_ptr<SwapChainVulkan> createSwapChain(SwapChainCreationInfo& swapChainCreate) const { return std::make_shared<SwapChainVulkan>(mLogicDevice, swapChainCreate); }
 
 		//-----VAO & Buffers-----
 		inline std::shared_ptr<VertexArrayVulkan> createVertexArray() const { return std::make_shared<VertexArrayVulkan>(); }
-		inline std::shared_ptr<VertexBufferVulkan> createVertexBuffer(const AVertexInputLayout& vertexInputLayout, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags props) const { return std::make_shared<VertexBufferVulkan>(vertexInputLayout, mLogicDevice, mPhysicalDevice, size, usage, props); }
-		inline std::shared_ptr<VertexBufferVulkan> createStagedVertexBuffer(const AVertexInputLayout& vertexInputLayout, const void* data, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags props) const { return std::make_shared<VertexBufferVulkan>(vertexInputLayout, mLogicDevice, mPhysicalDevice, mCommandPool, mGraphicsQueue, data, size, usage, props); }
-		inline std::shared_ptr<IndexBufferVulkan> createIndexBuffer(VkDeviceSize size) const { return std::make_shared<IndexBufferVulkan>(mLogicDevice, mPhysicalDevice, size); }
-		inline std::shared_ptr<IndexBufferVulkan> createStagedIndexBuffer(void* data, VkDeviceSize size) const { return std::make_shared<IndexBufferVulkan>(mLogicDevice, mPhysicalDevice, mCommandPool, mGraphicsQueue, (const void*) data, size); }
-		inline std::shared_ptr<IndexBufferVulkan> createStagedIndexBuffer(const void* data, VkDeviceSize size) const { return std::make_shared<IndexBufferVulkan>(mLogicDevice, mPhysicalDevice, mCommandPool, mGraphicsQueue, data, size); }
+		inline std::shared_ptr<VertexBufferVulkan> createVertexBuffer(const AVertexInputLayout& vertexInputLayout, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags props) const { return std::make_shared<VertexBufferVulkan>(vertexInputLayout, mLogicDevice, *mMemoryAllocator, size, usage, props); }
+		inline std::shared_ptr<VertexBufferVulkan> createStagedVertexBuffer(const AVertexInputLayout& vertexInputLayout, const void* data, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags props) const { return std::make_shared<VertexBufferVulkan>(vertexInputLayout, mLogicDevice, *mMemoryAllocator, *mStagingUploadQueue, data, size, usage, props); }
+		inline std::shared_ptr<IndexBufferVulkan> createIndexBuffer(VkDeviceSize size) const { return std::make_shared<IndexBufferVulkan>(mLogicDevice, *mMemoryAllocator, size); }
+		inline std::shared_ptr<IndexBufferVulkan> createStagedIndexBuffer(void* data, VkDeviceSize size) const { return std::make_shared<IndexBufferVulkan>(mLogicDevice, *mMemoryAllocator, *mStagingUploadQueue, (const void*) data, size); }
+		inline std::shared_ptr<IndexBufferVulkan> createStagedIndexBuffer(const void* data, VkDeviceSize size) const { return std::make_shared<IndexBufferVulkan>(mLogicDevice, *mMemoryAllocator, *mStagingUploadQueue, data, size); }
 		//TODO:: createSharedIndexBuffer()
-		inline std::shared_ptr<IndexBufferVulkan> createSharedStagedIndexBuffer(const void* data, VkDeviceSize size) const { return std::make_shared<IndexBufferVulkan>(mLogicDevice, mPhysicalDevice, mCommandPool, mGraphicsQueue, data, size); }
-		inline std::shared_ptr<BufferVulkan> createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags props) const { return std::make_shared<BufferVulkan>(mLogicDevice, mPhysicalDevice, size, usage, props); }
-		inline std::shared_ptr<BufferVulkan> createStagedBuffer(void* data, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags props) const { return std::make_shared<BufferVulkan>(mLogicDevice, mPhysicalDevice, mCommandPool, mGraphicsQueue, (const void*) data, size, usage, props); }
-		inline std::shared_ptr<BufferVulkan> createStagedBuffer(const void* data, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags props) const { return std::make_shared<BufferVulkan>(mLogicDevice, mPhysicalDevice, mCommandPool, mGraphicsQueue, data, size, usage, props); }
+		inline std::shared_ptr<IndexBufferVulkan> createSharedStagedIndexBuffer(const void* data, VkDeviceSize size) const { return std::make_shared<IndexBufferVulkan>(mLogicDevice, *mMemoryAllocator, *mStagingUploadQueue, data, size); }
+		inline std::shared_ptr<BufferVulkan> createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags props) const { return std::make_shared<BufferVulkan>(mLogicDevice, *mMemoryAllocator, size, usage, props); }
+		inline std::shared_ptr<BufferVulkan> createStagedBuffer(void* data, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags props) const { return std::make_shared<BufferVulkan>(mLogicDevice, *mMemoryAllocator, *mStagingUploadQueue, (const void*) data, size, usage, props); }
+		inline std::shared_ptr<BufferVulkan> createStagedBuffer(const void* data, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags props) const { return std::make_shared<BufferVulkan>(mLogicDevice, *mMemoryAllocator, *mStagingUploadQueue, data, size, usage, props); }
 
 		//-----Shader-----
 		inline std::shared_ptr<ShaderVulkan> createShader(EShaderStage stage, const char* filePath) const { return std::make_shared<ShaderVulkan>(stage, filePath); }
@@ -350,13 +367,14 @@ namespace DOH {
 		std::shared_ptr<DescriptorSetLayoutVulkan> createDescriptorSetLayout(const std::vector<AShaderDescriptor>& descriptors, bool addToLayoutCache, const char* name);
 
 		//-----Texture-----
-		inline std::shared_ptr<TextureVulkan> createTexture(const std::string& filePath) const { return std::make_shared<TextureVulkan>(mLogicDevice, mPhysicalDevice, filePath); }
+		inline std::shared_ptr<TextureVulkan> createTexture(const std::string& filePath, const TextureMipSettings& mipSettings = {}) const { return std::make_shared<TextureVulkan>(mLogicDevice, mPhysicalDevice, filePath, mipSettings); }
+		inline std::shared_ptr<TextureVulkan> createTexture(const std::string& name, const TextureCreationData& textureData) const { return std::make_shared<TextureVulkan>(mLogicDevice, mPhysicalDevice, name, textureData); }
 		inline std::shared_ptr<TextureVulkan> createTexture(float r, float g, float b, float a, bool colourRgbaNormalised = false, const char* name = "Un-named Texture") const { return std::make_shared<TextureVulkan>(mLogicDevice, mPhysicalDevice, r, g, b, a, colourRgbaNormalised, name); }
 		inline std::shared_ptr<MonoSpaceTextureAtlas> createMonoSpaceTextureAtlas(const std::string& filePath, const uint32_t rowCount, const uint32_t columnCount) const { return std::make_shared<MonoSpaceTextureAtlas>(mLogicDevice, mPhysicalDevice, filePath, rowCount, columnCount); }
 		inline std::shared_ptr<IndexedTextureAtlas> createIndexedTextureAtlas(const char* atlasInfoFilePath, const char* atlasTextureDir) { return std::make_shared<IndexedTextureAtlas>(mLogicDevice, mPhysicalDevice, atlasInfoFilePath, atlasTextureDir); }
 
 		//-----Font-----
-		inline std::shared_ptr<FontBitmap> createFontBitmap(const char* filepath, const char* imageDir, ETextRenderMethod textRenderMethod) const { return std::make_shared<FontBitmap>(filepath, imageDir, textRenderMethod); }
+		inline std::shared_ptr<FontBitmap> createFontBitmap(const char* filepath, const char* imageDir, ETextRenderMethod textRenderMethod, const bool streamPages = false) const { return std::make_shared<FontBitmap>(filepath, imageDir, textRenderMethod, streamPages); }
 
 	private:
 		void createQueues(QueueFamilyIndices& queueFamilyIndices);
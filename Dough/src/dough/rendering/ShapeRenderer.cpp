@@ -12,6 +12,7 @@ namespace DOH {
 	std::unique_ptr<ShapeRenderer> ShapeRenderer::INSTANCE = nullptr;
 	const char* ShapeRenderer::QUAD_SHADER_PATH_VERT = "Dough/Dough/res/shaders/spv/QuadBatch.vert.spv";
 	const char* ShapeRenderer::QUAD_SHADER_PATH_FRAG = "Dough/Dough/res/shaders/spv/QuadBatch.frag.spv";
+	const char* ShapeRenderer::QUAD_INSTANCED_SHADER_PATH_VERT = "Dough/Dough/res/shaders/spv/QuadBatchInstanced.vert.spv";
 	const char* ShapeRenderer::CIRCLE_SHADER_PATH_VERT = "Dough/Dough/res/shaders/spv/CircleBatch.vert.spv";
 	const char* ShapeRenderer::CIRCLE_SHADER_PATH_FRAG = "Dough/Dough/res/shaders/spv/CircleBatch.frag.spv";
 	const char* ShapeRenderer::NAME_SHORT_HAND = "ShapeRdr";
@@ -20,12 +21,11 @@ namespace DOH {
 	ShapeRenderer::ShapeRenderer(RenderingContextVulkan& context)
 	:	mContext(context),
 		mDrawnQuadCount(0u),
-		mTruncatedQuadCount(0u),
 		mDrawnCircleCount(0u),
-		mTruncatedCircleCount(0u),
 		mTextureArrayDescSet(VK_NULL_HANDLE),
 		mWarnOnNullSceneCameraData(true),
-		mWarnOnNullUiCameraData(true)
+		mWarnOnNullUiCameraData(true),
+		mQuadInstancingEnabled(true)
 	{}
 
 	void ShapeRenderer::initImpl() {
@@ -83,6 +83,7 @@ namespace DOH {
 		mShapesDescSetsInstanceUi->setDescriptorSetSingle(1, mTextureArrayDescSet);
 
 		initQuad();
+		initQuadInstanced();
 		initCircle();
 		//initTriangle();
 	}
@@ -90,6 +91,26 @@ namespace DOH {
 	void ShapeRenderer::initQuad() {
 		ZoneScoped;
 
+		//Quad Index Buffer
+		std::vector<uint32_t> quadIndices;
+		quadIndices.resize(EBatchSizeLimits::QUAD_BATCH_INDEX_COUNT);
+		uint32_t vertexOffset = 0;
+		for (uint32_t i = 0; i < EBatchSizeLimits::QUAD_BATCH_INDEX_COUNT; i += EBatchSizeLimits::QUAD_INDEX_COUNT) {
+			quadIndices[i + 0] = vertexOffset + 0;
+			quadIndices[i + 1] = vertexOffset + 1;
+			quadIndices[i + 2] = vertexOffset + 2;
+
+			quadIndices[i + 3] = vertexOffset + 2;
+			quadIndices[i + 4] = vertexOffset + 3;
+			quadIndices[i + 5] = vertexOffset + 0;
+
+			vertexOffset += EBatchSizeLimits::QUAD_VERTEX_COUNT;
+		}
+		mQuadSharedIndexBuffer = mContext.createStagedIndexBuffer(
+			quadIndices.data(),
+			sizeof(uint32_t) * EBatchSizeLimits::QUAD_BATCH_INDEX_COUNT
+		);
+
 		{ //Scene
 			mQuadScene = { EShape::QUAD };
 
@@ -122,10 +143,17 @@ namespace DOH {
 			mQuadScene.Pipeline = mContext.createGraphicsPipeline(*mQuadScene.PipelineInstanceInfo);
 			mQuadScene.Pipeline->init(
 				mContext.getLogicDevice(),
-				mContext.getSwapChain().getExtent(),
 				mContext.getRenderPass(ERenderPass::APP_SCENE).get()
 			);
 			mQuadScene.DescriptorSetsInstance = mShapesDescSetsInstanceScene;
+			mQuadScene.Batches = std::make_unique<BatchManager<RenderBatchQuad>>(
+				EBatchSizeLimits::QUAD_BATCH_MAX_GEO_COUNT,
+				Quad::BYTE_SIZE,
+				EBatchSizeLimits::BATCH_MAX_COUNT_TEXTURE,
+				mQuadSharedIndexBuffer,
+				mQuadScene.DescriptorSetsInstance,
+				&mContext.getUploadRing()
+			);
 		}
 
 		{ //UI
@@ -159,31 +187,116 @@ namespace DOH {
 			mQuadUi.Pipeline = mContext.createGraphicsPipeline(*mQuadUi.PipelineInstanceInfo);
 			mQuadUi.Pipeline->init(
 				mContext.getLogicDevice(),
-				mContext.getSwapChain().getExtent(),
 				mContext.getRenderPass(ERenderPass::APP_UI).get()
 			);
 			mQuadUi.DescriptorSetsInstance = mShapesDescSetsInstanceUi;
+			mQuadUi.Batches = std::make_unique<BatchManager<RenderBatchQuad>>(
+				EBatchSizeLimits::QUAD_BATCH_MAX_GEO_COUNT,
+				Quad::BYTE_SIZE,
+				EBatchSizeLimits::BATCH_MAX_COUNT_TEXTURE,
+				mQuadSharedIndexBuffer,
+				mQuadUi.DescriptorSetsInstance,
+				&mContext.getUploadRing()
+			);
 		}
+	}
 
-		//Quad Index Buffer
-		std::vector<uint32_t> quadIndices;
-		quadIndices.resize(EBatchSizeLimits::QUAD_BATCH_INDEX_COUNT);
-		uint32_t vertexOffset = 0;
-		for (uint32_t i = 0; i < EBatchSizeLimits::QUAD_BATCH_INDEX_COUNT; i += EBatchSizeLimits::QUAD_INDEX_COUNT) {
-			quadIndices[i + 0] = vertexOffset + 0;
-			quadIndices[i + 1] = vertexOffset + 1;
-			quadIndices[i + 2] = vertexOffset + 2;
+	void ShapeRenderer::initQuadInstanced() {
+		ZoneScoped;
 
-			quadIndices[i + 3] = vertexOffset + 2;
-			quadIndices[i + 4] = vertexOffset + 3;
-			quadIndices[i + 5] = vertexOffset + 0;
+		//NOTE:: Instanced quads re-use the QuadBatch fragment shader, only the vertex stage differs.
+		// No index buffer is used, each instance is drawn as 6 vertices generated from gl_VertexIndex.
 
-			vertexOffset += EBatchSizeLimits::QUAD_VERTEX_COUNT;
+		{ //Scene
+			mQuadInstancedScene = { EShape::QUAD };
+
+			mQuadInstancedScene.VertexShader = mContext.createShader(EShaderStage::VERTEX, ShapeRenderer::QUAD_INSTANCED_SHADER_PATH_VERT);
+			mQuadInstancedScene.FragmentShader = mContext.createShader(EShaderStage::FRAGMENT, ShapeRenderer::QUAD_SHADER_PATH_FRAG);
+			mQuadInstancedScene.Program = mContext.createShaderProgram(
+				mQuadInstancedScene.VertexShader,
+				mQuadInstancedScene.FragmentShader,
+				mShapeDescSetLayouts
+			);
+
+			mQuadInstancedScene.PipelineInstanceInfo = std::make_unique<GraphicsPipelineInstanceInfo>(
+				StaticVertexInputLayout::get(QUAD_INSTANCE_INPUT_TYPE),
+				*mQuadInstancedScene.Program,
+				ERenderPass::APP_SCENE
+			);
+			auto& optionalFields = mQuadInstancedScene.PipelineInstanceInfo->enableOptionalFields();
+			optionalFields.VertexInputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+			optionalFields.setDepthTesting(true, VK_COMPARE_OP_LESS);
+			optionalFields.setBlending(
+				true,
+				VK_BLEND_OP_ADD,
+				VK_BLEND_FACTOR_SRC_ALPHA,
+				VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA,
+				VK_BLEND_OP_ADD,
+				VK_BLEND_FACTOR_SRC_ALPHA,
+				VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA
+			);
+			optionalFields.ClearRenderablesAfterDraw = false;
+
+			mQuadInstancedScene.Pipeline = mContext.createGraphicsPipeline(*mQuadInstancedScene.PipelineInstanceInfo);
+			mQuadInstancedScene.Pipeline->init(
+				mContext.getLogicDevice(),
+				mContext.getRenderPass(ERenderPass::APP_SCENE).get()
+			);
+			mQuadInstancedScene.DescriptorSetsInstance = mShapesDescSetsInstanceScene;
+			mQuadInstancedScene.Batches = std::make_unique<BatchManager<RenderBatchQuadInstanced>>(
+				EBatchSizeLimits::QUAD_BATCH_MAX_GEO_COUNT,
+				VertexQuadInstance3d::BYTE_SIZE,
+				EBatchSizeLimits::BATCH_MAX_COUNT_TEXTURE,
+				nullptr,
+				mQuadInstancedScene.DescriptorSetsInstance,
+				&mContext.getUploadRing()
+			);
+		}
+
+		{ //UI
+			mQuadInstancedUi = { EShape::QUAD };
+
+			mQuadInstancedUi.VertexShader = mContext.createShader(EShaderStage::VERTEX, ShapeRenderer::QUAD_INSTANCED_SHADER_PATH_VERT);
+			mQuadInstancedUi.FragmentShader = mContext.createShader(EShaderStage::FRAGMENT, ShapeRenderer::QUAD_SHADER_PATH_FRAG);
+			mQuadInstancedUi.Program = mContext.createShaderProgram(
+				mQuadInstancedUi.VertexShader,
+				mQuadInstancedUi.FragmentShader,
+				mShapeDescSetLayouts
+			);
+
+			mQuadInstancedUi.PipelineInstanceInfo = std::make_unique<GraphicsPipelineInstanceInfo>(
+				StaticVertexInputLayout::get(QUAD_INSTANCE_INPUT_TYPE),
+				*mQuadInstancedUi.Program,
+				ERenderPass::APP_UI
+			);
+			auto& optionalFieldsUi = mQuadInstancedUi.PipelineInstanceInfo->enableOptionalFields();
+			optionalFieldsUi.VertexInputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+			optionalFieldsUi.setBlending(
+				true,
+				VK_BLEND_OP_ADD,
+				VK_BLEND_FACTOR_SRC_ALPHA,
+				VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA,
+				VK_BLEND_OP_ADD,
+				VK_BLEND_FACTOR_SRC_ALPHA,
+				VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA
+			);
+			optionalFieldsUi.ClearRenderablesAfterDraw = false;
+
+			mQuadInstancedUi.Pipeline = mContext.createGraphicsPipeline(*mQuadInstancedUi.PipelineInstanceInfo);
+			mQuadInstancedUi.Pipeline->init(
+				mContext.getLogicDevice(),
+				mContext.getRenderPass(ERenderPass::APP_UI).get()
+			);
+			mQuadInstancedUi.DescriptorSetsInstance = mShapesDescSetsInstanceUi;
+			mQuadInstancedUi.Batches = std::make_unique<BatchManager<RenderBatchQuadInstanced>>(
+				EBatchSizeLimits::QUAD_BATCH_MAX_GEO_COUNT,
+				VertexQuadInstance3d::BYTE_SIZE,
+				EBatchSizeLimits::BATCH_MAX_COUNT_TEXTURE,
+				nullptr,
+				mQuadInstancedUi.DescriptorSetsInstance,
+				&mContext.getUploadRing()
+			);
 		}
-		mQuadSharedIndexBuffer = mContext.createStagedIndexBuffer(
-			quadIndices.data(),
-			sizeof(uint32_t) * EBatchSizeLimits::QUAD_BATCH_INDEX_COUNT
-		);
 	}
 
 	void ShapeRenderer::initCircle() {
@@ -217,10 +330,17 @@ namespace DOH {
 			mCircleScene.Pipeline = mContext.createGraphicsPipeline(*mCircleScene.PipelineInstanceInfo);
 			mCircleScene.Pipeline->init(
 				mContext.getLogicDevice(),
-				mContext.getSwapChain().getExtent(),
 				mContext.getRenderPassScene().get()
 			);
 			mCircleScene.DescriptorSetsInstance = mShapesDescSetsInstanceScene;
+			mCircleScene.Batches = std::make_unique<BatchManager<RenderBatchCircle>>(
+				EBatchSizeLimits::CIRCLE_BATCH_MAX_GEO_COUNT,
+				Circle::BYTE_SIZE,
+				EBatchSizeLimits::CIRCLE_MAX_COUNT_TEXTURE,
+				mQuadSharedIndexBuffer,
+				mCircleScene.DescriptorSetsInstance,
+				&mContext.getUploadRing()
+			);
 		}
 
 		{ //UI
@@ -251,10 +371,17 @@ namespace DOH {
 			mCircleUi.Pipeline = mContext.createGraphicsPipeline(*mCircleUi.PipelineInstanceInfo);
 			mCircleUi.Pipeline->init(
 				mContext.getLogicDevice(),
-				mContext.getSwapChain().getExtent(),
 				mContext.getRenderPassUi().get()
 			);
 			mCircleUi.DescriptorSetsInstance = mShapesDescSetsInstanceUi;
+			mCircleUi.Batches = std::make_unique<BatchManager<RenderBatchCircle>>(
+				EBatchSizeLimits::CIRCLE_BATCH_MAX_GEO_COUNT,
+				Circle::BYTE_SIZE,
+				EBatchSizeLimits::CIRCLE_MAX_COUNT_TEXTURE,
+				mQuadSharedIndexBuffer,
+				mCircleUi.DescriptorSetsInstance,
+				&mContext.getUploadRing()
+			);
 		}
 	}
 
@@ -263,6 +390,8 @@ namespace DOH {
 
 		mQuadScene.addOwnedResourcesToClose(mContext);
 		mQuadUi.addOwnedResourcesToClose(mContext);
+		mQuadInstancedScene.addOwnedResourcesToClose(mContext);
+		mQuadInstancedUi.addOwnedResourcesToClose(mContext);
 		mCircleScene.addOwnedResourcesToClose(mContext);
 		mCircleUi.addOwnedResourcesToClose(mContext);
 		mContext.addGpuResourceToClose(mTestMonoSpaceTextureAtlas);
@@ -270,27 +399,31 @@ namespace DOH {
 		mContext.addGpuResourceToClose(mQuadSharedIndexBuffer);
 	}
 
-	void ShapeRenderer::onSwapChainResizeImpl(SwapChainVulkan& swapChain) {
+	void ShapeRenderer::onRenderPassesRecreatedImpl() {
 		ZoneScoped;
 
-		mQuadScene.Pipeline->resize(
+		mQuadScene.Pipeline->recreate(
 			mContext.getLogicDevice(),
-			swapChain.getExtent(),
 			mContext.getRenderPassScene().get()
 		);
-		mQuadUi.Pipeline->resize(
+		mQuadUi.Pipeline->recreate(
 			mContext.getLogicDevice(),
-			swapChain.getExtent(),
 			mContext.getRenderPassUi().get()
 		);
-		mCircleScene.Pipeline->resize(
+		mQuadInstancedScene.Pipeline->recreate(
 			mContext.getLogicDevice(),
-			swapChain.getExtent(),
 			mContext.getRenderPassScene().get()
 		);
-		mCircleUi.Pipeline->resize(
+		mQuadInstancedUi.Pipeline->recreate(
+			mContext.getLogicDevice(),
+			mContext.getRenderPassUi().get()
+		);
+		mCircleScene.Pipeline->recreate(
+			mContext.getLogicDevice(),
+			mContext.getRenderPassScene().get()
+		);
+		mCircleUi.Pipeline->recreate(
 			mContext.getLogicDevice(),
-			swapChain.getExtent(),
 			mContext.getRenderPassUi().get()
 		);
 	}
@@ -305,190 +438,57 @@ namespace DOH {
 		DescriptorApiVulkan::updateDescriptorSet(mContext.getLogicDevice(), texArrUpdate);
 	}
 
-	void ShapeRenderer::drawQuad(ShapeRenderingObjects<RenderBatchQuad>& quadGroup, const Quad& quad) {
-		ZoneScoped;
+	uint32_t ShapeRenderer::getTextureSlotIndexOrAdd(TextureVulkan& texture) {
+		//NOTE:: addNewTexture returns the existing slot if the texture is already in the array, or 0 (blank white texture) when full.
+		// Single hashed lookup for the common case of the texture already being in the array.
+		return mTextureArray->addNewTexture(texture);
+	}
 
-		bool added = false;
-		for (uint32_t i = 0; i < quadGroup.getBatchCount(); i++) {
-			RenderBatchQuad& batch = *quadGroup.GeoBatches[i];
-			if (batch.hasSpace(1)) {
-				batch.add(quad, 0);
-				added = true;
-				mDrawnQuadCount++;
-				break;
-			}
-		}
+	template<typename TQuadBatch>
+	void ShapeRenderer::drawQuad(ShapeRenderingObjects<TQuadBatch>& quadGroup, const Quad& quad) {
+		ZoneScoped;
 
-		if (!added) {
-			if (quadGroup.getBatchCount() == EBatchSizeLimits::QUAD_MAX_BATCH_COUNT) {
-				mTruncatedQuadCount++;
-				return;
-			} else {
-				const size_t batchIndex = createNewBatchQuad(quadGroup);
-				if (batchIndex == -1) {
-					LOG_ERR("Failed to add new Quad Batch");
-					mTruncatedQuadCount++;
-					return;
-				} else {
-					quadGroup.GeoBatches[batchIndex]->add(quad, 0);
-					mDrawnQuadCount++;
-				}
-			}
-		}
+		quadGroup.Batches->add(quad, 0);
+		mDrawnQuadCount++;
 	}
 
-	void ShapeRenderer::drawQuadTextured(ShapeRenderingObjects<RenderBatchQuad>& quadGroup, const Quad& quad) {
+	template<typename TQuadBatch>
+	void ShapeRenderer::drawQuadTextured(ShapeRenderingObjects<TQuadBatch>& quadGroup, const Quad& quad) {
 		ZoneScoped;
 
-		bool added = false;
-
 		if (!quad.hasTexture()) {
 			LOG_ERR("Quad does not have texture");
 			return;
 		}
 
-		for (uint32_t i = 0; i < quadGroup.getBatchCount(); i++) {
-			RenderBatchQuad& batch = *quadGroup.GeoBatches[i];
-			if (batch.hasSpace(1)) {
-				if (mTextureArray->hasTextureId(quad.getTexture().getId())) {
-					batch.add(quad, mTextureArray->getTextureSlotIndex(quad.getTexture().getId()));
-					added = true;
-					mDrawnQuadCount++;
-					break;
-				} else if (mTextureArray->hasTextureSlotAvailable()) {
-					const uint32_t textureSlot = mTextureArray->addNewTexture(quad.getTexture());
-					batch.add(quad, textureSlot);
-					added = true;
-					mDrawnQuadCount++;
-					break;
-				}
-			}
-		}
-
-		if (!added) {
-			if (quadGroup.getBatchCount() == EBatchSizeLimits::QUAD_MAX_BATCH_COUNT) {
-				mTruncatedQuadCount++;
-				return;
-			} else {
-				const size_t batchIndex = createNewBatchQuad(quadGroup);
-				if (batchIndex != -1) {
-					uint32_t textureSlot = 0;
-					if (mTextureArray->hasTextureId(quad.getTexture().getId())) {
-						textureSlot = mTextureArray->getTextureSlotIndex(quad.getTexture().getId());
-					} else if (mTextureArray->hasTextureSlotAvailable()) {
-						textureSlot = mTextureArray->addNewTexture(quad.getTexture());
-					}
-					quadGroup.GeoBatches[batchIndex]->add(quad, textureSlot);
-					added = true;
-					mDrawnQuadCount++;
-				} else {
-					mTruncatedQuadCount++;
-					return;
-				}
-			}
-		}
+		quadGroup.Batches->add(quad, getTextureSlotIndexOrAdd(quad.getTexture()));
+		mDrawnQuadCount++;
 	}
 
-	void ShapeRenderer::drawQuadArray(ShapeRenderingObjects<RenderBatchQuad>& quadGroup, const std::vector<Quad>& quadArr) {
+	template<typename TQuadBatch>
+	void ShapeRenderer::drawQuadArray(ShapeRenderingObjects<TQuadBatch>& quadGroup, const std::vector<Quad>& quadArr) {
 		ZoneScoped;
 
-		const size_t arrSize = quadArr.size();
-
-		uint32_t quadBatchStartIndex = 0;
-
-		for (size_t addedCount = 0; addedCount < arrSize; /* addedCount is changed inside loop, breaks loop when no more space or all geo is added */) {
-			const Quad& quad = quadArr[addedCount];
-			bool added = false;
-
-			for (uint32_t batchIndex = quadBatchStartIndex; batchIndex < quadGroup.getBatchCount(); batchIndex++) {
-				RenderBatchQuad& batch = *quadGroup.GeoBatches[batchIndex];
-				if (batch.hasSpace(1)) {
-					batch.add(quad, 0);
-					added = true;
-					addedCount++;
-					mDrawnQuadCount++;
-					break;
-				} else {
-					quadBatchStartIndex++;
-				}
-			}
-
-			if (!added) {
-				if (quadGroup.getBatchCount() == EBatchSizeLimits::QUAD_MAX_BATCH_COUNT) {
-					mTruncatedQuadCount += static_cast<uint32_t>(arrSize - addedCount);
-					return;
-				} else {
-					const size_t batchIndex = createNewBatchQuad(quadGroup);
-					if (batchIndex != -1) {
-						quadGroup.GeoBatches[batchIndex]->add(quad, 0);
-						addedCount++;
-						mDrawnQuadCount++;
-					} else {
-						mTruncatedQuadCount += static_cast<uint32_t>(arrSize - addedCount);
-						break;
-					}
-				}
-			}
-		}
+		quadGroup.Batches->addAll(quadArr, 0);
+		mDrawnQuadCount += static_cast<uint32_t>(quadArr.size());
 	}
 
-	void ShapeRenderer::drawQuadArrayTextured(ShapeRenderingObjects<RenderBatchQuad>& quadGroup, const std::vector<Quad>& quadArr) {
+	template<typename TQuadBatch>
+	void ShapeRenderer::drawQuadArrayTextured(ShapeRenderingObjects<TQuadBatch>& quadGroup, const std::vector<Quad>& quadArr) {
 		ZoneScoped;
 
-		const size_t arrSize = quadArr.size();
-		TextureArray& texArr = *mTextureArray;
-
-		uint32_t quadBatchStartIndex = 0;
-
-		for (size_t addedCount = 0; addedCount < arrSize; /* addedCount is changed inside loop, breaks loop when no more space or all quads added */) {
-			const Quad& quad = quadArr[addedCount];
-			bool added = false;
-
-			const uint32_t textureSlotIndex =
-				texArr.hasTextureId(quad.getTexture().getId()) ?
-				texArr.getTextureSlotIndex(quad.getTexture().getId()) :
-				texArr.hasTextureSlotAvailable() ?
-				texArr.addNewTexture(quad.getTexture()) :
-				0;
-
-			for (uint32_t batchIndex = quadBatchStartIndex; batchIndex < quadGroup.getBatchCount(); batchIndex++) {
-				RenderBatchQuad& batch = *quadGroup.GeoBatches[batchIndex];
-				if (batch.hasSpace(1)) {
-					batch.add(quad, textureSlotIndex);
-					addedCount++;
-					added = true;
-					mDrawnQuadCount++;
-					break;
-				} else {
-					quadBatchStartIndex++;
-				}
-			}
-
-			if (!added) {
-				if (quadGroup.getBatchCount() == EBatchSizeLimits::QUAD_MAX_BATCH_COUNT) {
-					mTruncatedQuadCount += static_cast<uint32_t>(arrSize - addedCount);
-					return;
-				} else {
-					const size_t batchIndex = createNewBatchQuad(quadGroup);
-					if (batchIndex != -1) {
-						quadGroup.GeoBatches[batchIndex]->add(quad, textureSlotIndex);
-						addedCount++;
-						mDrawnQuadCount++;
-					} else {
-						mTruncatedQuadCount += static_cast<uint32_t>(arrSize - addedCount);
-						break;
-					}
-				}
-			}
+		BatchManager<TQuadBatch>& batches = *quadGroup.Batches;
+		for (const Quad& quad : quadArr) {
+			batches.add(quad, getTextureSlotIndexOrAdd(quad.getTexture()));
 		}
+		mDrawnQuadCount += static_cast<uint32_t>(quadArr.size());
 	}
 
-	void ShapeRenderer::drawQuadArraySameTexture(ShapeRenderingObjects<RenderBatchQuad>& quadGroup, const std::vector<Quad>& quadArr) {
+	template<typename TQuadBatch>
+	void ShapeRenderer::drawQuadArraySameTexture(ShapeRenderingObjects<TQuadBatch>& quadGroup, const std::vector<Quad>& quadArr) {
 		ZoneScoped;
 
-		size_t addedCount = 0;
-		const size_t arrSize = quadArr.size();
-		if (arrSize == 0) {
+		if (quadArr.size() == 0) {
 			//TODO:: Is this worth a warning?
 			//LOG_WARN("drawQuadArraySameTextureScene() quadArr size = 0");
 			return;
@@ -496,662 +496,216 @@ namespace DOH {
 			LOG_ERR("Quad array does not have texture");
 			return;
 		}
-		const uint32_t textureId = quadArr[0].getTexture().getId();
-		TextureArray& texArr = *mTextureArray;
-
-		uint32_t textureSlotIndex = 0;
-		if (texArr.hasTextureId(textureId)) {
-			textureSlotIndex = texArr.getTextureSlotIndex(textureId);
-		} else if (texArr.hasTextureSlotAvailable()) {
-			textureSlotIndex = texArr.addNewTexture(quadArr[0].getTexture());
-		}
-
-		uint32_t quadBatchStartIndex = 0;
-
-		for (size_t addedCount = 0; addedCount < arrSize; /* addedCount is changed inside loop, breaks loop when no more space */) {
-			const Quad& quad = quadArr[addedCount];
-
-			for (uint32_t batchIndex = quadBatchStartIndex; batchIndex < quadGroup.getBatchCount(); batchIndex++) {
-				RenderBatchQuad& batch = *quadGroup.GeoBatches[batchIndex];
-				const size_t remainingSpace = batch.getRemainingGeometrySpace();
-				const size_t toAddCount = arrSize - addedCount;
-				if (remainingSpace >= toAddCount) {
-					batch.addAll(
-						quadArr,
-						addedCount,
-						addedCount + toAddCount,
-						texArr.getTextureSlotIndex(textureId)
-					);
-					addedCount += toAddCount;
-					mDrawnQuadCount += static_cast<uint32_t>(toAddCount);
-					break;
-				} else if (remainingSpace > 0) {
-					batch.addAll(
-						quadArr,
-						addedCount,
-						addedCount + remainingSpace,
-						texArr.getTextureSlotIndex(textureId)
-					);
-					addedCount += remainingSpace;
-					mDrawnQuadCount += static_cast<uint32_t>(remainingSpace);
-				} else {
-					quadBatchStartIndex++;
-				}
-			}
 
-			if (addedCount < arrSize) {
-				if (quadGroup.getBatchCount() == EBatchSizeLimits::QUAD_MAX_BATCH_COUNT) {
-					mTruncatedQuadCount += static_cast<uint32_t>(arrSize - addedCount);
-					return;
-				} else {
-					const size_t batchIndex = createNewBatchQuad(quadGroup);
-					if (batchIndex != -1) {
-						RenderBatchQuad& batch = *quadGroup.GeoBatches[batchIndex];
-						const size_t remainingSpace = batch.getRemainingGeometrySpace();
-						const size_t toAddCount = arrSize - addedCount;
-						if (remainingSpace >= toAddCount) {
-							batch.addAll(quadArr, 0, toAddCount, textureSlotIndex);
-							addedCount += toAddCount;
-							mDrawnQuadCount += static_cast<uint32_t>(toAddCount);
-							break;
-						} else {
-							batch.addAll(quadArr, addedCount, addedCount + remainingSpace, textureSlotIndex);
-							addedCount += remainingSpace;
-							mDrawnQuadCount += static_cast<uint32_t>(remainingSpace);
-						}
-					} else {
-						mTruncatedQuadCount += static_cast<uint32_t>(arrSize - addedCount);
-						break;
-					}
-				}
-			}
-		}
+		quadGroup.Batches->addAll(quadArr, getTextureSlotIndexOrAdd(quadArr[0].getTexture()));
+		mDrawnQuadCount += static_cast<uint32_t>(quadArr.size());
 	}
 
+	template void ShapeRenderer::drawQuad<RenderBatchQuad>(ShapeRenderingObjects<RenderBatchQuad>&, const Quad&);
+	template void ShapeRenderer::drawQuadTextured<RenderBatchQuad>(ShapeRenderingObjects<RenderBatchQuad>&, const Quad&);
+	template void ShapeRenderer::drawQuadArray<RenderBatchQuad>(ShapeRenderingObjects<RenderBatchQuad>&, const std::vector<Quad>&);
+	template void ShapeRenderer::drawQuadArrayTextured<RenderBatchQuad>(ShapeRenderingObjects<RenderBatchQuad>&, const std::vector<Quad>&);
+	template void ShapeRenderer::drawQuadArraySameTexture<RenderBatchQuad>(ShapeRenderingObjects<RenderBatchQuad>&, const std::vector<Quad>&);
+	template void ShapeRenderer::drawQuad<RenderBatchQuadInstanced>(ShapeRenderingObjects<RenderBatchQuadInstanced>&, const Quad&);
+	template void ShapeRenderer::drawQuadTextured<RenderBatchQuadInstanced>(ShapeRenderingObjects<RenderBatchQuadInstanced>&, const Quad&);
+	template void ShapeRenderer::drawQuadArray<RenderBatchQuadInstanced>(ShapeRenderingObjects<RenderBatchQuadInstanced>&, const std::vector<Quad>&);
+	template void ShapeRenderer::drawQuadArrayTextured<RenderBatchQuadInstanced>(ShapeRenderingObjects<RenderBatchQuadInstanced>&, const std::vector<Quad>&);
+	template void ShapeRenderer::drawQuadArraySameTexture<RenderBatchQuadInstanced>(ShapeRenderingObjects<RenderBatchQuadInstanced>&, const std::vector<Quad>&);
+
 	void ShapeRenderer::drawCircle(ShapeRenderingObjects<RenderBatchCircle>& circleGroup, const Circle& circle) {
 		ZoneScoped;
 
-		bool added = false;
-		for (uint32_t i = 0; i < circleGroup.getBatchCount(); i++) {
-			RenderBatchCircle& batch = *circleGroup.GeoBatches[i];
-			if (batch.hasSpace(1)) {
-				batch.add(circle, 0);
-				added = true;
-				mDrawnCircleCount++;
-				break;
-			}
-		}
-
-		if (!added) {
-			if (circleGroup.getBatchCount() == EBatchSizeLimits::CIRCLE_MAX_BATCH_COUNT) {
-				mTruncatedCircleCount++;
-				return;
-			} else {
-				const size_t batchIndex = createNewBatchCircle(circleGroup);
-				if (batchIndex == -1) {
-					LOG_ERR("Failed to add new Circle Batch");
-					mTruncatedQuadCount++;
-					return;
-				} else {
-					circleGroup.GeoBatches[batchIndex]->add(circle, 0);
-					mDrawnQuadCount++;
-				}
-			}
-		}
+		circleGroup.Batches->add(circle, 0);
+		mDrawnCircleCount++;
 	}
 
 	void ShapeRenderer::drawCircleTextured(ShapeRenderingObjects<RenderBatchCircle>& circleGroup, const Circle& circle) {
 		ZoneScoped;
 
-		bool added = false;
-
 		if (!circle.hasTexture()) {
 			LOG_ERR("Circle does not have texture");
 			return;
 		}
 
-		for (uint32_t i = 0; i < circleGroup.getBatchCount(); i++) {
-			RenderBatchCircle& batch = *circleGroup.GeoBatches[i];
-			if (batch.hasSpace(1)) {
-				if (mTextureArray->hasTextureId(circle.getTexture().getId())) {
-					batch.add(circle, mTextureArray->getTextureSlotIndex(circle.getTexture().getId()));
-					added = true;
-					mDrawnCircleCount++;
-					break;
-				} else if (mTextureArray->hasTextureSlotAvailable()) {
-					const uint32_t textureSlot = mTextureArray->addNewTexture(circle.getTexture());
-					batch.add(circle, textureSlot);
-					added = true;
-					mDrawnCircleCount++;
-					break;
-				}
-			}
-		}
-
-		if (!added) {
-			if (circleGroup.getBatchCount() == EBatchSizeLimits::CIRCLE_MAX_BATCH_COUNT) {
-				mTruncatedCircleCount++;
-				return;
-			} else {
-				const size_t batchIndex = createNewBatchCircle(circleGroup);
-				if (batchIndex != -1) {
-					uint32_t textureSlot = 0;
-					if (mTextureArray->hasTextureId(circle.getTexture().getId())) {
-						textureSlot = mTextureArray->getTextureSlotIndex(circle.getTexture().getId());
-					} else if (mTextureArray->hasTextureSlotAvailable()) {
-						textureSlot = mTextureArray->addNewTexture(circle.getTexture());
-					}
-					circleGroup.GeoBatches[batchIndex]->add(circle, textureSlot);
-					added = true;
-					mDrawnCircleCount++;
-				} else {
-					mTruncatedCircleCount++;
-					return;
-				}
-			}
-		}	
+		circleGroup.Batches->add(circle, getTextureSlotIndexOrAdd(circle.getTexture()));
+		mDrawnCircleCount++;
 	}
 
 	void ShapeRenderer::drawCircleArray(ShapeRenderingObjects<RenderBatchCircle>& circleGroup, const std::vector<Circle>& circleArr) {
 		ZoneScoped;
 
-		const size_t arrSize = circleArr.size();
-
-		uint32_t circleBatchStartIndex = 0;
-
-		for (size_t addedCount = 0; addedCount < arrSize; /* addedCount is changed inside loop, breaks loop when no more space or all geo is added */) {
-			const Circle& circle = circleArr[addedCount];
-			bool added = false;
-
-			for (uint32_t batchIndex = circleBatchStartIndex; batchIndex < circleGroup.getBatchCount(); batchIndex++) {
-				RenderBatchCircle& batch = *circleGroup.GeoBatches[batchIndex];
-				if (batch.hasSpace(1)) {
-					batch.add(circle, 0);
-					added = true;
-					addedCount++;
-					mDrawnCircleCount++;
-					break;
-				} else {
-					circleBatchStartIndex++;
-				}
-			}
-
-			if (!added) {
-				if (circleGroup.getBatchCount() == EBatchSizeLimits::CIRCLE_MAX_BATCH_COUNT) {
-					mTruncatedCircleCount += static_cast<uint32_t>(arrSize - addedCount);
-					return;
-				} else {
-					const size_t batchIndex = createNewBatchCircle(circleGroup);
-					if (batchIndex != -1) {
-						circleGroup.GeoBatches[batchIndex]->add(circle, 0);
-						addedCount++;
-						mDrawnCircleCount++;
-					} else {
-						mTruncatedCircleCount += static_cast<uint32_t>(arrSize - addedCount);
-						break;
-					}
-				}
-			}
-		}
+		circleGroup.Batches->addAll(circleArr, 0);
+		mDrawnCircleCount += static_cast<uint32_t>(circleArr.size());
 	}
 
 	void ShapeRenderer::drawCircleArrayTextured(ShapeRenderingObjects<RenderBatchCircle>& circleGroup, const std::vector<Circle>& circleArr) {
 		ZoneScoped;
 
-		const size_t arrSize = circleArr.size();
-
-		uint32_t circleBatchStartIndex = 0;
-
-		for (size_t addedCount = 0; addedCount < arrSize; /* addedCount is changed inside loop, breaks loop when no more space or all quads added */) {
-			const Circle& circle = circleArr[addedCount];
-			bool added = false;
-
-			const uint32_t textureSlotIndex =
-				mTextureArray->hasTextureId(circle.getTexture().getId()) ?
-				mTextureArray->getTextureSlotIndex(circle.getTexture().getId()) :
-				mTextureArray->hasTextureSlotAvailable() ?
-				mTextureArray->addNewTexture(circle.getTexture()) :
-				0;
-
-			for (uint32_t batchIndex = circleBatchStartIndex; batchIndex < circleGroup.getBatchCount(); batchIndex++) {
-				RenderBatchCircle& batch = *circleGroup.GeoBatches[batchIndex];
-				if (batch.hasSpace(1)) {
-					batch.add(circle, textureSlotIndex);
-					addedCount++;
-					added = true;
-					mDrawnCircleCount++;
-					break;
-				} else {
-					circleBatchStartIndex++;
-				}
-			}
-
-			if (!added) {
-				if (circleGroup.getBatchCount() == EBatchSizeLimits::CIRCLE_MAX_BATCH_COUNT) {
-					mTruncatedCircleCount += static_cast<uint32_t>(arrSize - addedCount);
-					return;
-				} else {
-					const size_t batchIndex = createNewBatchCircle(circleGroup);
-					if (batchIndex != -1) {
-						circleGroup.GeoBatches[batchIndex]->add(circle, textureSlotIndex);
-						addedCount++;
-						mDrawnCircleCount++;
-					} else {
-						mTruncatedCircleCount += static_cast<uint32_t>(arrSize - addedCount);
-						break;
-					}
-				}
-			}
+		BatchManager<RenderBatchCircle>& batches = *circleGroup.Batches;
+		for (const Circle& circle : circleArr) {
+			batches.add(circle, getTextureSlotIndexOrAdd(circle.getTexture()));
 		}
+		mDrawnCircleCount += static_cast<uint32_t>(circleArr.size());
 	}
 
 	void ShapeRenderer::drawCircleArraySameTexture(ShapeRenderingObjects<RenderBatchCircle>& circleGroup, const std::vector<Circle>& circleArr) {
 		ZoneScoped;
 
-		size_t addedCount = 0;
-		const size_t arrSize = circleArr.size();
-		if (arrSize == 0) {
+		if (circleArr.size() == 0) {
 			//TODO:: Is this worth a warning?
-			//LOG_WARN("drawQuadArraySameTextureScene() quadArr size = 0");
+			//LOG_WARN("drawCircleArraySameTextureScene() circleArr size = 0");
 			return;
 		} else if (!circleArr[0].hasTexture()) {
-			LOG_ERR("Quad array does not have texture");
+			LOG_ERR("Circle array does not have texture");
 			return;
 		}
-		const uint32_t textureId = circleArr[0].getTexture().getId();
-		TextureArray& texArr = *mTextureArray;
-
-		uint32_t textureSlotIndex = 0;
-		if (texArr.hasTextureId(textureId)) {
-			textureSlotIndex = texArr.getTextureSlotIndex(textureId);
-		} else if (texArr.hasTextureSlotAvailable()) {
-			textureSlotIndex = texArr.addNewTexture(circleArr[0].getTexture());
-		}
 
-		uint32_t circleBatchStartIndex = 0;
-
-		for (size_t addedCount = 0; addedCount < arrSize; /* addedCount is changed inside loop, breaks loop when no more space */) {
-			const Circle& quad = circleArr[addedCount];
-
-			for (uint32_t batchIndex = circleBatchStartIndex; batchIndex < circleGroup.getBatchCount(); batchIndex++) {
-				RenderBatchCircle& batch = *circleGroup.GeoBatches[batchIndex];
-				const size_t remainingSpace = batch.getRemainingGeometrySpace();
-				const size_t toAddCount = arrSize - addedCount;
-				if (remainingSpace >= toAddCount) {
-					batch.addAll(
-						circleArr,
-						addedCount,
-						addedCount + toAddCount,
-						texArr.getTextureSlotIndex(textureId)
-					);
-					addedCount += toAddCount;
-					mDrawnCircleCount += static_cast<uint32_t>(toAddCount);
-					break;
-				} else if (remainingSpace > 0) {
-					batch.addAll(
-						circleArr,
-						addedCount,
-						addedCount + remainingSpace,
-						texArr.getTextureSlotIndex(textureId)
-					);
-					addedCount += remainingSpace;
-					mDrawnCircleCount += static_cast<uint32_t>(remainingSpace);
-				} else {
-					circleBatchStartIndex++;
-				}
-			}
-
-			if (addedCount < arrSize) {
-				if (circleGroup.getBatchCount() == EBatchSizeLimits::CIRCLE_MAX_BATCH_COUNT) {
-					mTruncatedCircleCount += static_cast<uint32_t>(arrSize - addedCount);
-					return;
-				} else {
-					const size_t batchIndex = createNewBatchCircle(circleGroup);
-					if (batchIndex != -1) {
-						RenderBatchCircle& batch = *circleGroup.GeoBatches[batchIndex];
-						const size_t remainingSpace = batch.getRemainingGeometrySpace();
-						const size_t toAddCount = arrSize - addedCount;
-						if (remainingSpace >= toAddCount) {
-							batch.addAll(circleArr, 0, toAddCount, textureSlotIndex);
-							addedCount += toAddCount;
-							mDrawnQuadCount += static_cast<uint32_t>(toAddCount);
-							break;
-						} else {
-							batch.addAll(circleArr, addedCount, addedCount + remainingSpace, textureSlotIndex);
-							addedCount += remainingSpace;
-							mDrawnQuadCount += static_cast<uint32_t>(remainingSpace);
-						}
-					} else {
-						mTruncatedQuadCount += static_cast<uint32_t>(arrSize - addedCount);
-						break;
-					}
-				}
-			}
-		}
+		circleGroup.Batches->addAll(circleArr, getTextureSlotIndexOrAdd(circleArr[0].getTexture()));
+		mDrawnCircleCount += static_cast<uint32_t>(circleArr.size());
 	}
 
-	void ShapeRenderer::drawSceneImpl(uint32_t imageIndex, VkCommandBuffer cmd, CurrentBindingsState& currentBindings) {
+	template<typename TBatch>
+	void ShapeRenderer::drawIndexedBatches(
+		ShapeRenderingObjects<TBatch>& group,
+		uint32_t imageIndex,
+		VkCommandBuffer cmd,
+		CurrentBindingsState& currentBindings,
+		uint32_t& drawCallCount
+	) {
 		ZoneScoped;
 
-		if (mSceneCameraData == nullptr) {
-			if (mWarnOnNullSceneCameraData) {
-				LOG_WARN("ShapeRenderer::drawSceneImpl mSceneCameraData is null");
-			}
-			return;
-		}
+		BatchManager<TBatch>& batches = *group.Batches;
 
-		VkDevice logicDevice = mContext.getLogicDevice();
-		AppDebugInfo& debugInfo = Application::get().getDebugInfo();
+		if (batches.upload(mContext) > 0) {
+			AppDebugInfo& debugInfo = Application::get().getDebugInfo();
+			debugInfo.ShapeRendererUploadBytes += batches.getLastUploadByteSize();
+			SimpleRenderable& renderable = batches.getRenderable();
+			VertexArrayVulkan& vao = renderable.getVao();
 
-		{ //Draw Quads
-			bool hasQuadToDraw = false;
-
-			for (uint32_t i = 0; i < mQuadScene.getBatchCount(); i++) {
-				RenderBatchQuad& batch = *mQuadScene.GeoBatches[i];
-				const uint32_t quadCount = static_cast<uint32_t>(batch.getGeometryCount());
-				
-				if (quadCount > 0) {
-					SimpleRenderable& batchRenderable = *mQuadScene.Renderables[i];
-					VertexArrayVulkan& vao = batchRenderable.getVao();
-
-					vao.getVertexBuffers()[0]->setDataMapped(
-						logicDevice,
-						batch.getData().data(),
-						quadCount * Quad::BYTE_SIZE
-					);
-					vao.setDrawCount(quadCount * EBatchSizeLimits::QUAD_INDEX_COUNT);
-
-					if (mQuadScene.Pipeline->get() != currentBindings.Pipeline) {
-						mQuadScene.Pipeline->bind(cmd);
-						currentBindings.Pipeline = mQuadScene.Pipeline->get();
-						debugInfo.PipelineBinds++;
-					}
-
-					if (mQuadSharedIndexBuffer->getBuffer() != currentBindings.IndexBuffer) {
-						mQuadSharedIndexBuffer->bind(cmd);
-						currentBindings.IndexBuffer = mQuadSharedIndexBuffer->getBuffer();
-						debugInfo.IndexBufferBinds++;
-					}
-
-					mQuadScene.Pipeline->recordDrawCommand(imageIndex, cmd, batchRenderable, currentBindings, 0);
-					debugInfo.SceneDrawCalls++;
-
-					batch.reset();
-				}
+			if (group.Pipeline->get() != currentBindings.Pipeline) {
+				group.Pipeline->bind(cmd);
+				currentBindings.Pipeline = group.Pipeline->get();
+				debugInfo.PipelineBinds++;
 			}
-		}
 
-		{ //Draw Circles
-			for (uint32_t i = 0; i < mCircleScene.getBatchCount(); i++) {
-				RenderBatchCircle& batch = *mCircleScene.GeoBatches[i];
-				const uint32_t geoCount = static_cast<uint32_t>(batch.getGeometryCount());
-				
+			//Each batch has its own upload ring allocation so the shared index buffer, which only covers a single batch, can be used as is.
+			//NOTE:: Quads and circles both use 6 indices per geometry.
+			for (uint32_t i = 0; i <= batches.getOpenBatchIndex(); i++) {
+				const uint32_t geoCount = static_cast<uint32_t>(batches.getBatches()[i]->getGeometryCount());
 				if (geoCount > 0) {
-					SimpleRenderable& batchRenderable = *mCircleScene.Renderables[i];
-					VertexArrayVulkan& vao = batchRenderable.getVao();
-		
-					vao.getVertexBuffers()[0]->setDataMapped(
-						logicDevice,
-						batch.getData().data(),
-						geoCount * Circle::BYTE_SIZE
-					);
-					vao.setDrawCount(geoCount * EBatchSizeLimits::CIRCLE_INDEX_COUNT);
-
-					if (mCircleScene.Pipeline->get() != currentBindings.Pipeline) {
-						mCircleScene.Pipeline->bind(cmd);
-						currentBindings.Pipeline = mCircleScene.Pipeline->get();
-						debugInfo.PipelineBinds++;
-					}
-
-					if (mQuadSharedIndexBuffer->getBuffer() != currentBindings.IndexBuffer) {
-						mQuadSharedIndexBuffer->bind(cmd);
-						currentBindings.IndexBuffer = mQuadSharedIndexBuffer->getBuffer();
-						debugInfo.IndexBufferBinds++;
-					}
-		
-					mCircleScene.Pipeline->recordDrawCommand(imageIndex, cmd, batchRenderable, currentBindings, 0);
-					debugInfo.SceneDrawCalls++;
-		
-					batch.reset();
+					const UploadRingAllocation& allocation = batches.getBatchAllocation(i);
+					vao.setSharedVertexBuffer(allocation.Buffer, allocation.Offset);
+					vao.setDrawCount(geoCount * EBatchSizeLimits::QUAD_INDEX_COUNT);
+
+					group.Pipeline->recordDrawCommand(imageIndex, cmd, renderable, currentBindings, 0);
+					drawCallCount++;
 				}
 			}
 		}
+
+		batches.endFrame();
 	}
 
-	void ShapeRenderer::drawUiImpl(uint32_t imageIndex, VkCommandBuffer cmd, CurrentBindingsState& currentBindings) {
+	void ShapeRenderer::drawInstancedBatches(
+		ShapeRenderingObjects<RenderBatchQuadInstanced>& group,
+		uint32_t imageIndex,
+		VkCommandBuffer cmd,
+		CurrentBindingsState& currentBindings,
+		uint32_t& drawCallCount
+	) {
 		ZoneScoped;
 
-		VkDevice logicDevice = mContext.getLogicDevice();
-		AppDebugInfo& debugInfo = Application::get().getDebugInfo();
+		BatchManager<RenderBatchQuadInstanced>& batches = *group.Batches;
 
-		if (mUiCameraData == nullptr) {
-			if (mWarnOnNullUiCameraData) {
-				LOG_WARN("ShapeRenderer::drawUiImpl mUiCameraData is null");
-			}
-			return;
-		}
+		if (batches.upload(mContext) > 0) {
+			AppDebugInfo& debugInfo = Application::get().getDebugInfo();
+			debugInfo.ShapeRendererUploadBytes += batches.getLastUploadByteSize();
+			SimpleRenderable& renderable = batches.getRenderable();
+			VertexArrayVulkan& vao = renderable.getVao();
 
-		{ //Draw Quads
-			for (uint32_t i = 0; i < mQuadUi.getBatchCount(); i++) {
-				RenderBatchQuad& batch = *mQuadUi.GeoBatches[i];
-				const uint32_t quadCount = static_cast<uint32_t>(batch.getGeometryCount());
-
-				if (quadCount > 0) {
-					SimpleRenderable& batchRenderable = *mQuadUi.Renderables[i];
-					VertexArrayVulkan& vao = batchRenderable.getVao();
-
-					vao.getVertexBuffers()[0]->setDataMapped(
-						logicDevice,
-						batch.getData().data(),
-						quadCount * Quad::BYTE_SIZE
-					);
-					vao.setDrawCount(quadCount * EBatchSizeLimits::QUAD_INDEX_COUNT);
-
-					if (mQuadUi.Pipeline->get() != currentBindings.Pipeline) {
-						mQuadUi.Pipeline->bind(cmd);
-						currentBindings.Pipeline = mQuadUi.Pipeline->get();
-						debugInfo.PipelineBinds++;
-					}
-
-					//TODO:: Renderable stores shared_ptr to index buffer and there's a check & bind for IB in recordDrawCommand, is this needed here?
-					if (mQuadSharedIndexBuffer->getBuffer() != currentBindings.IndexBuffer) {
-						mQuadSharedIndexBuffer->bind(cmd);
-						currentBindings.IndexBuffer = mQuadSharedIndexBuffer->getBuffer();
-						debugInfo.IndexBufferBinds++;
-					}
-
-					mQuadUi.Pipeline->recordDrawCommand(imageIndex, cmd, batchRenderable, currentBindings, 0);
-					debugInfo.UiDrawCalls++;
-
-					batch.reset();
-				}
+			vao.setDrawCount(EBatchSizeLimits::QUAD_INSTANCE_VERTEX_COUNT);
+
+			if (group.Pipeline->get() != currentBindings.Pipeline) {
+				group.Pipeline->bind(cmd);
+				currentBindings.Pipeline = group.Pipeline->get();
+				debugInfo.PipelineBinds++;
 			}
-		}
 
-		{ //Draw Circles
-			for (uint32_t i = 0; i < mCircleUi.getBatchCount(); i++) {
-				RenderBatchCircle& batch = *mCircleUi.GeoBatches[i];
-				const uint32_t geoCount = static_cast<uint32_t>(batch.getGeometryCount());
-			
-				if (geoCount > 0) {
-					SimpleRenderable& batchRenderable = *mCircleUi.Renderables[i];
-					VertexArrayVulkan& vao = batchRenderable.getVao();
-			
-					vao.getVertexBuffers()[0]->setDataMapped(
-						logicDevice,
-						batch.getData().data(),
-						geoCount * Circle::BYTE_SIZE
-					);
-					vao.setDrawCount(geoCount * EBatchSizeLimits::CIRCLE_INDEX_COUNT);
-
-					if (mCircleUi.Pipeline->get() != currentBindings.Pipeline) {
-						mCircleUi.Pipeline->bind(cmd);
-						currentBindings.Pipeline = mCircleUi.Pipeline->get();
-						debugInfo.PipelineBinds++;
-					}
-
-					if (mQuadSharedIndexBuffer->getBuffer() != currentBindings.IndexBuffer) {
-						mQuadSharedIndexBuffer->bind(cmd);
-						currentBindings.IndexBuffer = mQuadSharedIndexBuffer->getBuffer();
-						debugInfo.IndexBufferBinds++;
-					}
-			
-					mCircleUi.Pipeline->recordDrawCommand(imageIndex, cmd, batchRenderable, currentBindings, 0);
-					debugInfo.UiDrawCalls++;
-			
-					batch.reset();
+			//One instanced draw per batch, each batch's instances are in its own upload ring allocation
+			for (uint32_t i = 0; i <= batches.getOpenBatchIndex(); i++) {
+				const uint32_t instanceCount = static_cast<uint32_t>(batches.getBatches()[i]->getGeometryCount());
+				if (instanceCount > 0) {
+					const UploadRingAllocation& allocation = batches.getBatchAllocation(i);
+					vao.setSharedVertexBuffer(allocation.Buffer, allocation.Offset);
+					vao.setInstanceCount(instanceCount);
+
+					group.Pipeline->recordDrawCommand(imageIndex, cmd, renderable, currentBindings, 0);
+					drawCallCount++;
 				}
 			}
 		}
+
+		batches.endFrame();
 	}
 
-	size_t ShapeRenderer::createNewBatchQuad(ShapeRenderingObjects<RenderBatchQuad>& shapeRendering) {
+	void ShapeRenderer::drawSceneImpl(uint32_t imageIndex, VkCommandBuffer cmd, CurrentBindingsState& currentBindings) {
 		ZoneScoped;
 
-		if (shapeRendering.getBatchCount() < EBatchSizeLimits::QUAD_MAX_BATCH_COUNT) {
-			const size_t batchSizeBytes = static_cast<size_t>(EBatchSizeLimits::QUAD_BATCH_MAX_GEO_COUNT) * Quad::BYTE_SIZE;
-
-			std::shared_ptr<RenderBatchQuad> batch = std::make_shared<RenderBatchQuad>(
-				EBatchSizeLimits::QUAD_BATCH_MAX_GEO_COUNT,
-				EBatchSizeLimits::BATCH_MAX_COUNT_TEXTURE
-			);
-
-			if (batch == nullptr) {
-				return -1;
+		if (mSceneCameraData == nullptr) {
+			if (mWarnOnNullSceneCameraData) {
+				LOG_WARN("ShapeRenderer::drawSceneImpl mSceneCameraData is null");
 			}
 
-			shapeRendering.GeoBatches.emplace_back(batch);
-
-			std::shared_ptr<VertexArrayVulkan> vao = mContext.createVertexArray();
-			std::shared_ptr<VertexBufferVulkan> vbo = mContext.createVertexBuffer(
-				StaticVertexInputLayout::get(QUAD_VERTEX_INPUT_TYPE),
-				batchSizeBytes,
-				VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-				VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
-			);
-			vao->addVertexBuffer(vbo);
-			vao->setIndexBuffer(mQuadSharedIndexBuffer, true);
-			vao->getVertexBuffers()[0]->map(mContext.getLogicDevice(), batchSizeBytes);
+			//Discard this frame's geometry so the batch pools don't keep growing while nothing is drawn
+			mQuadScene.Batches->endFrame();
+			mQuadInstancedScene.Batches->endFrame();
+			mCircleScene.Batches->endFrame();
+			return;
+		}
 
-			shapeRendering.Renderables.emplace_back(std::make_shared<SimpleRenderable>(vao, shapeRendering.DescriptorSetsInstance));
+		AppDebugInfo& debugInfo = Application::get().getDebugInfo();
 
-			return shapeRendering.GeoBatches.size() - 1;
-		} else {
-			return -1;
-		}
+		drawIndexedBatches(mQuadScene, imageIndex, cmd, currentBindings, debugInfo.SceneDrawCalls);
+		drawInstancedBatches(mQuadInstancedScene, imageIndex, cmd, currentBindings, debugInfo.SceneDrawCalls);
+		drawIndexedBatches(mCircleScene, imageIndex, cmd, currentBindings, debugInfo.SceneDrawCalls);
 	}
 
-	size_t ShapeRenderer::createNewBatchCircle(ShapeRenderingObjects<RenderBatchCircle>& shapeRendering) {
+	void ShapeRenderer::drawUiImpl(uint32_t imageIndex, VkCommandBuffer cmd, CurrentBindingsState& currentBindings) {
 		ZoneScoped;
 
-		if (shapeRendering.getBatchCount() < EBatchSizeLimits::CIRCLE_MAX_BATCH_COUNT) {
-			const size_t batchSizeBytes = static_cast<size_t>(EBatchSizeLimits::CIRCLE_BATCH_MAX_GEO_COUNT) * Circle::BYTE_SIZE;
-
-			std::shared_ptr<RenderBatchCircle> batch = std::make_shared<RenderBatchCircle>(
-				EBatchSizeLimits::CIRCLE_BATCH_MAX_GEO_COUNT,
-				EBatchSizeLimits::CIRCLE_MAX_COUNT_TEXTURE
-			);
-
-			if (batch == nullptr) {
-				return -1;
+		if (mUiCameraData == nullptr) {
+			if (mWarnOnNullUiCameraData) {
+				LOG_WARN("ShapeRenderer::drawUiImpl mUiCameraData is null");
 			}
 
-			shapeRendering.GeoBatches.emplace_back(batch);
-
-			std::shared_ptr<VertexArrayVulkan> vao = mContext.createVertexArray();
-			std::shared_ptr<VertexBufferVulkan> vbo = mContext.createVertexBuffer(
-				StaticVertexInputLayout::get(CIRCLE_VERTEX_INPUT_TYPE),
-				batchSizeBytes,
-				VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-				VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
-			);
-			vao->addVertexBuffer(vbo);
-			vao->setIndexBuffer(mQuadSharedIndexBuffer, true);
-			vao->getVertexBuffers()[0]->map(mContext.getLogicDevice(), batchSizeBytes);
+			//Discard this frame's geometry so the batch pools don't keep growing while nothing is drawn
+			mQuadUi.Batches->endFrame();
+			mQuadInstancedUi.Batches->endFrame();
+			mCircleUi.Batches->endFrame();
+			return;
+		}
 
-			shapeRendering.Renderables.emplace_back(std::make_shared<SimpleRenderable>(vao, shapeRendering.DescriptorSetsInstance));
+		AppDebugInfo& debugInfo = Application::get().getDebugInfo();
 
-			return shapeRendering.GeoBatches.size() - 1;
-		} else {
-			return -1;
-		}
+		drawIndexedBatches(mQuadUi, imageIndex, cmd, currentBindings, debugInfo.UiDrawCalls);
+		drawInstancedBatches(mQuadInstancedUi, imageIndex, cmd, currentBindings, debugInfo.UiDrawCalls);
+		drawIndexedBatches(mCircleUi, imageIndex, cmd, currentBindings, debugInfo.UiDrawCalls);
 	}
 
 	void ShapeRenderer::closeEmptyQuadBatchesImpl() {
 		ZoneScoped;
 
-		//Since RenderBatches and renderables are linked through being the at the same index in their respective vector
-		// and batches are filled begining to end, loop through from end to begining closing batch and renderable's vao as it goes,
-		// stopping when there is a batch with a geo count of at least one
-
-		//TODO:: A better way of "linking" batches and vaos. pair<batch , vao> ?
-		const size_t batchCount = mQuadScene.GeoBatches.size();
-		if (batchCount != mQuadScene.Renderables.size()) {
-			LOG_WARN("Quad scene batches size doesn't match renderables count");
-		}
-
-		for (size_t i = batchCount; i > 0; i--) {
-			if (mQuadScene.GeoBatches[i - 1]->getGeometryCount() == 0) {
-				mQuadScene.GeoBatches.pop_back();
-				mContext.addGpuResourceToClose(mQuadScene.Renderables[i - 1]->getVaoPtr());
-				mQuadScene.Renderables.pop_back();
-			} else {
-				break;
-			}
-		}
-
-		const size_t uiBatchCount = mQuadUi.GeoBatches.size();
-		if (uiBatchCount != mQuadUi.Renderables.size()) {
-			LOG_WARN("Quad UI batches size doesn't match renderables count");
-		}
-
-		for (size_t i = uiBatchCount; i > 0; i--) {
-			if (mQuadUi.GeoBatches[i - 1]->getGeometryCount() == 0) {
-				mQuadUi.GeoBatches.pop_back();
-				mContext.addGpuResourceToClose(mQuadUi.Renderables[i - 1]->getVaoPtr());
-				mQuadUi.Renderables.pop_back();
-			} else {
-				break;
-			}
-		}
+		mQuadScene.Batches->shrinkToFit();
+		mQuadUi.Batches->shrinkToFit();
+		mQuadInstancedScene.Batches->shrinkToFit();
+		mQuadInstancedUi.Batches->shrinkToFit();
 	}
 
 	void ShapeRenderer::closeEmptyCircleBatchesImpl() {
 		ZoneScoped;
 
-		//Since RenderBatches and renderables are linked through being the at the same index in their respective vector
-		// and batches are filled begining to end, loop through from end to begining closing batch and renderable's vao as it goes,
-		// stopping when there is a batch with a geo count of at least one
-
-		const size_t batchCount = mCircleScene.GeoBatches.size();
-		if (batchCount != mCircleScene.Renderables.size()) {
-			LOG_WARN("Circle scene batches size doesn't match renderables count");
-		}
-
-		for (size_t i = batchCount; i > 0; i--) {
-			if (mCircleScene.GeoBatches[i - 1]->getGeometryCount() == 0) {
-				mCircleScene.GeoBatches.pop_back();
-				mContext.addGpuResourceToClose(mCircleScene.Renderables[i - 1]->getVaoPtr());
-				mCircleScene.Renderables.pop_back();
-			} else {
-				break;
-			}
-		}
-
-		const size_t uiBatchCount = mCircleUi.GeoBatches.size();
-		if (uiBatchCount != mCircleUi.Renderables.size()) {
-			LOG_WARN("Circle UI batches size doesn't match renderables count");
-		}
-		
-		for (size_t i = uiBatchCount; i > 0; i--) {
-			if (mCircleUi.GeoBatches[i - 1]->getGeometryCount() == 0) {
-				mCircleUi.GeoBatches.pop_back();
-				mContext.addGpuResourceToClose(mCircleUi.Renderables[i - 1]->getVaoPtr());
-				mCircleUi.Renderables.pop_back();
-			} else {
-				break;
-			}
-		}
+		mCircleScene.Batches->shrinkToFit();
+		mCircleUi.Batches->shrinkToFit();
 	}
 
 	void ShapeRenderer::init(RenderingContextVulkan& context) {
@@ -1173,11 +727,11 @@ namespace DOH {
 		}
 	}
 
-	void ShapeRenderer::onSwapChainResize(SwapChainVulkan& swapChain) {
+	void ShapeRenderer::onRenderPassesRecreated() {
 		if (INSTANCE != nullptr) {
-			INSTANCE->onSwapChainResizeImpl(swapChain);
+			INSTANCE->onRenderPassesRecreatedImpl();
 		} else {
-			LOG_WARN("Attempted onSwapChainResize when ShapeRenderer is un-initialised/closed.");
+			LOG_WARN("Attempted onRenderPassesRecreated when ShapeRenderer is un-initialised/closed.");
 		}
 	}
 
@@ -1209,9 +763,7 @@ namespace DOH {
 	void ShapeRenderer::resetLocalDebugInfo() {
 		//NOTE:: No nullptr check as this function is expected to be called each frame.
 		INSTANCE->mDrawnQuadCount = 0u;
-		INSTANCE->mTruncatedQuadCount = 0u;
 		INSTANCE->mDrawnCircleCount = 0u;
-		INSTANCE->mTruncatedCircleCount = 0u;
 	}
 
 	std::vector<DescriptorTypeInfo> ShapeRenderer::getEngineDescriptorTypeInfos() {
@@ -1235,6 +787,22 @@ namespace DOH {
 		mShapesDescSetsInstanceUi->setDescriptorSetArray(ShapeRenderer::CAMERA_UBO_SLOT, { cameraData->DescriptorSets[0], cameraData->DescriptorSets[1] });
 	}
 
+	template<typename TBatch>
+	void ShapeRenderer::drawBatchManagerImGui(const char* label, const BatchManager<TBatch>& batches) {
+		if (ImGui::CollapsingHeader(label)) {
+			ImGui::PushID(label);
+			ImGui::Text("Batch Count: %i (%i used last frame)", batches.getBatchCount(), batches.getLastFrameBatchCount());
+			ImGui::Text("GeoCount last frame: %i", batches.getLastFrameGeoCount());
+			ImGui::Text(
+				"Uploaded last frame: %.2f KiB (%s)",
+				static_cast<double>(batches.getLastUploadByteSize()) / 1024.0,
+				batches.isWritingToUploadRing() ? "written in place" : "copied"
+			);
+			ImGui::Text("Idle Frames: %i of %i", batches.getIdleFrameCount(), BatchManager<TBatch>::SHRINK_IDLE_FRAME_COUNT);
+			ImGui::PopID();
+		}
+	}
+
 	void ShapeRenderer::drawImGuiImpl(EImGuiContainerType type) {
 		ZoneScoped;
 
@@ -1252,59 +820,19 @@ namespace DOH {
 
 			//TODO:: Fill this out with info and controls.
 
-			if (ImGui::CollapsingHeader("Quad Scene")) {
-				ImGui::Text("Batch Count: %i", mQuadScene.getBatchCount());
-
-				int i = 0;
-				size_t totalGeoCount = 0;
-				for (std::shared_ptr<RenderBatchQuad> batch : mQuadScene.GeoBatches) {
-					size_t geoCount = batch->getGeometryCount();
-					ImGui::Text("Batch [%i] GeoCount: %i ", i, geoCount);
-					totalGeoCount += geoCount;
-				}
-				ImGui::Text("Total GeoCount: %i", totalGeoCount);
-			}
-
-			if (ImGui::CollapsingHeader("Quad UI")) {
-				ImGui::Text("Batch Count: %i", mQuadUi.getBatchCount());
-
-				int i = 0;
-				size_t totalGeoCount = 0;
-				for (std::shared_ptr<RenderBatchQuad> batch : mQuadUi.GeoBatches) {
-					size_t geoCount = batch->getGeometryCount();
-					ImGui::Text("Batch [%i] GeoCount: %i ", i, geoCount);
-					i++;
-					totalGeoCount += geoCount;
-				}
-				ImGui::Text("Total GeoCount: %i", totalGeoCount);
-			}
-
-			if (ImGui::CollapsingHeader("Circle Scene")) {
-				ImGui::Text("Batch Count: %i", mCircleScene.getBatchCount());
-
-				int i = 0;
-				size_t totalGeoCount = 0;
-				for (std::shared_ptr<RenderBatchCircle> batch : mCircleScene.GeoBatches) {
-					size_t geoCount = batch->getGeometryCount();
-					ImGui::Text("Batch [%i] GeoCount: %i ", i, geoCount);
-					totalGeoCount += geoCount;
-				}
-				ImGui::Text("Total GeoCount: %i", totalGeoCount);
-			}
-
-			if (ImGui::CollapsingHeader("Circle UI")) {
-				ImGui::Text("Batch Count: %i", mCircleUi.getBatchCount());
-
-				int i = 0;
-				size_t totalGeoCount = 0;
-				for (std::shared_ptr<RenderBatchCircle> batch : mCircleUi.GeoBatches) {
-					size_t geoCount = batch->getGeometryCount();
-					ImGui::Text("Batch [%i] GeoCount: %i ", i, geoCount);
-					totalGeoCount += geoCount;
-				}
-				ImGui::Text("Total GeoCount: %i", totalGeoCount);
-			}
+			ImGui::Checkbox("Quad Instancing", &mQuadInstancingEnabled);
+			ImGui::Text(
+				"Quad upload size: %i bytes (%s)",
+				mQuadInstancingEnabled ? VertexQuadInstance3d::BYTE_SIZE : Quad::BYTE_SIZE,
+				mQuadInstancingEnabled ? "Instanced" : "Vertex"
+			);
 
+			drawBatchManagerImGui("Quad Scene", *mQuadScene.Batches);
+			drawBatchManagerImGui("Quad UI", *mQuadUi.Batches);
+			drawBatchManagerImGui("Quad Instanced Scene", *mQuadInstancedScene.Batches);
+			drawBatchManagerImGui("Quad Instanced UI", *mQuadInstancedUi.Batches);
+			drawBatchManagerImGui("Circle Scene", *mCircleScene.Batches);
+			drawBatchManagerImGui("Circle UI", *mCircleUi.Batches);
 
 			ImGui::Text("TODO:: This will be filled with more related info.");
 		}
@@ -1315,4 +843,4 @@ namespace DOH {
 			ImGui::EndTabItem();
 		}
 	}
-}
+}
\ No newline at end of file
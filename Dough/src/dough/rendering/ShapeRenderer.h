@@ -5,6 +5,7 @@
 #include "dough/scene/geometry/collections/TextString.h"
 #include "dough/rendering/pipeline/GraphicsPipelineVulkan.h"
 #include "dough/rendering/batches/RenderBatchQuad.h"
+#include "dough/rendering/batches/RenderBatchQuadInstanced.h"
 #include "dough/rendering/batches/RenderBatchCircle.h"
 #include "dough/rendering/renderables/SimpleRenderable.h"
 #include "dough/rendering/textures/TextureArray.h"
@@ -15,8 +16,6 @@
 
 namespace DOH {
 
-	//TODO:: create a DynamicBatchArray<RenderBatchQuad> or something like that.
-
 	class RenderingContextVulkan;
 	enum class EImGuiContainerType;
 
@@ -28,6 +27,7 @@ namespace DOH {
 
 		static const char* QUAD_SHADER_PATH_VERT;
 		static const char* QUAD_SHADER_PATH_FRAG;
+		static const char* QUAD_INSTANCED_SHADER_PATH_VERT;
 		static const char* CIRCLE_SHADER_PATH_VERT;
 		static const char* CIRCLE_SHADER_PATH_FRAG;
 
@@ -40,6 +40,8 @@ namespace DOH {
 
 		ShapeRenderingObjects<RenderBatchQuad> mQuadScene;
 		ShapeRenderingObjects<RenderBatchQuad> mQuadUi;
+		ShapeRenderingObjects<RenderBatchQuadInstanced> mQuadInstancedScene;
+		ShapeRenderingObjects<RenderBatchQuadInstanced> mQuadInstancedUi;
 		ShapeRenderingObjects<RenderBatchCircle> mCircleScene;
 		ShapeRenderingObjects<RenderBatchCircle> mCircleUi;
 
@@ -68,41 +70,66 @@ namespace DOH {
 		bool mWarnOnNullSceneCameraData;
 		bool mWarnOnNullUiCameraData;
 
+		//When enabled the drawQuad* API writes one VertexQuadInstance3d per quad into the instanced groups,
+		//otherwise each quad is expanded into 4 vertices and drawn with the shared quad index buffer.
+		bool mQuadInstancingEnabled;
+
 		//-----Debug information-----
 		uint32_t mDrawnQuadCount;
-		uint32_t mTruncatedQuadCount;
 		uint32_t mDrawnCircleCount;
-		uint32_t mTruncatedCircleCount;
 		//uint32_t mDrawnTriangleCount;
-		//uint32_t mTruncatedTriangleCount;
 
 	private:
 		void initImpl();
 		void initQuad();
+		void initQuadInstanced();
 		void initCircle();
 		//void initTriangle();
 		void closeImpl();
-		void onSwapChainResizeImpl(SwapChainVulkan& swapChain);
+		void onRenderPassesRecreatedImpl();
 
 		void updateTextureArrayDescriptorSetImpl();
 
 		void drawSceneImpl(uint32_t imageIndex, VkCommandBuffer cmd, CurrentBindingsState& currentBindings);
 		void drawUiImpl(uint32_t imageIndex, VkCommandBuffer cmd, CurrentBindingsState& currentBindings);
 
-		size_t createNewBatchQuad(ShapeRenderingObjects<RenderBatchQuad>& shapeRendering);
-		size_t createNewBatchCircle(ShapeRenderingObjects<RenderBatchCircle>& shapeRendering);
-		//size_t createNewBatchTriangle();
+		//Upload a group's batches into its ring for this frame, record the draws and reset the batches for the next frame.
+		template<typename TBatch>
+		void drawIndexedBatches(
+			ShapeRenderingObjects<TBatch>& group,
+			uint32_t imageIndex,
+			VkCommandBuffer cmd,
+			CurrentBindingsState& currentBindings,
+			uint32_t& drawCallCount
+		);
+		void drawInstancedBatches(
+			ShapeRenderingObjects<RenderBatchQuadInstanced>& group,
+			uint32_t imageIndex,
+			VkCommandBuffer cmd,
+			CurrentBindingsState& currentBindings,
+			uint32_t& drawCallCount
+		);
+
+		//Texture slot of texture in mTextureArray, adding it if there is space. Returns 0 (blank white texture) when the array is full.
+		uint32_t getTextureSlotIndexOrAdd(TextureVulkan& texture);
 
 		void closeEmptyQuadBatchesImpl();
 		void closeEmptyCircleBatchesImpl();
 		//void closeEmptyTriangleBatchesImpl();
 
 		//Quad
-		void drawQuad(ShapeRenderingObjects<RenderBatchQuad>& quadGroup, const Quad& quad);
-		void drawQuadTextured(ShapeRenderingObjects<RenderBatchQuad>& quadGroup, const Quad& quad);
-		void drawQuadArray(ShapeRenderingObjects<RenderBatchQuad>& quadGroup, const std::vector<Quad>& quadArr);
-		void drawQuadArrayTextured(ShapeRenderingObjects<RenderBatchQuad>& quadGroup, const std::vector<Quad>& quadArr);
-		void drawQuadArraySameTexture(ShapeRenderingObjects<RenderBatchQuad>& quadGroup, const std::vector<Quad>& quadArr);
+		//NOTE:: Templated on the batch type so both RenderBatchQuad and RenderBatchQuadInstanced groups share the same batching logic.
+		// Explicitly instantiated for both in ShapeRenderer.cpp.
+		template<typename TQuadBatch>
+		void drawQuad(ShapeRenderingObjects<TQuadBatch>& quadGroup, const Quad& quad);
+		template<typename TQuadBatch>
+		void drawQuadTextured(ShapeRenderingObjects<TQuadBatch>& quadGroup, const Quad& quad);
+		template<typename TQuadBatch>
+		void drawQuadArray(ShapeRenderingObjects<TQuadBatch>& quadGroup, const std::vector<Quad>& quadArr);
+		template<typename TQuadBatch>
+		void drawQuadArrayTextured(ShapeRenderingObjects<TQuadBatch>& quadGroup, const std::vector<Quad>& quadArr);
+		template<typename TQuadBatch>
+		void drawQuadArraySameTexture(ShapeRenderingObjects<TQuadBatch>& quadGroup, const std::vector<Quad>& quadArr);
 
 		//Circle
 		void drawCircle(ShapeRenderingObjects<RenderBatchCircle>& circleGroup, const Circle& circle);
@@ -115,13 +142,15 @@ namespace DOH {
 		void setUiCameraDataImpl(std::shared_ptr<CameraGpuData> cameraData);
 
 		void drawImGuiImpl(EImGuiContainerType type);
+		template<typename TBatch>
+		void drawBatchManagerImGui(const char* label, const BatchManager<TBatch>& batches);
 
 	public:
 		ShapeRenderer(RenderingContextVulkan& context);
 
 		static void init(RenderingContextVulkan& context);
 		static void close();
-		static void onSwapChainResize(SwapChainVulkan& swapChain);
+		static void onRenderPassesRecreated();
 
 		//TEMP:: Updates mTextureArrayDescSet to point to textures currently in mTextureArray.
 		//TODO:: Rework this system to allow for more textures and not rely on the app logic to call this function.
@@ -130,29 +159,32 @@ namespace DOH {
 		static inline void drawScene(uint32_t imageIndex, VkCommandBuffer cmd, CurrentBindingsState& currentBindings) { INSTANCE->drawSceneImpl(imageIndex, cmd, currentBindings); }
 		static inline void drawUi(uint32_t imageIndex, VkCommandBuffer cmd, CurrentBindingsState& currentBindings) { INSTANCE->drawUiImpl(imageIndex, cmd, currentBindings); }
 
+		//Batch pools shrink on their own after BatchManager::SHRINK_IDLE_FRAME_COUNT low usage frames, these shrink them immediately.
 		static void closeEmptyQuadBatches();
 		static void closeEmptyCircleBatches();
 		//static void closeEmptyTriangleBatches();
 
-		static inline uint32_t getQuadBatchCount() { return INSTANCE->mQuadScene.getBatchCount() + INSTANCE->mQuadUi.getBatchCount(); }
+		static inline uint32_t getQuadBatchCount() {
+			return INSTANCE->mQuadScene.getBatchCount() + INSTANCE->mQuadUi.getBatchCount() +
+				INSTANCE->mQuadInstancedScene.getBatchCount() + INSTANCE->mQuadInstancedUi.getBatchCount();
+		}
 		static inline uint32_t getDrawnQuadCount() { return INSTANCE->mDrawnQuadCount; }
-		static inline uint32_t getTruncatedQuadCount() { return INSTANCE->mTruncatedQuadCount; }
 		static void resetLocalDebugInfo();
 
 		static std::vector<DescriptorTypeInfo> getEngineDescriptorTypeInfos();
 
 		//-----Shape Objects-----
 		//Quad
-		static inline void drawQuadScene(const Quad& quad) { INSTANCE->drawQuad(INSTANCE->mQuadScene, quad); }
-		static inline void drawQuadTexturedScene(const Quad& quad) { INSTANCE->drawQuadTextured(INSTANCE->mQuadScene, quad); }
-		static inline void drawQuadArrayScene(const std::vector<Quad>& quadArr) { INSTANCE->drawQuadArray(INSTANCE->mQuadScene, quadArr); }
-		static inline void drawQuadArrayTexturedScene(const std::vector<Quad>& quadArr) { INSTANCE->drawQuadArrayTextured(INSTANCE->mQuadScene, quadArr); }
-		static inline void drawQuadArraySameTextureScene(const std::vector<Quad>& quadArr) { INSTANCE->drawQuadArraySameTexture(INSTANCE->mQuadScene, quadArr); }
-		static inline void drawQuadUi(Quad& quad) { INSTANCE->drawQuad(INSTANCE->mQuadUi, quad); }
-		static inline void drawQuadTexturedUi(const Quad& quad) { INSTANCE->drawQuadTextured(INSTANCE->mQuadUi, quad); }
-		static inline void drawQuadArrayUi(const std::vector<Quad>& quadArr) { INSTANCE->drawQuadArray(INSTANCE->mQuadUi, quadArr); }
-		static inline void drawQuadArrayTexturedUi(const std::vector<Quad>& quadArr) { INSTANCE->drawQuadArrayTextured(INSTANCE->mQuadUi, quadArr); }
-		static inline void drawQuadArraySameTextureUi(const std::vector<Quad>& quadArr) { INSTANCE->drawQuadArraySameTexture(INSTANCE->mQuadUi, quadArr); }
+		static inline void drawQuadScene(const Quad& quad) { if (INSTANCE->mQuadInstancingEnabled) { INSTANCE->drawQuad(INSTANCE->mQuadInstancedScene, quad); } else { INSTANCE->drawQuad(INSTANCE->mQuadScene, quad); } }
+		static inline void drawQuadTexturedScene(const Quad& quad) { if (INSTANCE->mQuadInstancingEnabled) { INSTANCE->drawQuadTextured(INSTANCE->mQuadInstancedScene, quad); } else { INSTANCE->drawQuadTextured(INSTANCE->mQuadScene, quad); } }
+		static inline void drawQuadArrayScene(const std::vector<Quad>& quadArr) { if (INSTANCE->mQuadInstancingEnabled) { INSTANCE->drawQuadArray(INSTANCE->mQuadInstancedScene, quadArr); } else { INSTANCE->drawQuadArray(INSTANCE->mQuadScene, quadArr); } }
+		static inline void drawQuadArrayTexturedScene(const std::vector<Quad>& quadArr) { if (INSTANCE->mQuadInstancingEnabled) { INSTANCE->drawQuadArrayTextured(INSTANCE->mQuadInstancedScene, quadArr); } else { INSTANCE->drawQuadArrayTextured(INSTANCE->mQuadScene, quadArr); } }
+		static inline void drawQuadArraySameTextureScene(const std::vector<Quad>& quadArr) { if (INSTANCE->mQuadInstancingEnabled) { INSTANCE->drawQuadArraySameTexture(INSTANCE->mQuadInstancedScene, quadArr); } else { INSTANCE->drawQuadArraySameTexture(INSTANCE->mQuadScene, quadArr); } }
+		static inline void drawQuadUi(Quad& quad) { if (INSTANCE->mQuadInstancingEnabled) { INSTANCE->drawQuad(INSTANCE->mQuadInstancedUi, quad); } else { INSTANCE->drawQuad(INSTANCE->mQuadUi, quad); } }
+		static inline void drawQuadTexturedUi(const Quad& quad) { if (INSTANCE->mQuadInstancingEnabled) { INSTANCE->drawQuadTextured(INSTANCE->mQuadInstancedUi, quad); } else { INSTANCE->drawQuadTextured(INSTANCE->mQuadUi, quad); } }
+		static inline void drawQuadArrayUi(const std::vector<Quad>& quadArr) { if (INSTANCE->mQuadInstancingEnabled) { INSTANCE->drawQuadArray(INSTANCE->mQuadInstancedUi, quadArr); } else { INSTANCE->drawQuadArray(INSTANCE->mQuadUi, quadArr); } }
+		static inline void drawQuadArrayTexturedUi(const std::vector<Quad>& quadArr) { if (INSTANCE->mQuadInstancingEnabled) { INSTANCE->drawQuadArrayTextured(INSTANCE->mQuadInstancedUi, quadArr); } else { INSTANCE->drawQuadArrayTextured(INSTANCE->mQuadUi, quadArr); } }
+		static inline void drawQuadArraySameTextureUi(const std::vector<Quad>& quadArr) { if (INSTANCE->mQuadInstancingEnabled) { INSTANCE->drawQuadArraySameTexture(INSTANCE->mQuadInstancedUi, quadArr); } else { INSTANCE->drawQuadArraySameTexture(INSTANCE->mQuadUi, quadArr); } }
 		//Circle
 		static inline void drawCircleScene(const Circle& circle) { INSTANCE->drawCircle(INSTANCE->mCircleScene, circle); }
 		static inline void drawCircleTexturedScene(const Circle& circle) { INSTANCE->drawCircleTextured(INSTANCE->mCircleScene, circle); }
@@ -167,8 +199,8 @@ namespace DOH {
 
 		static inline std::shared_ptr<IndexBufferVulkan> getQuadSharedIndexBufferPtr() { return INSTANCE->mQuadSharedIndexBuffer; }
 		static inline TextureArray& getShapesTextureArray() { return *INSTANCE->mTextureArray; }
-		static inline std::vector<std::shared_ptr<RenderBatchQuad>>& getQuadSceneRenderBatches() { return INSTANCE->mQuadScene.GeoBatches; }
-		static inline std::vector<std::shared_ptr<RenderBatchQuad>>& getQuadUiRenderBatches() { return INSTANCE->mQuadUi.GeoBatches; }
+		static inline const std::vector<std::shared_ptr<RenderBatchQuad>>& getQuadSceneRenderBatches() { return INSTANCE->mQuadScene.Batches->getBatches(); }
+		static inline const std::vector<std::shared_ptr<RenderBatchQuad>>& getQuadUiRenderBatches() { return INSTANCE->mQuadUi.Batches->getBatches(); }
 		static inline uint32_t getQuadSceneBatchCount() { return INSTANCE->mQuadScene.getBatchCount(); }
 		static inline uint32_t getQuadUiBatchCount() { return INSTANCE->mQuadUi.getBatchCount(); }
 		static inline uint32_t getCircleSceneBatchCount() { return INSTANCE->mCircleScene.getBatchCount(); }
@@ -176,9 +208,14 @@ namespace DOH {
 		//static inline const std::vector<std::shared_ptr<TextureVulkan>>& getTestTextures() { return INSTANCE->mTestTextures; }
 		static inline const std::shared_ptr<MonoSpaceTextureAtlas> getTestMonoSpaceTextureAtlas() { return INSTANCE->mTestMonoSpaceTextureAtlas; }
 		static inline const std::shared_ptr<IndexedTextureAtlas> getTestIndexedTextureAtlas() { return INSTANCE->mTestIndexedTextureAtlas; }
-		static inline const std::vector<std::shared_ptr<RenderBatchCircle>>& getCircleSceneBatches() { return INSTANCE->mCircleScene.GeoBatches; }
-		static inline const std::vector<std::shared_ptr<RenderBatchCircle>>& getCircleUiBatches() { return INSTANCE->mCircleUi.GeoBatches; }
+		static inline const std::vector<std::shared_ptr<RenderBatchCircle>>& getCircleSceneBatches() { return INSTANCE->mCircleScene.Batches->getBatches(); }
+		static inline const std::vector<std::shared_ptr<RenderBatchCircle>>& getCircleUiBatches() { return INSTANCE->mCircleUi.Batches->getBatches(); }
 		static inline uint32_t getCircleUiBatchCount() { return INSTANCE->mCircleUi.getBatchCount(); }
+		static inline const std::vector<std::shared_ptr<RenderBatchQuadInstanced>>& getQuadInstancedSceneRenderBatches() { return INSTANCE->mQuadInstancedScene.Batches->getBatches(); }
+		static inline const std::vector<std::shared_ptr<RenderBatchQuadInstanced>>& getQuadInstancedUiRenderBatches() { return INSTANCE->mQuadInstancedUi.Batches->getBatches(); }
+
+		static inline bool isQuadInstancingEnabled() { return INSTANCE->mQuadInstancingEnabled; }
+		static inline void setQuadInstancingEnabled(bool enabled) { INSTANCE->mQuadInstancingEnabled = enabled; }
 
 		static inline void setSceneCameraData(std::shared_ptr<CameraGpuData> cameraData) { INSTANCE->setSceneCameraDataImpl(cameraData); }
 		static inline void setUiCameraData(std::shared_ptr<CameraGpuData> cameraData) { INSTANCE->setUiCameraDataImpl(cameraData); }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "dough/rendering/RenderingContextVulkan.h"
+#include "dough/rendering/batches/BatchManager.h"
 #include "dough/scene/geometry/AGeometry.h"
 
 #include <memory>
@@ -32,9 +33,7 @@ namespace DOH {
 		:	Shape(shape)
 		{}
 
-		//TODO:: Some kind of BatchManager<T> for control and functionality (e.g. allowing for a limit of how many batches, having a batch that never changes, etc...)
-		std::vector<std::shared_ptr<T>> GeoBatches;
-		std::vector<std::shared_ptr<SimpleRenderable>> Renderables;
+		std::unique_ptr<BatchManager<T>> Batches;
 		std::shared_ptr<ShaderProgram> Program;
 		std::shared_ptr<ShaderVulkan> VertexShader;
 		std::shared_ptr<ShaderVulkan> FragmentShader;
@@ -48,13 +47,10 @@ namespace DOH {
 			context.addGpuResourceToClose(VertexShader);
 			context.addGpuResourceToClose(FragmentShader);
 			context.addGpuResourceToClose(Pipeline);
-			for (auto& renderable : Renderables) {
-				context.addGpuResourceToClose(renderable->getVaoPtr());
-			}
+			Batches->addOwnedResourcesToClose(context);
 		}
 
-		//IMPORTANT:: Renderables count should match this
-		inline uint32_t getBatchCount() const { return static_cast<uint32_t>(GeoBatches.size()); }
+		inline uint32_t getBatchCount() const { return Batches->getBatchCount(); }
 		inline ERenderPass getRenderPass() const { return PipelineInstanceInfo->getRenderPass(); }
 	};
 }
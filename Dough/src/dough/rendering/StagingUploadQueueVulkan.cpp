@@ -0,0 +1,342 @@
+#include "dough/rendering/StagingUploadQueueVulkan.h"
+
+#include "dough/Utils.h"
+
+#include <algorithm>
+
+#include <tracy/public/tracy/Tracy.hpp>
+
+namespace DOH {
+
+	StagingUploadQueueVulkan::StagingUploadQueueVulkan(
+		VkDevice logicDevice,
+		DeviceMemoryAllocatorVulkan& allocator,
+		VkCommandPool cmdPool,
+		VkQueue queue
+	) : mLogicDevice(logicDevice),
+		mAllocator(allocator),
+		mCommandPool(cmdPool),
+		mQueue(queue),
+		mLastSubmittedBatchId(0),
+		mLastCompletedBatchId(0),
+		mSubmittedBatchCount(0),
+		mLastBatchUploadCount(0),
+		mLastBatchByteSize(0),
+		mTotalUploadedBytes(0)
+	{}
+
+	void StagingUploadQueueVulkan::close() {
+		ZoneScoped;
+
+		waitIdle();
+
+		for (VkFence fence : mFreeFences) {
+			vkDestroyFence(mLogicDevice, fence, nullptr);
+		}
+		mFreeFences.clear();
+	}
+
+	StagingUploadHandle StagingUploadQueueVulkan::uploadBuffer(BufferVulkan& dstBuffer, const void* data, VkDeviceSize size, VkDeviceSize dstOffset) {
+		ZoneScoped;
+
+		VkCommandBuffer cmd = getRecordingCommandBuffer();
+		std::shared_ptr<BufferVulkan> stagingBuffer = createStagingBuffer(data, size);
+
+		VkBufferCopy copy = {};
+		copy.srcOffset = 0;
+		copy.dstOffset = dstOffset;
+		copy.size = size;
+		vkCmdCopyBuffer(cmd, stagingBuffer->getBuffer(), dstBuffer.getBuffer(), 1, &copy);
+		dstBuffer.setPendingUpload(*this, mRecordingBatch.Id);
+
+		mRecordingBatch.StagingBuffers.emplace_back(stagingBuffer);
+		mRecordingBatch.ByteSize += size;
+		mRecordingBatch.UploadCount++;
+
+		return { mRecordingBatch.Id };
+	}
+
+	StagingUploadHandle StagingUploadQueueVulkan::uploadImage(
+		VkImage image,
+		const void* data,
+		VkDeviceSize size,
+		uint32_t width,
+		uint32_t height,
+		VkImageAspectFlags aspectFlags,
+		uint32_t mipLevels
+	) {
+		ZoneScoped;
+
+		VkCommandBuffer cmd = getRecordingCommandBuffer();
+		std::shared_ptr<BufferVulkan> stagingBuffer = createStagingBuffer(data, size);
+
+		recordImageBarrier(
+			cmd,
+			image,
+			aspectFlags,
+			mipLevels,
+			VK_IMAGE_LAYOUT_UNDEFINED,
+			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+			0,
+			VK_ACCESS_TRANSFER_WRITE_BIT,
+			VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+			VK_PIPELINE_STAGE_TRANSFER_BIT
+		);
+
+		VkDeviceSize texelCount = 0;
+		for (uint32_t level = 0; level < mipLevels; level++) {
+			texelCount += static_cast<VkDeviceSize>(std::max(width >> level, 1u)) * std::max(height >> level, 1u);
+		}
+		const VkDeviceSize texelSize = size / texelCount;
+
+		VkDeviceSize levelOffset = 0;
+		for (uint32_t level = 0; level < mipLevels; level++) {
+			const uint32_t levelWidth = std::max(width >> level, 1u);
+			const uint32_t levelHeight = std::max(height >> level, 1u);
+
+			VkBufferImageCopy region = {};
+			region.bufferOffset = levelOffset;
+			region.bufferRowLength = 0;
+			region.bufferImageHeight = 0;
+			region.imageSubresource.aspectMask = aspectFlags;
+			region.imageSubresource.mipLevel = level;
+			region.imageSubresource.baseArrayLayer = 0;
+			region.imageSubresource.layerCount = 1;
+			region.imageOffset = { 0, 0, 0 };
+			region.imageExtent = { levelWidth, levelHeight, 1 };
+			stagingBuffer->copyToImage(cmd, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, region);
+
+			levelOffset += static_cast<VkDeviceSize>(levelWidth) * levelHeight * texelSize;
+		}
+
+		recordImageBarrier(
+			cmd,
+			image,
+			aspectFlags,
+			mipLevels,
+			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+			VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+			VK_ACCESS_TRANSFER_WRITE_BIT,
+			VK_ACCESS_SHADER_READ_BIT,
+			VK_PIPELINE_STAGE_TRANSFER_BIT,
+			VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT
+		);
+
+		mRecordingBatch.StagingBuffers.emplace_back(stagingBuffer);
+		mRecordingBatch.ByteSize += size;
+		mRecordingBatch.UploadCount++;
+
+		return { mRecordingBatch.Id };
+	}
+
+	StagingUploadHandle StagingUploadQueueVulkan::submit() {
+		ZoneScoped;
+
+		if (mRecordingBatch.Cmd == VK_NULL_HANDLE) {
+			return { mLastSubmittedBatchId };
+		}
+
+		//Make every buffer copy in the batch visible to anything reading it later on the queue.
+		VkMemoryBarrier barrier = {};
+		barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		barrier.dstAccessMask =
+			VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT |
+			VK_ACCESS_INDEX_READ_BIT |
+			VK_ACCESS_UNIFORM_READ_BIT |
+			VK_ACCESS_SHADER_READ_BIT;
+		vkCmdPipelineBarrier(
+			mRecordingBatch.Cmd,
+			VK_PIPELINE_STAGE_TRANSFER_BIT,
+			VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+			0,
+			1,
+			&barrier,
+			0,
+			nullptr,
+			0,
+			nullptr
+		);
+
+		VK_TRY(
+			vkEndCommandBuffer(mRecordingBatch.Cmd),
+			"Failed to end staging upload command buffer"
+		);
+
+		if (mFreeFences.empty()) {
+			VkFenceCreateInfo fenceCreateInfo = {};
+			fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+			VkFence fence;
+			VK_TRY(
+				vkCreateFence(mLogicDevice, &fenceCreateInfo, nullptr, &fence),
+				"Failed to create staging upload fence"
+			);
+			mFreeFences.emplace_back(fence);
+		}
+		mRecordingBatch.Fence = mFreeFences.back();
+		mFreeFences.pop_back();
+
+		VkSubmitInfo submitInfo = {};
+		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		submitInfo.commandBufferCount = 1;
+		submitInfo.pCommandBuffers = &mRecordingBatch.Cmd;
+
+		VK_TRY(
+			vkQueueSubmit(mQueue, 1, &submitInfo, mRecordingBatch.Fence),
+			"Failed to submit staging uploads"
+		);
+
+		mLastSubmittedBatchId = mRecordingBatch.Id;
+		mSubmittedBatchCount++;
+		mLastBatchUploadCount = mRecordingBatch.UploadCount;
+		mLastBatchByteSize = mRecordingBatch.ByteSize;
+		mTotalUploadedBytes += mRecordingBatch.ByteSize;
+
+		mInFlightBatches.emplace_back(std::move(mRecordingBatch));
+		mRecordingBatch = {};
+
+		return { mLastSubmittedBatchId };
+	}
+
+	void StagingUploadQueueVulkan::update() {
+		ZoneScoped;
+
+		while (!mInFlightBatches.empty() && vkGetFenceStatus(mLogicDevice, mInFlightBatches.front().Fence) == VK_SUCCESS) {
+			UploadBatch& batch = mInFlightBatches.front();
+			mLastCompletedBatchId = batch.Id;
+			releaseBatch(batch);
+			mInFlightBatches.pop_front();
+		}
+	}
+
+	bool StagingUploadQueueVulkan::isComplete(const StagingUploadHandle handle) {
+		if (handle.BatchId <= mLastCompletedBatchId) {
+			return true;
+		}
+
+		update();
+		return handle.BatchId <= mLastCompletedBatchId;
+	}
+
+	void StagingUploadQueueVulkan::wait(const StagingUploadHandle handle) {
+		ZoneScoped;
+
+		if (isComplete(handle)) {
+			return;
+		}
+
+		if (mRecordingBatch.Cmd != VK_NULL_HANDLE && handle.BatchId >= mRecordingBatch.Id) {
+			submit();
+		}
+
+		//Batches complete in submission order so only the last one that handle depends on needs waiting on.
+		for (auto itr = mInFlightBatches.rbegin(); itr != mInFlightBatches.rend(); itr++) {
+			if (itr->Id <= handle.BatchId) {
+				VK_TRY(
+					vkWaitForFences(mLogicDevice, 1, &itr->Fence, VK_TRUE, UINT64_MAX),
+					"Failed to wait on staging upload fence"
+				);
+				break;
+			}
+		}
+
+		update();
+	}
+
+	VkCommandBuffer StagingUploadQueueVulkan::getRecordingCommandBuffer() {
+		if (mRecordingBatch.Cmd == VK_NULL_HANDLE) {
+			VkCommandBufferAllocateInfo allocation = {};
+			allocation.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+			allocation.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+			allocation.commandPool = mCommandPool;
+			allocation.commandBufferCount = 1;
+
+			VK_TRY(
+				vkAllocateCommandBuffers(mLogicDevice, &allocation, &mRecordingBatch.Cmd),
+				"Failed to allocate staging upload command buffer"
+			);
+
+			VkCommandBufferBeginInfo beginInfo = {};
+			beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+			beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+			VK_TRY(
+				vkBeginCommandBuffer(mRecordingBatch.Cmd, &beginInfo),
+				"Failed to begin staging upload command buffer"
+			);
+
+			mRecordingBatch.Id = mLastSubmittedBatchId + 1;
+		}
+
+		return mRecordingBatch.Cmd;
+	}
+
+	std::shared_ptr<BufferVulkan> StagingUploadQueueVulkan::createStagingBuffer(const void* data, VkDeviceSize size) {
+		std::shared_ptr<BufferVulkan> stagingBuffer = std::make_shared<BufferVulkan>(
+			mLogicDevice,
+			mAllocator,
+			size,
+			VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+		);
+		stagingBuffer->setDataUnmapped(data, static_cast<size_t>(size));
+		return stagingBuffer;
+	}
+
+	void StagingUploadQueueVulkan::releaseBatch(UploadBatch& batch) {
+		ZoneScoped;
+
+		for (std::shared_ptr<BufferVulkan>& stagingBuffer : batch.StagingBuffers) {
+			stagingBuffer->close(mLogicDevice);
+		}
+		batch.StagingBuffers.clear();
+
+		vkFreeCommandBuffers(mLogicDevice, mCommandPool, 1, &batch.Cmd);
+		batch.Cmd = VK_NULL_HANDLE;
+
+		vkResetFences(mLogicDevice, 1, &batch.Fence);
+		mFreeFences.emplace_back(batch.Fence);
+		batch.Fence = VK_NULL_HANDLE;
+	}
+
+	void StagingUploadQueueVulkan::recordImageBarrier(
+		VkCommandBuffer cmd,
+		VkImage image,
+		VkImageAspectFlags aspectFlags,
+		uint32_t mipLevels,
+		VkImageLayout oldLayout,
+		VkImageLayout newLayout,
+		VkAccessFlags srcAccessMask,
+		VkAccessFlags dstAccessMask,
+		VkPipelineStageFlags srcStage,
+		VkPipelineStageFlags dstStage
+	) {
+		VkImageMemoryBarrier barrier = {};
+		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		barrier.oldLayout = oldLayout;
+		barrier.newLayout = newLayout;
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.image = image;
+		barrier.subresourceRange.aspectMask = aspectFlags;
+		barrier.subresourceRange.baseMipLevel = 0;
+		barrier.subresourceRange.levelCount = mipLevels;
+		barrier.subresourceRange.baseArrayLayer = 0;
+		barrier.subresourceRange.layerCount = 1;
+		barrier.srcAccessMask = srcAccessMask;
+		barrier.dstAccessMask = dstAccessMask;
+
+		vkCmdPipelineBarrier(
+			cmd,
+			srcStage,
+			dstStage,
+			0,
+			0,
+			nullptr,
+			0,
+			nullptr,
+			1,
+			&barrier
+		);
+	}
+}
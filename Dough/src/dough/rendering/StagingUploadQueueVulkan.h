@@ -0,0 +1,122 @@
+#pragma once
+
+#include "dough/rendering/buffer/BufferVulkan.h"
+
+#include <deque>
+#include <vector>
+#include <memory>
+
+namespace DOH {
+
+	//Identifies the batch an upload was recorded into, see StagingUploadQueueVulkan::isComplete() and wait().
+	struct StagingUploadHandle {
+		uint64_t BatchId = 0;
+
+		inline bool isValid() const { return BatchId != 0; }
+	};
+
+	/**
+	* Records staged buffer and image uploads into a single command buffer which is submitted with a fence, instead of
+	* submitting and waiting on the queue for every copy.
+	*
+	* Uploads are recorded into the current batch until submit() is called, the context submits at the start of every
+	* drawFrame so resources uploaded during update/render are ready for that frame. The end of every batch has a barrier
+	* making the transfer writes visible to vertex input and shaders, so submissions later on the same queue can use the
+	* resources straight away. Staging buffers are kept until the batch's fence signals, checked for in update().
+	*
+	* Batches are submitted on the graphics queue rather than a dedicated transfer queue. Using the same queue family
+	* means uploaded buffers and images need no queue family ownership transfers and no semaphore between the upload
+	* and draw submits, the end of batch barrier is enough. Copies still run off the frame's command buffers.
+	*/
+	class StagingUploadQueueVulkan {
+	private:
+		struct UploadBatch {
+			uint64_t Id = 0;
+			VkCommandBuffer Cmd = VK_NULL_HANDLE;
+			VkFence Fence = VK_NULL_HANDLE;
+			std::vector<std::shared_ptr<BufferVulkan>> StagingBuffers;
+			VkDeviceSize ByteSize = 0;
+			uint32_t UploadCount = 0;
+		};
+
+		VkDevice mLogicDevice;
+		DeviceMemoryAllocatorVulkan& mAllocator;
+		VkCommandPool mCommandPool;
+		VkQueue mQueue;
+
+		//Cmd is VK_NULL_HANDLE until something is uploaded after a submit.
+		UploadBatch mRecordingBatch;
+		//In submission order, so batches complete front to back.
+		std::deque<UploadBatch> mInFlightBatches;
+		std::vector<VkFence> mFreeFences;
+		uint64_t mLastSubmittedBatchId;
+		uint64_t mLastCompletedBatchId;
+
+		//-----Debug information-----
+		uint32_t mSubmittedBatchCount;
+		uint32_t mLastBatchUploadCount;
+		VkDeviceSize mLastBatchByteSize;
+		VkDeviceSize mTotalUploadedBytes;
+
+	public:
+		StagingUploadQueueVulkan(VkDevice logicDevice, DeviceMemoryAllocatorVulkan& allocator, VkCommandPool cmdPool, VkQueue queue);
+
+		StagingUploadQueueVulkan(const StagingUploadQueueVulkan& copy) = delete;
+		StagingUploadQueueVulkan operator=(const StagingUploadQueueVulkan& assignment) = delete;
+
+		//Wait for all uploads to finish and release everything owned by the queue.
+		void close();
+
+		//Copy data into a staging buffer and record a copy into dstBuffer, which must have been created with TRANSFER_DST usage.
+		//dstBuffer waits for the copy if it's cleared (or resized) before the copy is done.
+		StagingUploadHandle uploadBuffer(BufferVulkan& dstBuffer, const void* data, VkDeviceSize size, VkDeviceSize dstOffset = 0);
+		/**
+		* Copy data into a staging buffer and record a copy into the first mipLevels of the first layer of image, leaving it in SHADER_READ_ONLY_OPTIMAL.
+		* data holds each mip level in order, tightly packed and starting with the full width by height level. Each level is half the size
+		* of the one before (minimum 1), with the same bytes per texel.
+		*/
+		StagingUploadHandle uploadImage(
+			VkImage image,
+			const void* data,
+			VkDeviceSize size,
+			uint32_t width,
+			uint32_t height,
+			VkImageAspectFlags aspectFlags,
+			uint32_t mipLevels = 1
+		);
+
+		//Submit everything recorded so far. Returns the handle of the submitted batch, or of the last one if nothing was recorded.
+		StagingUploadHandle submit();
+		//Release the staging resources of every batch that has finished.
+		void update();
+		bool isComplete(const StagingUploadHandle handle);
+		//Block until the batch of handle has finished, submitting it first if it is still being recorded.
+		void wait(const StagingUploadHandle handle);
+		inline void waitIdle() { wait({ mRecordingBatch.Cmd != VK_NULL_HANDLE ? mRecordingBatch.Id : mLastSubmittedBatchId }); }
+
+		inline bool hasPendingUploads() const { return mRecordingBatch.Cmd != VK_NULL_HANDLE || !mInFlightBatches.empty(); }
+		inline uint32_t getInFlightBatchCount() const { return static_cast<uint32_t>(mInFlightBatches.size()); }
+		inline uint32_t getSubmittedBatchCount() const { return mSubmittedBatchCount; }
+		inline uint32_t getLastBatchUploadCount() const { return mLastBatchUploadCount; }
+		inline VkDeviceSize getLastBatchByteSize() const { return mLastBatchByteSize; }
+		inline VkDeviceSize getTotalUploadedBytes() const { return mTotalUploadedBytes; }
+
+	private:
+		VkCommandBuffer getRecordingCommandBuffer();
+		std::shared_ptr<BufferVulkan> createStagingBuffer(const void* data, VkDeviceSize size);
+		void releaseBatch(UploadBatch& batch);
+
+		void recordImageBarrier(
+			VkCommandBuffer cmd,
+			VkImage image,
+			VkImageAspectFlags aspectFlags,
+			uint32_t mipLevels,
+			VkImageLayout oldLayout,
+			VkImageLayout newLayout,
+			VkAccessFlags srcAccessMask,
+			VkAccessFlags dstAccessMask,
+			VkPipelineStageFlags srcStage,
+			VkPipelineStageFlags dstStage
+		);
+	};
+}
@@ -94,6 +94,7 @@ namespace DOH {
 	std::unique_ptr<StaticVertexInputLayout> StaticVertexInputLayout::VERTEX_3D_TEXTURED_INDEXED = nullptr;
 	std::unique_ptr<StaticVertexInputLayout> StaticVertexInputLayout::VERTEX_3D_LIT_TEXTURED = nullptr;
 	std::unique_ptr<StaticVertexInputLayout> StaticVertexInputLayout::VERTEX_CIRCLE_3D = nullptr;
+	std::unique_ptr<StaticVertexInputLayout> StaticVertexInputLayout::VERTEX_QUAD_INSTANCE_3D = nullptr;
 
 	void StaticVertexInputLayout::initEngineDefaultVertexInputLayouts() {
 		StaticVertexInputLayout::VERTEX_2D = std::make_unique<StaticVertexInputLayout>(EVertexType::VERTEX_2D);
@@ -104,6 +105,7 @@ namespace DOH {
 		StaticVertexInputLayout::VERTEX_3D_TEXTURED_INDEXED = std::make_unique<StaticVertexInputLayout>(EVertexType::VERTEX_3D_TEXTURED_INDEXED);
 		StaticVertexInputLayout::VERTEX_3D_LIT_TEXTURED = std::make_unique<StaticVertexInputLayout>(EVertexType::VERTEX_3D_LIT_TEXTURED);
 		StaticVertexInputLayout::VERTEX_CIRCLE_3D = std::make_unique<StaticVertexInputLayout>(EVertexType::VERTEX_CIRCLE_3D);
+		StaticVertexInputLayout::VERTEX_QUAD_INSTANCE_3D = std::make_unique<StaticVertexInputLayout>(EVertexType::VERTEX_QUAD_INSTANCE_3D);
 	}
 
 	const StaticVertexInputLayout& StaticVertexInputLayout::get(const EVertexType vertexType) {
@@ -124,6 +126,8 @@ namespace DOH {
 				return *VERTEX_3D_LIT_TEXTURED;
 			case EVertexType::VERTEX_CIRCLE_3D:
 				return *VERTEX_CIRCLE_3D;
+			case EVertexType::VERTEX_QUAD_INSTANCE_3D:
+				return *VERTEX_QUAD_INSTANCE_3D;
 
 			case EVertexType::NONE:
 			default:
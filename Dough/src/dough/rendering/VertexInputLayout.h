@@ -50,6 +50,7 @@ namespace DOH {
 		static std::unique_ptr<StaticVertexInputLayout> VERTEX_3D_TEXTURED_INDEXED;
 		static std::unique_ptr<StaticVertexInputLayout> VERTEX_3D_LIT_TEXTURED;
 		static std::unique_ptr<StaticVertexInputLayout> VERTEX_CIRCLE_3D;
+		static std::unique_ptr<StaticVertexInputLayout> VERTEX_QUAD_INSTANCE_3D;
 
 	public:
 		StaticVertexInputLayout(const EVertexType vertexType);
@@ -5,42 +5,34 @@
 #include "dough/rendering/textures/TextureVulkan.h"
 #include "dough/rendering/Config.h"
 
+#include <algorithm>
 #include <typeinfo>
 
-//Currently batching has significantly different performance on different configurations
-#define MAX_BATCH_QUAD_COUNT
-#if defined (_DEBUG)
-	#undef MAX_BATCH_QUAD_COUNT
-	#define MAX_BATCH_QUAD_COUNT 4
-#else
-	#undef MAX_BATCH_QUAD_COUNT
-	#define MAX_BATCH_QUAD_COUNT 10
-#endif
-#define MAX_BATCH_CIRCLE_COUNT MAX_BATCH_QUAD_COUNT
-
 namespace DOH {
 
 	constexpr static EVertexType QUAD_VERTEX_INPUT_TYPE = EVertexType::VERTEX_3D_TEXTURED_INDEXED;
 	constexpr static EVertexType CIRCLE_VERTEX_INPUT_TYPE = EVertexType::VERTEX_CIRCLE_3D;
+	constexpr static EVertexType QUAD_INSTANCE_INPUT_TYPE = EVertexType::VERTEX_QUAD_INSTANCE_3D;
 
 	//BATCH_QUAD_COUNT is given an arbitrary number, it can be higher or lower depending on need.
 	//Different batches may even use different sizes and not stick to this pre-determined limit,
 	//which isn't even enforced by the engine.
 	//Maybe, for optimisation, the renderer might grant a higher limit to scene batches than UI batches.
+	//There is no limit on the number of batches, BatchManager opens new batches as needed.
 	enum EBatchSizeLimits {
 		BATCH_MAX_COUNT_TEXTURE = 8,
 
 		//Quad
-		QUAD_MAX_BATCH_COUNT = MAX_BATCH_QUAD_COUNT,
 		QUAD_VERTEX_COUNT = 4,
 		QUAD_INDEX_COUNT = 6,
 		QUAD_BATCH_MAX_GEO_COUNT = 10000,
 		QUAD_MAX_COUNT_TEXTURE = BATCH_MAX_COUNT_TEXTURE,
 		QUAD_BATCH_VERTEX_COUNT = QUAD_BATCH_MAX_GEO_COUNT * QUAD_VERTEX_COUNT,
 		QUAD_BATCH_INDEX_COUNT = QUAD_BATCH_MAX_GEO_COUNT * QUAD_INDEX_COUNT,
+		//Instanced quads are drawn non-indexed, two triangles generated from gl_VertexIndex
+		QUAD_INSTANCE_VERTEX_COUNT = 6,
 
 		//Circle
-		CIRCLE_MAX_BATCH_COUNT = MAX_BATCH_CIRCLE_COUNT,
 		CIRCLE_VERTEX_COUNT = 4,
 		CIRCLE_INDEX_COUNT = 6,
 		CIRCLE_BATCH_MAX_GEO_COUNT = 10000,
@@ -49,26 +41,43 @@ namespace DOH {
 		CIRCLE_BATCH_INDEX_COUNT = CIRCLE_BATCH_MAX_GEO_COUNT * CIRCLE_INDEX_COUNT
 	};
 
+	/**
+	* Geometry is written as vertex data to mData, which either points to the batch's own CPU storage or, when the batch is created
+	* without its own storage, to a target set with setDataTarget (e.g. a persistently mapped upload ring allocation) so vertices are
+	* written straight into GPU visible memory and no copy is needed at draw time.
+	* A target may hold less than a full batch, hasTargetSpace is checked before adding and extendDataTarget grows it in place.
+	*
+	* IMPORTANT:: A data target may be write-combined memory, vertex data is only ever written sequentially and never read back.
+	*/
 	template<typename T, typename = std::enable_if<std::is_base_of<AGeometry, T>::value>>
 	class ARenderBatch {
 	private:
+		ARenderBatch(const ARenderBatch& copy) = delete;
 		ARenderBatch operator=(const ARenderBatch& assignment) = delete;
 
 	protected:
 		const uint32_t MAX_GEOMETRY_COUNT;
 		const uint32_t MAX_TEXTURE_COUNT;
+		const size_t DATA_BYTE_SIZE;
 
-		ARenderBatch(const uint32_t maxGeometryCount, const uint32_t geoByteSize, const uint32_t maxTextureCount)
+		ARenderBatch(const uint32_t maxGeometryCount, const uint32_t geoByteSize, const uint32_t maxTextureCount, const bool ownsData)
 		:	MAX_GEOMETRY_COUNT(maxGeometryCount),
 			MAX_TEXTURE_COUNT(maxTextureCount),
-			mData(maxGeometryCount * geoByteSize),
+			DATA_BYTE_SIZE(static_cast<size_t>(maxGeometryCount) * geoByteSize),
+			mOwnedData(ownsData ? DATA_BYTE_SIZE / sizeof(float) : 0),
+			mData(ownsData ? mOwnedData.data() : nullptr),
 			mDataIndex(0),
-			mGeometryCount(0)
+			mGeometryCount(0),
+			mTargetGeometryCapacity(ownsData ? maxGeometryCount : 0)
 		{}
 
-		std::vector<float> mData;
+		//Only allocated when the batch owns its data
+		std::vector<float> mOwnedData;
+		float* mData;
 		uint32_t mDataIndex;
 		uint32_t mGeometryCount;
+		//Geometry mData has room for, MAX_GEOMETRY_COUNT when the batch owns its data
+		uint32_t mTargetGeometryCapacity;
 
 	public:
 		virtual void add(const T& geo, const uint32_t textureSlotIndex) = 0;
@@ -85,10 +94,26 @@ namespace DOH {
 			mGeometryCount = 0;
 		}
 
+		//Write vertex data to target from now on, target must have room for geometryCapacity geometry (at most MAX_GEOMETRY_COUNT). The batch is reset.
+		inline void setDataTarget(void* target, const uint32_t geometryCapacity) {
+			mData = static_cast<float*>(target);
+			mTargetGeometryCapacity = std::min(geometryCapacity, MAX_GEOMETRY_COUNT);
+			reset();
+		}
+		//The current target has been grown in place to geometryCapacity, geometry already written is kept.
+		inline void extendDataTarget(const uint32_t geometryCapacity) {
+			mTargetGeometryCapacity = std::min(geometryCapacity, MAX_GEOMETRY_COUNT);
+		}
+
 		inline uint32_t getDataIndex() const { return mDataIndex; }
 		inline bool hasSpace(size_t geoCount) const { return mGeometryCount + geoCount <= MAX_GEOMETRY_COUNT; }
 		inline size_t getRemainingGeometrySpace() const { return MAX_GEOMETRY_COUNT - mGeometryCount; }
+		inline bool hasTargetSpace(size_t geoCount) const { return mGeometryCount + geoCount <= mTargetGeometryCapacity; }
+		inline size_t getRemainingTargetSpace() const { return mTargetGeometryCapacity - mGeometryCount; }
+		inline uint32_t getTargetGeometryCapacity() const { return mTargetGeometryCapacity; }
 		inline size_t getGeometryCount() const { return mGeometryCount; }
-		inline const std::vector<float>& getData() const { return mData; }
+		inline size_t getDataByteSize() const { return DATA_BYTE_SIZE; }
+		inline bool ownsData() const { return !mOwnedData.empty(); }
+		inline const float* getData() const { return mData; }
 	};
 }
@@ -0,0 +1,320 @@
+#pragma once
+
+#include "dough/rendering/RenderingContextVulkan.h"
+#include "dough/rendering/renderables/SimpleRenderable.h"
+#include "dough/rendering/batches/ARenderBatch.h"
+
+#include <tracy/public/tracy/Tracy.hpp>
+
+#include <algorithm>
+
+namespace DOH {
+
+	/**
+	* Growable pool of render batches for a single shape group, with no upper limit on how much geometry can be added.
+	*
+	* Geometry is always added to the "open" batch, when it is full the next batch in the pool is opened (creating a new one if needed).
+	* When given an upload ring each batch is pointed at its own ring allocation the first time it is opened in a frame, so geometry is
+	* written straight into mapped GPU memory and uploading is free. Otherwise batches own CPU side data that is copied into the
+	* context's ring on upload. Either way batch i is drawn from getBatchAllocation(i).
+	*
+	* Ring allocations start out sized for what was drawn last frame (at least RING_RESERVE_MIN_GEO_COUNT) rather than a full batch,
+	* and are extended in place as geometry is written. If something else was allocated from the ring since, the batch can't be
+	* extended and the next batch is opened instead.
+	* The pool shrinks after SHRINK_IDLE_FRAME_COUNT frames of leaving batches unused.
+	*/
+	template<typename TBatch>
+	class BatchManager : public IGPUResourceOwnerVulkan {
+	public:
+		//Number of consecutive low usage frames before the pool is shrunk.
+		static constexpr uint32_t SHRINK_IDLE_FRAME_COUNT = 120;
+		//Smallest ring allocation a batch is opened with.
+		static constexpr uint32_t RING_RESERVE_MIN_GEO_COUNT = 256;
+
+	private:
+		const uint32_t mBatchGeoCapacity;
+		const uint32_t mGeoByteSize;
+		const uint32_t mMaxTextureCount;
+		std::shared_ptr<IndexBufferVulkan> mSharedIndexBuffer;
+		std::shared_ptr<DescriptorSetsInstanceVulkan> mDescriptorSetsInstance;
+		//Ring batches write into directly, nullptr when batches own their data.
+		UploadRingVulkan* mUploadRing;
+
+		std::vector<std::shared_ptr<TBatch>> mBatches;
+		//Where each batch's data is in the upload ring this frame, only valid for batches before mOpenedBatchCount or after upload.
+		std::vector<UploadRingAllocation> mBatchAllocations;
+		uint32_t mOpenBatchIndex;
+		//Number of batches (from the start of the pool) opened for writing this frame.
+		uint32_t mOpenedBatchCount;
+
+		//The VAO's vertex buffer is re-pointed at each batch's upload ring allocation when drawing.
+		std::shared_ptr<SimpleRenderable> mRenderable;
+
+		uint32_t mIdleFrameCount;
+		uint32_t mIdlePeakBatchCount;
+
+		//-----Debug information-----
+		uint32_t mLastFrameGeoCount;
+		uint32_t mLastFrameBatchCount;
+		size_t mLastUploadByteSize;
+
+	public:
+		/**
+		* @param sharedIndexBuffer Index buffer shared by all batches, nullptr when the batches are drawn non-indexed.
+		* @param uploadRing Ring the batches write their geometry directly into, nullptr for batches with their own CPU side data.
+		*/
+		BatchManager(
+			const uint32_t batchGeoCapacity,
+			const uint32_t geoByteSize,
+			const uint32_t maxTextureCount,
+			std::shared_ptr<IndexBufferVulkan> sharedIndexBuffer,
+			std::shared_ptr<DescriptorSetsInstanceVulkan> descSetsInstance,
+			UploadRingVulkan* uploadRing
+		) :	mBatchGeoCapacity(batchGeoCapacity),
+			mGeoByteSize(geoByteSize),
+			mMaxTextureCount(maxTextureCount),
+			mSharedIndexBuffer(sharedIndexBuffer),
+			mDescriptorSetsInstance(descSetsInstance),
+			mUploadRing(uploadRing),
+			mOpenBatchIndex(0),
+			mOpenedBatchCount(0),
+			mRenderable(nullptr),
+			mIdleFrameCount(0),
+			mIdlePeakBatchCount(0),
+			mLastFrameGeoCount(0),
+			mLastFrameBatchCount(0),
+			mLastUploadByteSize(0)
+		{
+			addNewBatch();
+		}
+
+		BatchManager(const BatchManager& copy) = delete;
+		BatchManager operator=(const BatchManager& assignment) = delete;
+
+		virtual void addOwnedResourcesToClose(RenderingContextVulkan& context) override {
+			if (mRenderable != nullptr) {
+				//NOTE:: Both the vertex buffer (upload ring) and index buffer are shared so this doesn't close either of them.
+				context.addGpuResourceToClose(mRenderable->getVaoPtr());
+				mRenderable = nullptr;
+			}
+		}
+
+		//Returns the open batch if it can fit geoCount, otherwise the next batch in the pool is opened.
+		//Batches before the open batch are never revisited until the next frame.
+		inline TBatch& getBatchWithSpace(const size_t geoCount) {
+			if (mOpenBatchIndex == mOpenedBatchCount) {
+				prepareBatch(mOpenBatchIndex, geoCount);
+			}
+
+			TBatch& openBatch = *mBatches[mOpenBatchIndex];
+			if (openBatch.hasTargetSpace(geoCount) || (openBatch.hasSpace(geoCount) && extendOpenBatch(geoCount))) {
+				return openBatch;
+			}
+			return openNextBatch(geoCount);
+		}
+
+		template<typename TGeo>
+		inline void add(const TGeo& geo, const uint32_t textureSlotIndex) {
+			getBatchWithSpace(1).add(geo, textureSlotIndex);
+		}
+
+		//Add all of geoArr using the same texture slot, split across as many batches as needed.
+		template<typename TGeo>
+		inline void addAll(const std::vector<TGeo>& geoArr, const uint32_t textureSlotIndex) {
+			addAll(geoArr, 0, geoArr.size(), textureSlotIndex);
+		}
+
+		//Add geoArr from startIndex up to endIndex using the same texture slot, split across as many batches as needed.
+		template<typename TGeo>
+		void addAll(const std::vector<TGeo>& geoArr, const size_t startIndex, const size_t endIndex, const uint32_t textureSlotIndex) {
+			ZoneScoped;
+
+			size_t addedIndex = startIndex;
+			while (addedIndex < endIndex) {
+				TBatch& batch = getBatchWithSpace(1);
+				const size_t wantedCount = std::min(batch.getRemainingGeometrySpace(), endIndex - addedIndex);
+				if (!batch.hasTargetSpace(wantedCount)) {
+					extendOpenBatch(wantedCount);
+				}
+				const size_t toAddCount = std::min(batch.getRemainingTargetSpace(), wantedCount);
+				batch.addAll(geoArr, addedIndex, addedIndex + toAddCount, textureSlotIndex);
+				addedIndex += toAddCount;
+			}
+		}
+
+		/**
+		* Make sure every used batch's geometry is in the current frame's region of the upload ring.
+		* Batches that write directly into the ring need nothing doing, otherwise each batch is copied into its own allocation.
+		*
+		* @returns Total geometry count uploaded.
+		*/
+		uint32_t upload(RenderingContextVulkan& context) {
+			ZoneScoped;
+
+			mLastUploadByteSize = 0;
+			const uint32_t geoCount = getGeometryCount();
+			if (geoCount == 0) {
+				return 0;
+			}
+
+			if (mRenderable == nullptr) {
+				createRenderable(context);
+			}
+
+			for (uint32_t i = 0; i <= mOpenBatchIndex; i++) {
+				const TBatch& batch = *mBatches[i];
+				const size_t batchBytes = batch.getGeometryCount() * mGeoByteSize;
+				if (batchBytes > 0) {
+					if (mUploadRing == nullptr) {
+						mBatchAllocations[i] = context.getUploadRing().upload(batch.getData(), batchBytes);
+					}
+					mLastUploadByteSize += batchBytes;
+				}
+			}
+
+			return geoCount;
+		}
+
+		//Reset all batches ready for the next frame and shrink the pool after SHRINK_IDLE_FRAME_COUNT low usage frames.
+		void endFrame() {
+			ZoneScoped;
+
+			const uint32_t geoCount = getGeometryCount();
+			const uint32_t usedBatchCount = getUsedBatchCount();
+
+			for (uint32_t i = 0; i <= mOpenBatchIndex; i++) {
+				mBatches[i]->reset();
+			}
+			mOpenBatchIndex = 0;
+			//Ring allocations are only valid for a single frame so batches are re-opened (and re-pointed) next frame
+			mOpenedBatchCount = 0;
+			mLastFrameGeoCount = geoCount;
+			mLastFrameBatchCount = usedBatchCount;
+
+			if (usedBatchCount < mBatches.size()) {
+				mIdlePeakBatchCount = std::max(mIdlePeakBatchCount, usedBatchCount);
+				mIdleFrameCount++;
+
+				if (mIdleFrameCount >= SHRINK_IDLE_FRAME_COUNT) {
+					shrink(mIdlePeakBatchCount);
+				}
+			} else {
+				resetIdleTracking();
+			}
+		}
+
+		//Immediately shrink the pool to fit the geometry currently in the batches.
+		void shrinkToFit() {
+			shrink(getUsedBatchCount());
+		}
+
+		inline uint32_t getGeometryCount() const {
+			uint32_t geoCount = 0;
+			for (uint32_t i = 0; i <= mOpenBatchIndex; i++) {
+				geoCount += static_cast<uint32_t>(mBatches[i]->getGeometryCount());
+			}
+			return geoCount;
+		}
+		inline uint32_t getUsedBatchCount() const {
+			return mBatches[mOpenBatchIndex]->getGeometryCount() > 0 ? mOpenBatchIndex + 1 : std::max(mOpenBatchIndex, 1u);
+		}
+		inline uint32_t getBatchCount() const { return static_cast<uint32_t>(mBatches.size()); }
+		inline uint32_t getOpenBatchIndex() const { return mOpenBatchIndex; }
+		inline const std::vector<std::shared_ptr<TBatch>>& getBatches() const { return mBatches; }
+		//Only valid after an upload for batches that have geometry
+		inline const UploadRingAllocation& getBatchAllocation(const uint32_t batchIndex) const { return mBatchAllocations[batchIndex]; }
+		inline bool isWritingToUploadRing() const { return mUploadRing != nullptr; }
+		//Only valid after an upload that returned > 0
+		inline SimpleRenderable& getRenderable() const { return *mRenderable; }
+		inline uint32_t getBatchGeoCapacity() const { return mBatchGeoCapacity; }
+		inline uint32_t getIdleFrameCount() const { return mIdleFrameCount; }
+		inline uint32_t getLastFrameGeoCount() const { return mLastFrameGeoCount; }
+		inline uint32_t getLastFrameBatchCount() const { return mLastFrameBatchCount; }
+		inline size_t getLastUploadByteSize() const { return mLastUploadByteSize; }
+
+	private:
+		TBatch& openNextBatch(const size_t geoCount) {
+			ZoneScoped;
+
+			mOpenBatchIndex++;
+			if (mOpenBatchIndex == mBatches.size()) {
+				addNewBatch();
+			}
+			prepareBatch(mOpenBatchIndex, geoCount);
+			return *mBatches[mOpenBatchIndex];
+		}
+
+		inline void addNewBatch() {
+			mBatches.emplace_back(std::make_shared<TBatch>(mBatchGeoCapacity, mMaxTextureCount, mUploadRing == nullptr));
+			mBatchAllocations.emplace_back();
+		}
+
+		//Prepare a batch for writing this frame. When writing to the ring it's pointed at an allocation with room for at least geoCount,
+		//sized for the rest of last frame's geometry so most frames never need to extend it.
+		void prepareBatch(const uint32_t batchIndex, const size_t geoCount) {
+			if (mUploadRing != nullptr) {
+				//Batches before batchIndex are this frame's, batchIndex itself is empty
+				const uint32_t writtenGeoCount = getGeometryCount();
+				const uint32_t expectedGeoCount = mLastFrameGeoCount > writtenGeoCount ? mLastFrameGeoCount - writtenGeoCount : 0;
+				const uint32_t reserveGeoCount = std::min(
+					std::max({ expectedGeoCount, static_cast<uint32_t>(geoCount), RING_RESERVE_MIN_GEO_COUNT }),
+					mBatchGeoCapacity
+				);
+
+				TBatch& batch = *mBatches[batchIndex];
+				mBatchAllocations[batchIndex] = mUploadRing->allocate(static_cast<size_t>(reserveGeoCount) * mGeoByteSize);
+				batch.setDataTarget(mBatchAllocations[batchIndex].Data, reserveGeoCount);
+			}
+			mOpenedBatchCount++;
+		}
+
+		//Grow the open batch's ring allocation in place so it has room for geoCount more, at least doubling it to keep extends rare.
+		bool extendOpenBatch(const size_t geoCount) {
+			if (mUploadRing == nullptr) {
+				return false;
+			}
+
+			ZoneScoped;
+
+			TBatch& batch = *mBatches[mOpenBatchIndex];
+			const uint32_t capacity = batch.getTargetGeometryCapacity();
+			const uint32_t newCapacity = std::min(
+				std::max(capacity * 2, static_cast<uint32_t>(batch.getGeometryCount() + geoCount)),
+				mBatchGeoCapacity
+			);
+			if (newCapacity > capacity && mUploadRing->extend(mBatchAllocations[mOpenBatchIndex], static_cast<size_t>(newCapacity) * mGeoByteSize)) {
+				batch.extendDataTarget(newCapacity);
+				return true;
+			}
+			return false;
+		}
+
+		void createRenderable(RenderingContextVulkan& context) {
+			std::shared_ptr<VertexArrayVulkan> vao = context.createVertexArray();
+			const bool indexed = mSharedIndexBuffer != nullptr;
+			if (indexed) {
+				vao->setIndexBuffer(mSharedIndexBuffer, true);
+			}
+
+			mRenderable = std::make_shared<SimpleRenderable>(vao, mDescriptorSetsInstance, indexed);
+		}
+
+		void shrink(const uint32_t keepBatchCount) {
+			ZoneScoped;
+
+			//Never drop a batch that is still holding geometry this frame
+			const size_t batchCount = std::max<size_t>(std::max(keepBatchCount, mOpenBatchIndex + 1), 1);
+			if (mBatches.size() > batchCount) {
+				mBatches.resize(batchCount);
+				mBatchAllocations.resize(batchCount);
+			}
+
+			resetIdleTracking();
+		}
+
+		inline void resetIdleTracking() {
+			mIdleFrameCount = 0;
+			mIdlePeakBatchCount = 0;
+		}
+	};
+}
\ No newline at end of file
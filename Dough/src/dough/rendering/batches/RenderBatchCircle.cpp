@@ -4,21 +4,52 @@
 
 namespace DOH {
 
-	RenderBatchCircle::RenderBatchCircle(const uint32_t maxGeometryCount, const uint32_t maxTextureCount)
+	RenderBatchCircle::RenderBatchCircle(const uint32_t maxGeometryCount, const uint32_t maxTextureCount, const bool ownsData)
 	: ARenderBatch(
 		maxGeometryCount,
 		Circle::BYTE_SIZE,
-		maxTextureCount
+		maxTextureCount,
+		ownsData
 	) {}
 
 	void RenderBatchCircle::add(const Circle& circle, const uint32_t textureSlotIndex) {
-		float texCoordsIndex = 0;
-		float textureSlot = static_cast<float>(textureSlotIndex);
+		addCircle(circle, static_cast<float>(textureSlotIndex));
+		mGeometryCount++;
+	}
+
+	void RenderBatchCircle::addAll(const std::vector<Circle>& circleArr, const uint32_t textureSlotIndex) {
+		const float textureSlot = static_cast<float>(textureSlotIndex);
+
+		for (const Circle& circle : circleArr) {
+			addCircle(circle, textureSlot);
+		}
+
+		mGeometryCount += static_cast<uint32_t>(circleArr.size());
+	}
+
+	void RenderBatchCircle::addAll(
+		const std::vector<Circle>& circleArr,
+		const size_t startIndex,
+		const size_t endIndex,
+		const uint32_t textureSlotIndex
+	) {
+		const float textureSlot = static_cast<float>(textureSlotIndex);
+
+		for (size_t i = startIndex; i < endIndex; i++) {
+			addCircle(circleArr[i], textureSlot);
+		}
+
+		mGeometryCount += static_cast<uint32_t>(endIndex - startIndex);
+	}
+
+	void RenderBatchCircle::addCircle(const Circle& circle, const float textureSlot) {
+		std::array<glm::vec2, 4> corners;
+		circle.getCornersXY(corners);
 
 		//Bot Left
 		addCircleVertex(
-			circle.Position.x,
-			circle.Position.y,
+			corners[0].x,
+			corners[0].y,
 			circle.Position.z,
 			circle.Colour.x,
 			circle.Colour.y,
@@ -35,8 +66,8 @@ namespace DOH {
 
 		//Bot Right
 		addCircleVertex(
-			circle.Position.x + circle.Size.x,
-			circle.Position.y,
+			corners[1].x,
+			corners[1].y,
 			circle.Position.z,
 			circle.Colour.x,
 			circle.Colour.y,
@@ -53,8 +84,8 @@ namespace DOH {
 
 		//Top Right
 		addCircleVertex(
-			circle.Position.x + circle.Size.x,
-			circle.Position.y + circle.Size.y,
+			corners[2].x,
+			corners[2].y,
 			circle.Position.z,
 			circle.Colour.x,
 			circle.Colour.y,
@@ -71,8 +102,8 @@ namespace DOH {
 
 		//Top Left
 		addCircleVertex(
-			circle.Position.x,
-			circle.Position.y + circle.Size.y,
+			corners[3].x,
+			corners[3].y,
 			circle.Position.z,
 			circle.Colour.x,
 			circle.Colour.y,
@@ -86,175 +117,6 @@ namespace DOH {
 			circle.getFade(),
 			textureSlot
 		);
-
-		mGeometryCount++;
-	}
-
-	void RenderBatchCircle::addAll(const std::vector<Circle>& circleArr, const uint32_t textureSlotIndex) {
-		const float textureSlot = static_cast<float>(textureSlotIndex);
-
-		for (const Circle& circle : circleArr) {
-			//Bot Left
-			addCircleVertex(
-				circle.Position.x,
-				circle.Position.y,
-				circle.Position.z,
-				circle.Colour.x,
-				circle.Colour.y,
-				circle.Colour.z,
-				circle.Colour.w,
-				circle.getTextureCoordsBotLeftX(),
-				circle.getTextureCoordsBotLeftY(),
-				-1.0f,
-				-1.0f,
-				circle.getThickness(),
-				circle.getFade(),
-				textureSlot
-			);
-
-			//Bot Right
-			addCircleVertex(
-				circle.Position.x + circle.Size.x,
-				circle.Position.y,
-				circle.Position.z,
-				circle.Colour.x,
-				circle.Colour.y,
-				circle.Colour.z,
-				circle.Colour.w,
-				circle.getTextureCoordsTopRightX(),
-				circle.getTextureCoordsBotLeftY(),
-				1.0f,
-				-1.0f,
-				circle.getThickness(),
-				circle.getFade(),
-				textureSlot
-			);
-
-			//Top Right
-			addCircleVertex(
-				circle.Position.x + circle.Size.x,
-				circle.Position.y + circle.Size.y,
-				circle.Position.z,
-				circle.Colour.x,
-				circle.Colour.y,
-				circle.Colour.z,
-				circle.Colour.w,
-				circle.getTextureCoordsTopRightX(),
-				circle.getTextureCoordsTopRightY(),
-				1.0f,
-				1.0f,
-				circle.getThickness(),
-				circle.getFade(),
-				textureSlot
-			);
-
-			//Top Left
-			addCircleVertex(
-				circle.Position.x,
-				circle.Position.y + circle.Size.y,
-				circle.Position.z,
-				circle.Colour.x,
-				circle.Colour.y,
-				circle.Colour.z,
-				circle.Colour.w,
-				circle.getTextureCoordsBotLeftX(),
-				circle.getTextureCoordsTopRightY(),
-				-1.0f,
-				1.0f,
-				circle.getThickness(),
-				circle.getFade(),
-				textureSlot
-			);
-		}
-
-		mGeometryCount += static_cast<uint32_t>(circleArr.size());
-	}
-
-	void RenderBatchCircle::addAll(
-		const std::vector<Circle>& circleArr,
-		const size_t startIndex,
-		const size_t endIndex,
-		const uint32_t textureSlotIndex
-	) {
-		const float textureSlot = static_cast<float>(textureSlotIndex);
-
-		for (size_t i = startIndex; i < endIndex; i++) {
-			const Circle& circle = circleArr[i];
-
-			//Bot Left
-			addCircleVertex(
-				circle.Position.x,
-				circle.Position.y,
-				circle.Position.z,
-				circle.Colour.x,
-				circle.Colour.y,
-				circle.Colour.z,
-				circle.Colour.w,
-				circle.getTextureCoordsBotLeftX(),
-				circle.getTextureCoordsBotLeftY(),
-				-1.0f,
-				-1.0f,
-				circle.getThickness(),
-				circle.getFade(),
-				textureSlot
-			);
-
-			//Bot Right
-			addCircleVertex(
-				circle.Position.x + circle.Size.x,
-				circle.Position.y,
-				circle.Position.z,
-				circle.Colour.x,
-				circle.Colour.y,
-				circle.Colour.z,
-				circle.Colour.w,
-				circle.getTextureCoordsTopRightX(),
-				circle.getTextureCoordsBotLeftY(),
-				1.0f,
-				-1.0f,
-				circle.getThickness(),
-				circle.getFade(),
-				textureSlot
-			);
-
-			//Top Right
-			addCircleVertex(
-				circle.Position.x + circle.Size.x,
-				circle.Position.y + circle.Size.y,
-				circle.Position.z,
-				circle.Colour.x,
-				circle.Colour.y,
-				circle.Colour.z,
-				circle.Colour.w,
-				circle.getTextureCoordsTopRightX(),
-				circle.getTextureCoordsTopRightY(),
-				1.0f,
-				1.0f,
-				circle.getThickness(),
-				circle.getFade(),
-				textureSlot
-			);
-
-			//Top Left
-			addCircleVertex(
-				circle.Position.x,
-				circle.Position.y + circle.Size.y,
-				circle.Position.z,
-				circle.Colour.x,
-				circle.Colour.y,
-				circle.Colour.z,
-				circle.Colour.w,
-				circle.getTextureCoordsBotLeftX(),
-				circle.getTextureCoordsTopRightY(),
-				-1.0f,
-				1.0f,
-				circle.getThickness(),
-				circle.getFade(),
-				textureSlot
-			);
-		}
-
-		mGeometryCount += static_cast<uint32_t>(endIndex - startIndex);
 	}
 
 	void RenderBatchCircle::addCircleVertex(
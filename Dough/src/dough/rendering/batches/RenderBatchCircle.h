@@ -8,7 +8,7 @@ namespace DOH {
 
 	class RenderBatchCircle : public ARenderBatch<Circle> {
 	public:
-		RenderBatchCircle(const uint32_t maxGeometryCount, const uint32_t maxTextureCount);
+		RenderBatchCircle(const uint32_t maxGeometryCount, const uint32_t maxTextureCount, const bool ownsData = true);
 
 		virtual void add(const Circle& geo, const uint32_t textureSlotIndex) override;
 		virtual void addAll(const std::vector<Circle>& geoArr, const uint32_t textureSlotIndex) override;
@@ -22,6 +22,9 @@ namespace DOH {
 	private:
 		RenderBatchCircle operator=(const RenderBatchCircle& assignment) = delete;
 
+		//Write the 4 vertices of a circle's quad, rotated around its centre when Rotation is non-zero.
+		inline void addCircle(const Circle& circle, const float textureSlot);
+
 		inline void addCircleVertex(
 			const float posX,
 			const float posY,
@@ -4,14 +4,15 @@
 
 namespace DOH {
 
-	RenderBatchLineList::RenderBatchLineList(const EVertexType vertexType, const uint32_t maxLineCount)
+	RenderBatchLineList::RenderBatchLineList(const EVertexType vertexType, const uint32_t maxLineCount, const bool ownsData)
 	:	mVertexType(vertexType),
 		mComponentCount( //Only VERTEX_3D and VERTEX_2D are supported, else set to 0
 			vertexType == EVertexType::VERTEX_3D ? LINE_3D_DATA_COMPONENT_COUNT :
 				(vertexType == EVertexType::VERTEX_2D ? LINE_2D_DATA_COMPONENT_COUNT : 0)
 		),
 		mMaxLineCount(mComponentCount > 0 ? (maxLineCount > MAX_LINE_COUNT ? MAX_LINE_COUNT : maxLineCount) : 0), //If given vertexType is not supported set mMaxLineCount to 0
-		mData((mMaxLineCount * 2) * getVertexTypeComponentCount(vertexType)),
+		mOwnedData(ownsData ? (mMaxLineCount * 2) * getVertexTypeComponentCount(vertexType) : 0),
+		mData(ownsData ? mOwnedData.data() : nullptr),
 		mDataIndex(0),
 		mLineCount(0)
 	{
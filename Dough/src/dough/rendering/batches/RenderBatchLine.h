@@ -15,6 +15,8 @@ namespace DOH {
 	// since that abstract class and it's childen are designed for triangle list geometry whereas this line batch is for line list.
 	//
 	//VertexType is stored and dictates whether the RenderBatchLineList instance is for lines in 2D or 3D space
+	//
+	//Like ARenderBatch the line data is either owned by the batch or written straight to a target set with setDataTarget.
 	class RenderBatchLineList {
 
 	private:
@@ -22,7 +24,9 @@ namespace DOH {
 		const uint32_t mComponentCount;
 		const uint32_t mMaxLineCount;
 
-		std::vector<float> mData;
+		//Only allocated when the batch owns its data
+		std::vector<float> mOwnedData;
+		float* mData;
 		uint32_t mDataIndex;
 		uint32_t mLineCount;
 
@@ -36,7 +40,7 @@ namespace DOH {
 		static constexpr size_t LINE_2D_SIZE = LINE_2D_DATA_COMPONENT_COUNT * 4;
 		static constexpr size_t LINE_3D_SIZE = LINE_3D_DATA_COMPONENT_COUNT * 4;
 
-		RenderBatchLineList(const EVertexType vertexType, const uint32_t maxLineCount);
+		RenderBatchLineList(const EVertexType vertexType, const uint32_t maxLineCount, const bool ownsData = true);
 
 		RenderBatchLineList(const RenderBatchLineList& copy) = delete;
 		RenderBatchLineList operator=(const RenderBatchLineList& assignment) = delete;
@@ -55,7 +59,15 @@ namespace DOH {
 		}
 		inline bool hasSpace(const uint32_t count = 1) const { return (mLineCount + count) < mMaxLineCount; }
 
-		inline const std::vector<float>& getData() const { return mData; }
+		//Write line data to target from now on, target must be at least getDataByteSize() bytes. The batch is reset.
+		inline void setDataTarget(void* target) {
+			mData = static_cast<float*>(target);
+			reset();
+		}
+
+		inline size_t getDataByteSize() const { return static_cast<size_t>(mMaxLineCount) * mComponentCount * sizeof(float); }
+		inline bool ownsData() const { return !mOwnedData.empty(); }
+		inline const float* getData() const { return mData; }
 	};
 
 
@@ -4,22 +4,53 @@
 
 namespace DOH {
 
-	RenderBatchQuad::RenderBatchQuad(const uint32_t maxGeometryCount, const uint32_t maxTextureCount)
+	RenderBatchQuad::RenderBatchQuad(const uint32_t maxGeometryCount, const uint32_t maxTextureCount, const bool ownsData)
 	:	ARenderBatch(
 			maxGeometryCount,
 			Quad::BYTE_SIZE,
-			maxTextureCount
+			maxTextureCount,
+			ownsData
 		)
 	{}
 
 	void RenderBatchQuad::add(const Quad& quad, const uint32_t textureSlotIndex) {
-		float texCoordsIndex = 0;
-		float textureSlot = static_cast<float>(textureSlotIndex);
+		addQuad(quad, static_cast<float>(textureSlotIndex));
+		mGeometryCount++;
+	}
+
+	void RenderBatchQuad::addAll(const std::vector<Quad>& quadArr, const uint32_t textureSlotIndex) {
+		const float textureSlot = static_cast<float>(textureSlotIndex);
+
+		for (const Quad& quad : quadArr) {
+			addQuad(quad, textureSlot);
+		}
+
+		mGeometryCount += static_cast<uint32_t>(quadArr.size());
+	}
+
+	void RenderBatchQuad::addAll(
+		const std::vector<Quad>& quadArr,
+		const size_t startIndex,
+		const size_t endIndex,
+		const uint32_t textureSlotIndex
+	) {
+		const float textureSlot = static_cast<float>(textureSlotIndex);
+
+		for (size_t i = startIndex; i < endIndex; i++) {
+			addQuad(quadArr[i], textureSlot);
+		}
+
+		mGeometryCount += static_cast<uint32_t>(endIndex - startIndex);
+	}
+
+	void RenderBatchQuad::addQuad(const Quad& quad, const float textureSlot) {
+		std::array<glm::vec2, 4> corners;
+		quad.getCornersXY(corners);
 
 		//Bot Left
 		addQuadVertex(
-			quad.Position.x,
-			quad.Position.y,
+			corners[0].x,
+			corners[0].y,
 			quad.Position.z,
 			quad.Colour.x,
 			quad.Colour.y,
@@ -32,8 +63,8 @@ namespace DOH {
 
 		//Bot Right
 		addQuadVertex(
-			quad.Position.x + quad.Size.x,
-			quad.Position.y,
+			corners[1].x,
+			corners[1].y,
 			quad.Position.z,
 			quad.Colour.x,
 			quad.Colour.y,
@@ -46,8 +77,8 @@ namespace DOH {
 
 		//Top Right
 		addQuadVertex(
-			quad.Position.x + quad.Size.x,
-			quad.Position.y + quad.Size.y,
+			corners[2].x,
+			corners[2].y,
 			quad.Position.z,
 			quad.Colour.x,
 			quad.Colour.y,
@@ -60,8 +91,8 @@ namespace DOH {
 
 		//Top Left
 		addQuadVertex(
-			quad.Position.x,
-			quad.Position.y + quad.Size.y,
+			corners[3].x,
+			corners[3].y,
 			quad.Position.z,
 			quad.Colour.x,
 			quad.Colour.y,
@@ -71,142 +102,6 @@ namespace DOH {
 			quad.getTextureCoordsTopRightY(),
 			textureSlot
 		);
-
-		mGeometryCount++;
-	}
-
-	void RenderBatchQuad::addAll(const std::vector<Quad>& quadArr, const uint32_t textureSlotIndex) {
-		const float textureSlot = static_cast<float>(textureSlotIndex);
-
-		for (const Quad& quad : quadArr) {
-			//Bot Left
-			addQuadVertex(
-				quad.Position.x,
-				quad.Position.y,
-				quad.Position.z,
-				quad.Colour.x,
-				quad.Colour.y,
-				quad.Colour.z,
-				quad.Colour.w,
-				quad.getTextureCoordsBotLeftX(),
-				quad.getTextureCoordsBotLeftY(),
-				textureSlot
-			);
-
-			//Bot Right
-			addQuadVertex(
-				quad.Position.x + quad.Size.x,
-				quad.Position.y,
-				quad.Position.z,
-				quad.Colour.x,
-				quad.Colour.y,
-				quad.Colour.z,
-				quad.Colour.w,
-				quad.getTextureCoordsTopRightX(),
-				quad.getTextureCoordsBotLeftY(),
-				textureSlot
-			);
-
-			//Top Right
-			addQuadVertex(
-				quad.Position.x + quad.Size.x,
-				quad.Position.y + quad.Size.y,
-				quad.Position.z,
-				quad.Colour.x,
-				quad.Colour.y,
-				quad.Colour.z,
-				quad.Colour.w,
-				quad.getTextureCoordsTopRightX(),
-				quad.getTextureCoordsTopRightY(),
-				textureSlot
-			);
-
-			//Top Left
-			addQuadVertex(
-				quad.Position.x,
-				quad.Position.y + quad.Size.y,
-				quad.Position.z,
-				quad.Colour.x,
-				quad.Colour.y,
-				quad.Colour.z,
-				quad.Colour.w,
-				quad.getTextureCoordsBotLeftX(),
-				quad.getTextureCoordsTopRightY(),
-				textureSlot
-			);
-		}
-
-		mGeometryCount += static_cast<uint32_t>(quadArr.size());
-	}
-
-	void RenderBatchQuad::addAll(
-		const std::vector<Quad>& quadArr,
-		const size_t startIndex,
-		const size_t endIndex,
-		const uint32_t textureSlotIndex
-	) {
-		const float textureSlot = static_cast<float>(textureSlotIndex);
-
-		for (size_t i = startIndex; i < endIndex; i++) {
-			const Quad& quad = quadArr[i];
-			//Bot Left
-			addQuadVertex(
-				quad.Position.x,
-				quad.Position.y,
-				quad.Position.z,
-				quad.Colour.x,
-				quad.Colour.y,
-				quad.Colour.z,
-				quad.Colour.w,
-				quad.getTextureCoordsBotLeftX(),
-				quad.getTextureCoordsBotLeftY(),
-				textureSlot
-			);
-
-			//Bot Right
-			addQuadVertex(
-				quad.Position.x + quad.Size.x,
-				quad.Position.y,
-				quad.Position.z,
-				quad.Colour.x,
-				quad.Colour.y,
-				quad.Colour.z,
-				quad.Colour.w,
-				quad.getTextureCoordsTopRightX(),
-				quad.getTextureCoordsBotLeftY(),
-				textureSlot
-			);
-
-			//Top Right
-			addQuadVertex(
-				quad.Position.x + quad.Size.x,
-				quad.Position.y + quad.Size.y,
-				quad.Position.z,
-				quad.Colour.x,
-				quad.Colour.y,
-				quad.Colour.z,
-				quad.Colour.w,
-				quad.getTextureCoordsTopRightX(),
-				quad.getTextureCoordsTopRightY(),
-				textureSlot
-			);
-
-			//Top Left
-			addQuadVertex(
-				quad.Position.x,
-				quad.Position.y + quad.Size.y,
-				quad.Position.z,
-				quad.Colour.x,
-				quad.Colour.y,
-				quad.Colour.z,
-				quad.Colour.w,
-				quad.getTextureCoordsBotLeftX(),
-				quad.getTextureCoordsTopRightY(),
-				textureSlot
-			);
-		}
-
-		mGeometryCount += static_cast<uint32_t>(endIndex - startIndex);
 	}
 
 	void RenderBatchQuad::addQuadVertex(
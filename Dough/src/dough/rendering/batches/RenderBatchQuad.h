@@ -8,7 +8,7 @@ namespace DOH {
 
 	class RenderBatchQuad : public ARenderBatch<Quad> {
 	public:
-		RenderBatchQuad(const uint32_t maxGeometryCount, const uint32_t maxTextureCount);
+		RenderBatchQuad(const uint32_t maxGeometryCount, const uint32_t maxTextureCount, const bool ownsData = true);
 
 		virtual void add(const Quad& geo, const uint32_t textureSlotIndex) override;
 		virtual void addAll(const std::vector<Quad>& geoArray, const uint32_t textureSlotIndex) override;
@@ -22,6 +22,9 @@ namespace DOH {
 	private:
 		RenderBatchQuad operator=(const RenderBatchQuad& assignment) = delete;
 
+		//Write the 4 vertices of a quad, rotated around its centre when Rotation is non-zero.
+		inline void addQuad(const Quad& quad, const float textureSlot);
+
 		inline void addQuadVertex(
 			const float posX,
 			const float posY,
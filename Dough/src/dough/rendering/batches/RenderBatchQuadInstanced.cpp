@@ -0,0 +1,67 @@
+#include "dough/rendering/batches/RenderBatchQuadInstanced.h"
+
+namespace DOH {
+
+	RenderBatchQuadInstanced::RenderBatchQuadInstanced(const uint32_t maxGeometryCount, const uint32_t maxTextureCount, const bool ownsData)
+	:	ARenderBatch(
+			maxGeometryCount,
+			VertexQuadInstance3d::BYTE_SIZE,
+			maxTextureCount,
+			ownsData
+		)
+	{}
+
+	void RenderBatchQuadInstanced::add(const Quad& quad, const uint32_t textureSlotIndex) {
+		addQuadInstance(quad, static_cast<float>(textureSlotIndex));
+		mGeometryCount++;
+	}
+
+	void RenderBatchQuadInstanced::addAll(const std::vector<Quad>& quadArr, const uint32_t textureSlotIndex) {
+		const float textureSlot = static_cast<float>(textureSlotIndex);
+
+		for (const Quad& quad : quadArr) {
+			addQuadInstance(quad, textureSlot);
+		}
+
+		mGeometryCount += static_cast<uint32_t>(quadArr.size());
+	}
+
+	void RenderBatchQuadInstanced::addAll(
+		const std::vector<Quad>& quadArr,
+		const size_t startIndex,
+		const size_t endIndex,
+		const uint32_t textureSlotIndex
+	) {
+		const float textureSlot = static_cast<float>(textureSlotIndex);
+
+		for (size_t i = startIndex; i < endIndex; i++) {
+			addQuadInstance(quadArr[i], textureSlot);
+		}
+
+		mGeometryCount += static_cast<uint32_t>(endIndex - startIndex);
+	}
+
+	void RenderBatchQuadInstanced::addQuadInstance(const Quad& quad, const float texIndex) {
+		//Layout matches VertexQuadInstance3d
+		float* data = mData + mDataIndex;
+
+		data[0] = quad.Position.x;
+		data[1] = quad.Position.y;
+		data[2] = quad.Position.z;
+		data[3] = quad.Size.x;
+		data[4] = quad.Size.y;
+		data[5] = quad.Rotation;
+		data[6] = quad.Colour.x;
+		data[7] = quad.Colour.y;
+		data[8] = quad.Colour.z;
+		data[9] = quad.Colour.w;
+
+		data[10] = quad.getTextureCoordsBotLeftX();
+		data[11] = quad.getTextureCoordsBotLeftY();
+		data[12] = quad.getTextureCoordsTopRightX();
+		data[13] = quad.getTextureCoordsTopRightY();
+		data[14] = texIndex;
+
+		mDataIndex += VertexQuadInstance3d::COMPONENT_COUNT;
+	}
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "dough/rendering/batches/ARenderBatch.h"
+#include "dough/scene/geometry/primitives/Quad.h"
+#include "dough/rendering/Config.h"
+
+namespace DOH {
+
+	/**
+	* Quad batch that stores a single VertexQuadInstance3d record per quad instead of 4 vertices.
+	* The corners are built in the vertex shader so the batch is drawn non-indexed with one instance per quad.
+	*/
+	class RenderBatchQuadInstanced : public ARenderBatch<Quad> {
+	public:
+		RenderBatchQuadInstanced(const uint32_t maxGeometryCount, const uint32_t maxTextureCount, const bool ownsData = true);
+
+		virtual void add(const Quad& geo, const uint32_t textureSlotIndex) override;
+		virtual void addAll(const std::vector<Quad>& geoArray, const uint32_t textureSlotIndex) override;
+		virtual void addAll(
+			const std::vector<Quad>& quadArr,
+			const size_t startIndex,
+			const size_t endIndex,
+			const uint32_t textureSlotIndex
+		) override;
+
+	private:
+		RenderBatchQuadInstanced operator=(const RenderBatchQuadInstanced& assignment) = delete;
+
+		inline void addQuadInstance(const Quad& quad, const float texIndex);
+	};
+}
@@ -1,6 +1,7 @@
 #include "dough/rendering/buffer/BufferVulkan.h"
 
 #include "dough/rendering/RendererVulkan.h"
+#include "dough/rendering/StagingUploadQueueVulkan.h"
 #include "dough/application/Application.h"
 
 #include <tracy/public/tracy/Tracy.hpp>
@@ -10,37 +11,42 @@ namespace DOH {
 	//Non-staged
 	BufferVulkan::BufferVulkan(
 		VkDevice logicDevice,
-		VkPhysicalDevice physicalDevice,
+		DeviceMemoryAllocatorVulkan& allocator,
 		VkDeviceSize size,
 		VkBufferUsageFlags usage,
 		VkMemoryPropertyFlags props
 	) : mBuffer(VK_NULL_HANDLE),
-		mBufferMemory(VK_NULL_HANDLE),
+		mBufferMemory({}),
 		mSize(size),
-		mData(nullptr)
+		mData(nullptr),
+		mAllocator(allocator),
+		mPendingUploadQueue(nullptr),
+		mPendingUploadBatchId(0)
 	{
 		if (size > 0) {
-			init(logicDevice, physicalDevice, size, usage, props);
+			init(logicDevice, size, usage, props);
 		}
 	}
 
 	//Staged
 	BufferVulkan::BufferVulkan(
 		VkDevice logicDevice,
-		VkPhysicalDevice physicalDevice,
-		VkCommandPool cmdPool,
-		VkQueue graphicsQueue,
+		DeviceMemoryAllocatorVulkan& allocator,
+		StagingUploadQueueVulkan& uploadQueue,
 		const void* data,
 		VkDeviceSize size,
 		VkBufferUsageFlags usage,
 		VkMemoryPropertyFlags props
 	) : mBuffer(VK_NULL_HANDLE),
-		mBufferMemory(VK_NULL_HANDLE),
+		mBufferMemory({}),
 		mSize(size),
-		mData(nullptr)
+		mData(nullptr),
+		mAllocator(allocator),
+		mPendingUploadQueue(nullptr),
+		mPendingUploadBatchId(0)
 	{
 		if (size > 0) {
-			initStaged(logicDevice, physicalDevice, cmdPool, graphicsQueue, data, size, usage, props);
+			initStaged(logicDevice, uploadQueue, data, size, usage, props);
 		}
 	}
 
@@ -49,7 +55,7 @@ namespace DOH {
 		if (isUsingGpuResource()) {
 			LOG_ERR(
 				"Buffer GPU resource NOT released before destructor was called." << 
-				" Handle: " << mBuffer << " Memory: " << mBufferMemory << " Size: " << mSize
+				" Handle: " << mBuffer << " Memory: " << mBufferMemory.Memory << " Size: " << mSize
 			);
 
 			//TODO:: some kind of "lost GPU resources" list to manage?
@@ -64,7 +70,7 @@ namespace DOH {
 		ZoneScoped;
 
 		if (isMapped()) {
-			unmap(logicDevice);
+			unmap();
 		}
 
 		if (isUsingGpuResource()) {
@@ -74,7 +80,6 @@ namespace DOH {
 
 	void BufferVulkan::init(
 		VkDevice logicDevice,
-		VkPhysicalDevice physicalDevice,
 		size_t size,
 		VkBufferUsageFlags usage,
 		VkMemoryPropertyFlags props
@@ -94,33 +99,14 @@ namespace DOH {
 			"Failed to create Vertex Buffer."
 		);
 
-		VkMemoryRequirements memRequirements;
-		vkGetBufferMemoryRequirements(logicDevice, mBuffer, &memRequirements);
-
-		VkMemoryAllocateInfo allocation = {};
-		allocation.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-		allocation.allocationSize = memRequirements.size;
-		allocation.memoryTypeIndex = RendererVulkan::findPhysicalDeviceMemoryType(
-			physicalDevice,
-			memRequirements.memoryTypeBits,
-			props
-		);
-
-		VK_TRY(
-			vkAllocateMemory(logicDevice, &allocation, nullptr, &mBufferMemory),
-			"Failed to allocate buffer memory."
-		);
-
-		vkBindBufferMemory(logicDevice, mBuffer, mBufferMemory, 0);
+		mBufferMemory = mAllocator.allocateBufferMemory(mBuffer, props);
 
 		mUsingGpuResource = true;
 	}
 
 	void BufferVulkan::initStaged(
 		VkDevice logicDevice,
-		VkPhysicalDevice physicalDevice,
-		VkCommandPool cmdPool,
-		VkQueue graphicsQueue,
+		StagingUploadQueueVulkan& uploadQueue,
 		const void* data,
 		size_t size,
 		VkBufferUsageFlags usage,
@@ -133,24 +119,12 @@ namespace DOH {
 		//Add transfer destination bit to usage if not included already
 		usage = usage | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
 
-		BufferVulkan stagingBuffer = BufferVulkan(
-			logicDevice,
-			physicalDevice,
-			size,
-			VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
-		);
-		stagingBuffer.setDataUnmapped(logicDevice, data, size);
-
-		init(logicDevice, physicalDevice, size, usage, props);
-		BufferVulkan::copyBuffer(logicDevice, cmdPool, graphicsQueue, stagingBuffer.getBuffer(), mBuffer, size);
-
-		stagingBuffer.close(logicDevice);
+		init(logicDevice, size, usage, props);
+		uploadQueue.uploadBuffer(*this, data, size);
 	}
 
 	void BufferVulkan::resizeBuffer(
 		VkDevice logicDevice,
-		VkPhysicalDevice physicalDevice,
 		VkDeviceSize size,
 		VkBufferUsageFlags usage,
 		VkMemoryPropertyFlags props
@@ -158,14 +132,12 @@ namespace DOH {
 		ZoneScoped;
 
 		clearBuffer(logicDevice);
-		init(logicDevice, physicalDevice, size, usage, props);
+		init(logicDevice, size, usage, props);
 	}
 
 	void BufferVulkan::resizeBufferStaged(
 		VkDevice logicDevice,
-		VkPhysicalDevice physicalDevice,
-		VkCommandPool cmdPool,
-		VkQueue graphicsQueue,
+		StagingUploadQueueVulkan& uploadQueue,
 		const void* data,
 		VkDeviceSize size,
 		VkBufferUsageFlags usage,
@@ -174,43 +146,51 @@ namespace DOH {
 		ZoneScoped;
 
 		clearBuffer(logicDevice);
-		initStaged(logicDevice, physicalDevice, cmdPool, graphicsQueue, data, size, usage, props);
+		initStaged(logicDevice, uploadQueue, data, size, usage, props);
 	}
 
-	void BufferVulkan::setDataUnmapped(VkDevice logicDevice, const void* data, size_t size) {
+	void BufferVulkan::setDataUnmapped(const void* data, size_t size) {
 		ZoneScoped;
 
 		mSize = size;
-		mData = map(logicDevice, size);
+		mData = map();
 		memcpy(mData, data, size);
-		unmap(logicDevice);
+		unmap();
 	}
 
-	void BufferVulkan::setDataMapped(VkDevice logicDevice, const void* data, size_t size) {
+	void BufferVulkan::setDataMapped(VkDevice logicDevice, const void* data, size_t size, size_t offset) {
 		ZoneScoped;
 
-		memcpy(mData, data, size);
+		memcpy(static_cast<char*>(mData) + offset, data, size);
 	}
 
-	void* BufferVulkan::map(VkDevice logicDevice, size_t size) {
+	void* BufferVulkan::map() {
 		ZoneScoped;
 
-		vkMapMemory(logicDevice, mBufferMemory, 0, size, 0, &mData);
+		if (mBufferMemory.MappedData == nullptr) {
+			LOG_ERR("Failed to map buffer, memory is not host visible. Handle: " << mBuffer);
+		}
+
+		mData = mBufferMemory.MappedData;
 		return mData;
 	}
 
-	void BufferVulkan::unmap(VkDevice logicDevice) {
+	void BufferVulkan::unmap() {
 		ZoneScoped;
 
-		vkUnmapMemory(logicDevice, mBufferMemory);
 		mData = nullptr;
 	}
 
 	void BufferVulkan::clearBuffer(VkDevice logicDevice) {
 		ZoneScoped;
 
+		if (mPendingUploadQueue != nullptr) {
+			mPendingUploadQueue->wait({ mPendingUploadBatchId });
+			mPendingUploadQueue = nullptr;
+		}
+
 		vkDestroyBuffer(logicDevice, mBuffer, nullptr);
-		vkFreeMemory(logicDevice, mBufferMemory, nullptr);
+		mAllocator.free(mBufferMemory);
 
 		mUsingGpuResource = false;
 	}
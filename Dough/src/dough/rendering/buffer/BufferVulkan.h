@@ -1,16 +1,24 @@
 #pragma once
 
 #include "dough/rendering/IGPUResourceVulkan.h"
+#include "dough/rendering/DeviceMemoryAllocatorVulkan.h"
 
 namespace DOH {
 
+	class StagingUploadQueueVulkan;
+
 	class BufferVulkan : public IGPUResourceVulkan {
 
 	protected:
 		VkBuffer mBuffer;
-		VkDeviceMemory mBufferMemory;
+		DeviceMemoryAllocation mBufferMemory;
 		VkDeviceSize mSize;
 		void* mData;
+		//Allocates and frees the buffer's memory
+		DeviceMemoryAllocatorVulkan& mAllocator;
+		//Queue and batch of the last staged upload into this buffer, it's waited on before the buffer is destroyed
+		StagingUploadQueueVulkan* mPendingUploadQueue;
+		uint64_t mPendingUploadBatchId;
 
 	public:
 		BufferVulkan() = delete;
@@ -20,17 +28,16 @@ namespace DOH {
 		//Non-Staged
 		BufferVulkan(
 			VkDevice logicDevice,
-			VkPhysicalDevice physicalDevice,
+			DeviceMemoryAllocatorVulkan& allocator,
 			VkDeviceSize size,
 			VkBufferUsageFlags usage,
 			VkMemoryPropertyFlags props
 		);
-		//Staged
+		//Staged, the upload is recorded into uploadQueue and is done once the queue's batch has been submitted.
 		BufferVulkan(
 			VkDevice logicDevice,
-			VkPhysicalDevice physicalDevice,
-			VkCommandPool cmdPool,
-			VkQueue graphicsQueue,
+			DeviceMemoryAllocatorVulkan& allocator,
+			StagingUploadQueueVulkan& uploadQueue,
 			const void* data,
 			VkDeviceSize size,
 			VkBufferUsageFlags usage,
@@ -40,14 +47,20 @@ namespace DOH {
 		virtual ~BufferVulkan() override;
 		virtual void close(VkDevice logicDevice) override;
 
-		//TODO::mem offset and flags
-		void* map(VkDevice logicDevice, size_t size);
-		void unmap(VkDevice logicDevice);
-		void setDataUnmapped(VkDevice logicDevice, const void* data, size_t size);
-		inline void setDataUnmapped(VkDevice logicDevice, void* data, size_t size) { setDataUnmapped(logicDevice, (const void*) data, size); }
-		void setDataMapped(VkDevice logicDevice, const void* data, size_t size);
-		inline void setDataMapped(VkDevice logicDevice, void* data, size_t size) { setDataMapped(logicDevice, (const void*) data, size); }
+		//NOTE:: Host visible memory is persistently mapped by the memory allocator so this only hands out the mapped address.
+		void* map();
+		void unmap();
+		void setDataUnmapped(const void* data, size_t size);
+		inline void setDataUnmapped(void* data, size_t size) { setDataUnmapped((const void*) data, size); }
+		void setDataMapped(VkDevice logicDevice, const void* data, size_t size, size_t offset = 0);
+		inline void setDataMapped(VkDevice logicDevice, void* data, size_t size, size_t offset = 0) { setDataMapped(logicDevice, (const void*) data, size, offset); }
+		//Waits for any staged upload into the buffer first, submitting it if it's still being recorded.
 		void clearBuffer(VkDevice logicDevice);
+		//Called by StagingUploadQueueVulkan when a copy into this buffer is recorded.
+		inline void setPendingUpload(StagingUploadQueueVulkan& uploadQueue, const uint64_t batchId) {
+			mPendingUploadQueue = &uploadQueue;
+			mPendingUploadBatchId = batchId;
+		}
 
 		void copyToBuffer(BufferVulkan& destination, VkCommandBuffer cmd);
 		void copyFromBuffer(BufferVulkan& source, VkCommandBuffer cmd);
@@ -55,16 +68,13 @@ namespace DOH {
 
 		void resizeBuffer(
 			VkDevice logicDevice,
-			VkPhysicalDevice physicalDevice,
 			VkDeviceSize size,
 			VkBufferUsageFlags usage,
 			VkMemoryPropertyFlags props
 		);
 		void resizeBufferStaged(
 			VkDevice logicDevice,
-			VkPhysicalDevice physicalDevice,
-			VkCommandPool cmdPool,
-			VkQueue graphicsQueue,
+			StagingUploadQueueVulkan& uploadQueue,
 			const void* data,
 			VkDeviceSize size,
 			VkBufferUsageFlags usage,
@@ -72,9 +82,7 @@ namespace DOH {
 		);
 		inline void resizeBufferStaged(
 			VkDevice logicDevice,
-			VkPhysicalDevice physicalDevice,
-			VkCommandPool cmdPool,
-			VkQueue graphicsQueue,
+			StagingUploadQueueVulkan& uploadQueue,
 			void* data,
 			VkDeviceSize size,
 			VkBufferUsageFlags usage,
@@ -82,9 +90,7 @@ namespace DOH {
 		) {
 			resizeBufferStaged(
 				logicDevice,
-				physicalDevice,
-				cmdPool,
-				graphicsQueue,
+				uploadQueue,
 				(const void*) data,
 				size,
 				usage,
@@ -93,23 +99,21 @@ namespace DOH {
 		}
 
 		inline VkBuffer getBuffer() const { return mBuffer; }
-		inline VkDeviceMemory getDeviceMemory() const { return mBufferMemory; }
+		inline VkDeviceMemory getDeviceMemory() const { return mBufferMemory.Memory; }
+		inline VkDeviceSize getDeviceMemoryOffset() const { return mBufferMemory.Offset; }
 		inline VkDeviceSize getSize() const { return mSize; }
 		inline bool isMapped() const { return mData != nullptr; }
 
 	protected:
 		void init(
 			VkDevice logicDevice,
-			VkPhysicalDevice phyiscalDevice,
 			size_t size,
 			VkBufferUsageFlags usage,
 			VkMemoryPropertyFlags props
 		);
 		void initStaged(
 			VkDevice logicDevice,
-			VkPhysicalDevice physicalDevice,
-			VkCommandPool cmdPool,
-			VkQueue graphicsQueue,
+			StagingUploadQueueVulkan& uploadQueue,
 			const void* data,
 			size_t size,
 			VkBufferUsageFlags usage,
@@ -117,6 +121,7 @@ namespace DOH {
 		);
 
 	public:
+		//NOTE:: Blocks until the copy is done, prefer StagingUploadQueueVulkan.
 		static void copyBuffer(
 			VkDevice logicDevice,
 			VkCommandPool cmdPool,
@@ -5,11 +5,11 @@ namespace DOH {
 	//Non-Staged
 	IndexBufferVulkan::IndexBufferVulkan(
 		VkDevice logicDevice,
-		VkPhysicalDevice physicalDevice,
+		DeviceMemoryAllocatorVulkan& allocator,
 		VkDeviceSize size
 	) : BufferVulkan(
 		logicDevice,
-		physicalDevice,
+		allocator,
 		size,
 		VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
 		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
@@ -18,16 +18,14 @@ namespace DOH {
 	//Staged
 	IndexBufferVulkan::IndexBufferVulkan(
 		VkDevice logicDevice,
-		VkPhysicalDevice physicalDevice,
-		VkCommandPool cmdPool,
-		VkQueue graphicsQueue,
+		DeviceMemoryAllocatorVulkan& allocator,
+		StagingUploadQueueVulkan& uploadQueue,
 		const void* data,
 		VkDeviceSize size
 	) : BufferVulkan(
 		logicDevice,
-		physicalDevice,
-		cmdPool,
-		graphicsQueue,
+		allocator,
+		uploadQueue,
 		data,
 		size,
 		VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
@@ -39,7 +37,7 @@ namespace DOH {
 		if (isUsingGpuResource()) {
 			LOG_ERR(
 				"Index Buffer GPU resource NOT released before destructor was called." << 
-				" Handle: " << mBuffer << " Memory: " << mBufferMemory << " Size: " << mSize
+				" Handle: " << mBuffer << " Memory: " << mBufferMemory.Memory << " Size: " << mSize
 			);
 
 			//TODO:: some kind of "lost GPU resources" list to manage?
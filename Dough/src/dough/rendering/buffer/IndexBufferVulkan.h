@@ -13,15 +13,14 @@ namespace DOH {
 		//Non-Staged
 		IndexBufferVulkan(
 			VkDevice logicDevice,
-			VkPhysicalDevice physicalDevice,
+			DeviceMemoryAllocatorVulkan& allocator,
 			VkDeviceSize size
 		);
 		//Staged
 		IndexBufferVulkan(
 			VkDevice logicDevice,
-			VkPhysicalDevice physicalDevice,
-			VkCommandPool cmdPool,
-			VkQueue graphicsQueue,
+			DeviceMemoryAllocatorVulkan& allocator,
+			StagingUploadQueueVulkan& uploadQueue,
 			const void* data,
 			VkDeviceSize size
 		);
@@ -0,0 +1,150 @@
+#include "dough/rendering/buffer/UploadRingVulkan.h"
+
+#include "dough/rendering/RenderingContextVulkan.h"
+#include "dough/Logging.h"
+
+#include <tracy/public/tracy/Tracy.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace DOH {
+
+	UploadRingVulkan::UploadRingVulkan(RenderingContextVulkan& context, const size_t frameCount, const size_t frameRegionByteSize)
+	:	mContext(context),
+		mBuffer(nullptr),
+		mMappedData(nullptr),
+		mFrameCount(frameCount),
+		mFrameRegionByteSize(alignUp(frameRegionByteSize, ALLOCATION_ALIGNMENT)),
+		mFrameIndex(0),
+		mFrameCursor(0),
+		mFrameNumber(0),
+		mFrameUsedBytes(0),
+		mLastFrameUsedBytes(0),
+		mPeakFrameUsedBytes(0),
+		mFrameAllocationCount(0),
+		mLastFrameAllocationCount(0),
+		mGrowCount(0)
+	{}
+
+	void UploadRingVulkan::addOwnedResourcesToClose(RenderingContextVulkan& context) {
+		if (mBuffer != nullptr) {
+			context.addGpuResourceToClose(mBuffer);
+			mBuffer = nullptr;
+			mMappedData = nullptr;
+		}
+	}
+
+	void UploadRingVulkan::init() {
+		ZoneScoped;
+
+		createBuffer(mFrameRegionByteSize);
+	}
+
+	void UploadRingVulkan::beginFrame(const size_t frameIndex) {
+		ZoneScoped;
+
+		mLastFrameUsedBytes = mFrameUsedBytes;
+		mLastFrameAllocationCount = mFrameAllocationCount;
+		mPeakFrameUsedBytes = std::max(mPeakFrameUsedBytes, mFrameUsedBytes);
+
+		mFrameIndex = frameIndex;
+		mFrameCursor = 0;
+		mFrameNumber++;
+		mFrameUsedBytes = 0;
+		mFrameAllocationCount = 0;
+	}
+
+	UploadRingAllocation UploadRingVulkan::allocate(const size_t size) {
+		ZoneScoped;
+
+		const size_t alignedSize = alignUp(size, ALLOCATION_ALIGNMENT);
+		if (mBuffer == nullptr) {
+			LOG_ERR("UploadRingVulkan::allocate called before init or after close");
+			return {};
+		} else if (mFrameCursor + alignedSize > mFrameRegionByteSize) {
+			grow(mFrameUsedBytes + alignedSize);
+		}
+
+		const size_t offset = mFrameIndex * mFrameRegionByteSize + mFrameCursor;
+		mFrameCursor += alignedSize;
+		mFrameUsedBytes += alignedSize;
+		mFrameAllocationCount++;
+
+		UploadRingAllocation allocation = {};
+		allocation.Buffer = mBuffer;
+		allocation.Offset = static_cast<VkDeviceSize>(offset);
+		allocation.Data = mMappedData + offset;
+		allocation.Size = size;
+		allocation.FrameNumber = mFrameNumber;
+		return allocation;
+	}
+
+	bool UploadRingVulkan::extend(UploadRingAllocation& allocation, const size_t size) {
+		ZoneScoped;
+
+		if (size <= allocation.Size) {
+			return allocation.isValid();
+		} else if (allocation.Buffer != mBuffer || allocation.FrameNumber != mFrameNumber || mBuffer == nullptr) {
+			return false;
+		}
+
+		const size_t regionOffset = mFrameIndex * mFrameRegionByteSize;
+		const size_t allocationCursor = static_cast<size_t>(allocation.Offset) - regionOffset;
+		const size_t oldAlignedSize = alignUp(allocation.Size, ALLOCATION_ALIGNMENT);
+		const size_t newAlignedSize = alignUp(size, ALLOCATION_ALIGNMENT);
+		//Anything allocated after it is in the way
+		if (allocationCursor + oldAlignedSize != mFrameCursor || allocationCursor + newAlignedSize > mFrameRegionByteSize) {
+			return false;
+		}
+
+		mFrameCursor += newAlignedSize - oldAlignedSize;
+		mFrameUsedBytes += newAlignedSize - oldAlignedSize;
+		allocation.Size = size;
+		return true;
+	}
+
+	UploadRingAllocation UploadRingVulkan::upload(const void* data, const size_t size) {
+		ZoneScoped;
+
+		UploadRingAllocation allocation = allocate(size);
+		if (allocation.isValid()) {
+			memcpy(allocation.Data, data, size);
+		}
+		return allocation;
+	}
+
+	void UploadRingVulkan::createBuffer(const size_t frameRegionByteSize) {
+		ZoneScoped;
+
+		const size_t totalByteSize = frameRegionByteSize * mFrameCount;
+
+		//NOTE:: The ring holds vertices of many different types, the layout given here is never used for binding
+		// since the pipeline of each renderable defines how the data at an allocation's offset is read.
+		mBuffer = mContext.createVertexBuffer(
+			StaticVertexInputLayout::get(EVertexType::VERTEX_3D),
+			totalByteSize,
+			VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
+		);
+		mMappedData = static_cast<char*>(mBuffer->map());
+		mFrameRegionByteSize = frameRegionByteSize;
+	}
+
+	void UploadRingVulkan::grow(const size_t minFrameRegionByteSize) {
+		ZoneScoped;
+
+		size_t newRegionByteSize = mFrameRegionByteSize;
+		while (newRegionByteSize < minFrameRegionByteSize) {
+			newRegionByteSize *= 2;
+		}
+
+		LOG_INFO("UploadRingVulkan growing frame region from " << mFrameRegionByteSize << " to " << newRegionByteSize << " bytes");
+
+		//Allocations from this frame and the frame still in flight keep using the old buffer until it is closed.
+		mContext.addGpuResourceToClose(mBuffer);
+		createBuffer(newRegionByteSize);
+		mFrameCursor = 0;
+		mGrowCount++;
+	}
+}
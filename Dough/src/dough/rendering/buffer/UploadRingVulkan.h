@@ -0,0 +1,98 @@
+#pragma once
+
+#include "dough/rendering/buffer/VertexBufferVulkan.h"
+
+#include <memory>
+
+namespace DOH {
+
+	/**
+	* A region of the upload ring for the current frame.
+	* Buffer is bound with Offset, Data is the persistently mapped address of Offset and is valid until the end of the frame.
+	*/
+	struct UploadRingAllocation {
+		std::shared_ptr<VertexBufferVulkan> Buffer = nullptr;
+		VkDeviceSize Offset = 0;
+		void* Data = nullptr;
+		size_t Size = 0;
+		//UploadRingVulkan::getFrameNumber() when allocated
+		uint64_t FrameNumber = 0;
+
+		inline bool isValid() const { return Buffer != nullptr; }
+	};
+
+	/**
+	* Single persistently mapped host visible vertex buffer shared by all of the built-in renderers.
+	*
+	* The buffer is partitioned into one region per frame in flight. Each frame the region of the current frame is reset and renderers
+	* sub-allocate from it linearly, then bind the ring buffer with the allocation's offset. Since the frame's fence has been waited on
+	* before the region is reset the GPU is never reading memory that is being written to.
+	*
+	* When a frame needs more than a region the ring grows geometrically: a new buffer is created and the old one is added to the
+	* deferred close queue, so allocations already recorded this frame (and by the frame still in flight) stay valid.
+	*/
+	class UploadRingVulkan : public IGPUResourceOwnerVulkan {
+	public:
+		static constexpr size_t DEFAULT_FRAME_REGION_BYTE_SIZE = 4 * 1024 * 1024;
+		//Allocations are aligned so any vertex attribute read from an offset is aligned to its component size.
+		static constexpr size_t ALLOCATION_ALIGNMENT = 16;
+
+	private:
+		RenderingContextVulkan& mContext;
+		std::shared_ptr<VertexBufferVulkan> mBuffer;
+		char* mMappedData;
+		size_t mFrameCount;
+		size_t mFrameRegionByteSize;
+		size_t mFrameIndex;
+		size_t mFrameCursor;
+		//Incremented every frame so users can tell if an allocation they're holding is from a previous frame.
+		uint64_t mFrameNumber;
+
+		//-----Debug information-----
+		size_t mFrameUsedBytes;
+		size_t mLastFrameUsedBytes;
+		size_t mPeakFrameUsedBytes;
+		uint32_t mFrameAllocationCount;
+		uint32_t mLastFrameAllocationCount;
+		uint32_t mGrowCount;
+
+	public:
+		UploadRingVulkan(RenderingContextVulkan& context, const size_t frameCount, const size_t frameRegionByteSize = DEFAULT_FRAME_REGION_BYTE_SIZE);
+
+		UploadRingVulkan(const UploadRingVulkan& copy) = delete;
+		UploadRingVulkan operator=(const UploadRingVulkan& assignment) = delete;
+
+		virtual void addOwnedResourcesToClose(RenderingContextVulkan& context) override;
+
+		void init();
+		//Reset the region of frameIndex, only call once the fence of frameIndex has been waited on.
+		void beginFrame(const size_t frameIndex);
+
+		//Reserve size bytes in the current frame's region, growing the ring if the region is full.
+		UploadRingAllocation allocate(const size_t size);
+		//Allocate and copy data into the ring.
+		UploadRingAllocation upload(const void* data, const size_t size);
+		/**
+		* Grow allocation in place to size bytes, keeping what has already been written to it.
+		* Only possible for the most recent allocation of the current frame while the region has space, the ring is never grown by this.
+		*
+		* @returns True if allocation now holds size bytes.
+		*/
+		bool extend(UploadRingAllocation& allocation, const size_t size);
+
+		inline uint64_t getFrameNumber() const { return mFrameNumber; }
+		inline size_t getFrameRegionByteSize() const { return mFrameRegionByteSize; }
+		inline size_t getTotalByteSize() const { return mFrameRegionByteSize * mFrameCount; }
+		inline size_t getCurrentFrameUsedBytes() const { return mFrameUsedBytes; }
+		inline size_t getLastFrameUsedBytes() const { return mLastFrameUsedBytes; }
+		inline size_t getPeakFrameUsedBytes() const { return mPeakFrameUsedBytes; }
+		inline uint32_t getLastFrameAllocationCount() const { return mLastFrameAllocationCount; }
+		inline uint32_t getGrowCount() const { return mGrowCount; }
+
+	private:
+		void createBuffer(const size_t frameRegionByteSize);
+		void grow(const size_t minFrameRegionByteSize);
+
+		static constexpr size_t alignUp(const size_t value, const size_t alignment) { return (value + alignment - 1) & ~(alignment - 1); }
+	};
+}
@@ -12,6 +12,11 @@ namespace DOH {
 	VertexArrayVulkan::VertexArrayVulkan()
 	:	mIndexBuffer(nullptr),
 		mDrawCount(0),
+		mInstanceCount(1),
+		mFirstVertex(0),
+		mFirstInstance(0),
+		mVertexBufferOffset(0),
+		mSharingVertexBuffer(false),
 		mSharingIndexBuffer(false),
 		mPushConstantData(nullptr)
 	{}
@@ -75,7 +80,7 @@ namespace DOH {
 			debugInfo.VertexArrayBinds++;
 		} else {
 			VkBuffer buffer = mVertexBuffers[0]->getBuffer();
-			VkDeviceSize offset = 0;
+			VkDeviceSize offset = mVertexBufferOffset;
 			vkCmdBindVertexBuffers(
 				cmd,
 				0,
@@ -107,9 +112,25 @@ namespace DOH {
 		}
 	}
 
+	void VertexArrayVulkan::setSharedVertexBuffer(std::shared_ptr<VertexBufferVulkan> vertexBuffer, VkDeviceSize offset) {
+		if (!mSharingVertexBuffer && mVertexBuffers.size() > 0) {
+			LOG_WARN("Replacing owned VBO(s) of VAO with a shared VBO, owned VBO(s) must be closed by the caller");
+		}
+
+		mVertexBuffers.clear();
+		mVertexBuffers.emplace_back(vertexBuffer);
+		mVertexBufferOffset = offset;
+		mSharingVertexBuffer = true;
+	}
+
 	void VertexArrayVulkan::closeVertexBuffers(VkDevice logicDevice) {
 		ZoneScoped;
 
+		if (mSharingVertexBuffer) {
+			mVertexBuffers.clear();
+			return;
+		}
+
 		for (std::shared_ptr<VertexBufferVulkan> vbo : mVertexBuffers) {
 			vbo->close(logicDevice);
 		}
@@ -120,8 +141,10 @@ namespace DOH {
 	void VertexArrayVulkan::close(VkDevice logicDevice) {
 		ZoneScoped;
 
-		for (std::shared_ptr<VertexBufferVulkan> vertexBuffer : mVertexBuffers) {
-			vertexBuffer->close(logicDevice);
+		if (!mSharingVertexBuffer) {
+			for (std::shared_ptr<VertexBufferVulkan> vertexBuffer : mVertexBuffers) {
+				vertexBuffer->close(logicDevice);
+			}
 		}
 
 		if (!mSharingIndexBuffer && mIndexBuffer != nullptr) {
@@ -132,9 +155,11 @@ namespace DOH {
 	}
 
 	bool VertexArrayVulkan::isUsingGpuResource() const {
-		for (std::shared_ptr<VertexBufferVulkan> vertexBuffer : mVertexBuffers) {
-			if (vertexBuffer->isUsingGpuResource()) {
-				return true;
+		if (!mSharingVertexBuffer) {
+			for (std::shared_ptr<VertexBufferVulkan> vertexBuffer : mVertexBuffers) {
+				if (vertexBuffer->isUsingGpuResource()) {
+					return true;
+				}
 			}
 		}
 
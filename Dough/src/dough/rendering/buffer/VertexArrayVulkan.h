@@ -18,6 +18,11 @@ namespace DOH {
 		std::vector<std::shared_ptr<VertexBufferVulkan>> mVertexBuffers;
 		std::shared_ptr<IndexBufferVulkan> mIndexBuffer;
 		uint32_t mDrawCount; //Index Count for drawIndexed or Vertex Count for drawVertex
+		uint32_t mInstanceCount; //Instance count for both drawIndexed and drawVertex, 1 when not instancing
+		uint32_t mFirstVertex; //Vertex offset added to each index for drawIndexed or first vertex for drawVertex
+		uint32_t mFirstInstance; //First instance for both drawIndexed and drawVertex
+		VkDeviceSize mVertexBufferOffset; //Byte offset the VBO is bound at, used when the VBO is a region of a shared buffer
+		bool mSharingVertexBuffer;
 		bool mSharingIndexBuffer;
 		void* mPushConstantData;
 
@@ -34,10 +39,19 @@ namespace DOH {
 
 		void bind(VkCommandBuffer cmdBuffer);
 		void addVertexBuffer(std::shared_ptr<VertexBufferVulkan> vertexBuffer);
+		//Use a region of a buffer owned by something else (e.g. the context's UploadRingVulkan), the buffer is not closed by this VAO.
+		void setSharedVertexBuffer(std::shared_ptr<VertexBufferVulkan> vertexBuffer, VkDeviceSize offset);
 		void closeVertexBuffers(VkDevice logicDevice);
 
 		inline void setDrawCount(uint32_t drawCount) { mDrawCount = drawCount; }
 		inline uint32_t getDrawCount() const { return mDrawCount; }
+		inline void setInstanceCount(uint32_t instanceCount) { mInstanceCount = instanceCount; }
+		inline uint32_t getInstanceCount() const { return mInstanceCount; }
+		inline void setFirstVertex(uint32_t firstVertex) { mFirstVertex = firstVertex; }
+		inline uint32_t getFirstVertex() const { return mFirstVertex; }
+		inline void setFirstInstance(uint32_t firstInstance) { mFirstInstance = firstInstance; }
+		inline uint32_t getFirstInstance() const { return mFirstInstance; }
+		inline VkDeviceSize getVertexBufferOffset() const { return mVertexBufferOffset; }
 		inline void setIndexBuffer(std::shared_ptr<IndexBufferVulkan> indexBuffer, bool sharing = false) { mIndexBuffer = indexBuffer; mSharingIndexBuffer = sharing; }
 		inline IndexBufferVulkan& getIndexBuffer() const { return *mIndexBuffer; }
 		inline std::vector<std::shared_ptr<VertexBufferVulkan>>& getVertexBuffers() { return mVertexBuffers; }
@@ -6,11 +6,11 @@ namespace DOH {
 	VertexBufferVulkan::VertexBufferVulkan(
 		const AVertexInputLayout& vertexInputLayout,
 		VkDevice logicDevice,
-		VkPhysicalDevice physicalDevice,
+		DeviceMemoryAllocatorVulkan& allocator,
 		VkDeviceSize size,
 		VkBufferUsageFlags usage,
 		VkMemoryPropertyFlags props
-	) : BufferVulkan(logicDevice, physicalDevice, size, usage, props),
+	) : BufferVulkan(logicDevice, allocator, size, usage, props),
 		mVertexInputLayout(vertexInputLayout)
 	{}
 
@@ -18,14 +18,13 @@ namespace DOH {
 	VertexBufferVulkan::VertexBufferVulkan(
 		const AVertexInputLayout& vertexInputLayout,
 		VkDevice logicDevice,
-		VkPhysicalDevice physicalDevice,
-		VkCommandPool cmdPool,
-		VkQueue graphicsQueue,
+		DeviceMemoryAllocatorVulkan& allocator,
+		StagingUploadQueueVulkan& uploadQueue,
 		const void* data,
 		VkDeviceSize size,
 		VkBufferUsageFlags usage,
 		VkMemoryPropertyFlags props
-	) : BufferVulkan(logicDevice, physicalDevice, cmdPool, graphicsQueue, data, size, usage, props),
+	) : BufferVulkan(logicDevice, allocator, uploadQueue, data, size, usage, props),
 		mVertexInputLayout(vertexInputLayout)
 	{}
 
@@ -33,7 +32,7 @@ namespace DOH {
 		if (isUsingGpuResource()) {
 			LOG_ERR(
 				"Vertex Array GPU resource NOT released before destructor was called." <<
-				" Handle: " << mBuffer << " Device Memory: " << mBufferMemory << " Size: "<< mSize
+				" Handle: " << mBuffer << " Device Memory: " << mBufferMemory.Memory << " Size: "<< mSize
 			);
 		}
 	}
@@ -22,7 +22,7 @@ namespace DOH {
 		VertexBufferVulkan(
 			const AVertexInputLayout& vertexInputLayout,
 			VkDevice logicDevice,
-			VkPhysicalDevice physicalDevice,
+			DeviceMemoryAllocatorVulkan& allocator,
 			VkDeviceSize size,
 			VkBufferUsageFlags usage,
 			VkMemoryPropertyFlags props
@@ -31,9 +31,8 @@ namespace DOH {
 		VertexBufferVulkan(
 			const AVertexInputLayout& vertexInputLayout,
 			VkDevice logicDevice,
-			VkPhysicalDevice physicalDevice,
-			VkCommandPool cmdPool,
-			VkQueue graphicsQueue,
+			DeviceMemoryAllocatorVulkan& allocator,
+			StagingUploadQueueVulkan& uploadQueue,
 			const void* data,
 			VkDeviceSize size,
 			VkBufferUsageFlags usage,
@@ -6,6 +6,7 @@
 #include "dough/rendering/RenderPassVulkan.h"
 #include "dough/rendering/RenderingContextVulkan.h"
 #include "dough/rendering/renderables/SimpleRenderable.h"
+#include "dough/time/Time.h"
 
 #include <tracy/public/tracy/Tracy.hpp>
 
@@ -21,10 +22,11 @@ namespace DOH {
 		return *mOptionalFields;
 	}
 
-	GraphicsPipelineVulkan::GraphicsPipelineVulkan(GraphicsPipelineInstanceInfo& instanceInfo)
+	GraphicsPipelineVulkan::GraphicsPipelineVulkan(GraphicsPipelineInstanceInfo& instanceInfo, PipelineCacheVulkan& pipelineCache)
 	:	mGraphicsPipeline(VK_NULL_HANDLE),
 		mGraphicsPipelineLayout(VK_NULL_HANDLE),
-		mInstanceInfo(instanceInfo)
+		mInstanceInfo(instanceInfo),
+		mPipelineCache(pipelineCache)
 	{}
 
 	GraphicsPipelineVulkan::~GraphicsPipelineVulkan() {
@@ -52,18 +54,18 @@ namespace DOH {
 		mUsingGpuResource = false;
 	}
 
-	void GraphicsPipelineVulkan::init(VkDevice logicDevice, VkExtent2D extent, VkRenderPass renderPass) {
+	void GraphicsPipelineVulkan::init(VkDevice logicDevice, VkRenderPass renderPass) {
 		ZoneScoped;
 
 		createPipelineLayout(logicDevice);
-		createPipeline(logicDevice, extent, renderPass);
+		createPipeline(logicDevice, renderPass);
 	}
 
-	void GraphicsPipelineVulkan::resize(VkDevice logicDevice, VkExtent2D extent, VkRenderPass renderPass) {
+	void GraphicsPipelineVulkan::recreate(VkDevice logicDevice, VkRenderPass renderPass) {
 		ZoneScoped;
 
 		vkDestroyPipeline(logicDevice, mGraphicsPipeline, nullptr);
-		createPipeline(logicDevice, extent, renderPass);
+		createPipeline(logicDevice, renderPass);
 	}
 
 	void GraphicsPipelineVulkan::recordDrawCommand(uint32_t imageIndex, VkCommandBuffer cmd, IRenderable& renderable, CurrentBindingsState& currentBindings, uint32_t descSetOffset) {
@@ -114,10 +116,11 @@ namespace DOH {
 		// Not using vao.bind() because that also calls ib.bind(). Currently trying to "un-link" that
 		// AND this only works for single VAOs with a single vb
 		const VkBuffer vb = renderable.getVao().getVertexBuffers()[0]->getBuffer();
-		if (currentBindings.VertexBuffer != vb) {
-			VkDeviceSize offset = 0;
-			vkCmdBindVertexBuffers(cmd, 0, 1, &vb, &offset);
+		const VkDeviceSize vbOffset = renderable.getVao().getVertexBufferOffset();
+		if (currentBindings.VertexBuffer != vb || currentBindings.VertexBufferOffset != vbOffset) {
+			vkCmdBindVertexBuffers(cmd, 0, 1, &vb, &vbOffset);
 			currentBindings.VertexBuffer = vb;
+			currentBindings.VertexBufferOffset = vbOffset;
 		}
 
 		for (const VkPushConstantRange& pushConstant : mInstanceInfo.getShaderProgram().getDescriptorSetLayouts().getPushConstants()) {
@@ -142,13 +145,19 @@ namespace DOH {
 			vkCmdDrawIndexed(
 				cmd,
 				renderable.getVao().getDrawCount(),
-				1,
+				renderable.getVao().getInstanceCount(),
 				0,
-				0,
-				0
+				static_cast<int32_t>(renderable.getVao().getFirstVertex()),
+				renderable.getVao().getFirstInstance()
 			);
 		} else {
-			vkCmdDraw(cmd, renderable.getVao().getDrawCount(), 1, 0, 0);
+			vkCmdDraw(
+				cmd,
+				renderable.getVao().getDrawCount(),
+				renderable.getVao().getInstanceCount(),
+				renderable.getVao().getFirstVertex(),
+				renderable.getVao().getFirstInstance()
+			);
 		}
 	}
 
@@ -174,7 +183,7 @@ namespace DOH {
 		mUsingGpuResource = true;
 	}
 
-	void GraphicsPipelineVulkan::createPipeline(VkDevice logicDevice, VkExtent2D extent, VkRenderPass renderPass) {
+	void GraphicsPipelineVulkan::createPipeline(VkDevice logicDevice, VkRenderPass renderPass) {
 		ZoneScoped;
 
 		//Make sure shaders are loaded
@@ -207,7 +216,9 @@ namespace DOH {
 		VkVertexInputBindingDescription vertexBindingDesc = {};
 		vertexBindingDesc.binding = binding;
 		vertexBindingDesc.stride = mInstanceInfo.getVertexInputLayout().getStride();
-		vertexBindingDesc.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+		vertexBindingDesc.inputRate = mInstanceInfo.hasOptionalFields() ?
+			mInstanceInfo.getOptionalFields().VertexInputRate :
+			VK_VERTEX_INPUT_RATE_VERTEX;
 
 		vertexInputInfo.vertexBindingDescriptionCount = 1;
 		vertexInputInfo.pVertexBindingDescriptions = &vertexBindingDesc;
@@ -218,24 +229,19 @@ namespace DOH {
 		inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
 		inputAssembly.primitiveRestartEnable = VK_FALSE;
 
-		VkViewport viewport = {};
-		viewport.x = 0.0f;
-		viewport.y = 0.0f;
-		viewport.width = static_cast<float>(extent.width);
-		viewport.height = static_cast<float>(extent.height);
-		viewport.minDepth = 0.0f;
-		viewport.maxDepth = 1.0f;
-
-		VkRect2D scissorRectangle = {};
-		scissorRectangle.offset = { 0, 0 };
-		scissorRectangle.extent = extent;
-
+		//Viewport and scissor are set when the render pass begins so the pipeline doesn't depend on the swap chain extent.
 		VkPipelineViewportStateCreateInfo viewportState = {};
 		viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
 		viewportState.viewportCount = 1;
-		viewportState.pViewports = &viewport;
+		viewportState.pViewports = nullptr;
 		viewportState.scissorCount = 1;
-		viewportState.pScissors = &scissorRectangle;
+		viewportState.pScissors = nullptr;
+
+		const std::array<VkDynamicState, 2> dynamicStates = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+		VkPipelineDynamicStateCreateInfo dynamicState = {};
+		dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+		dynamicState.dynamicStateCount = static_cast<uint32_t>(dynamicStates.size());
+		dynamicState.pDynamicStates = dynamicStates.data();
 
 		VkPipelineRasterizationStateCreateInfo rasterizer = {};
 		rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
@@ -279,6 +285,7 @@ namespace DOH {
 		pipelineCreateInfo.renderPass = renderPass;
 		pipelineCreateInfo.subpass = 0;
 		pipelineCreateInfo.pDepthStencilState = &depthStencil;
+		pipelineCreateInfo.pDynamicState = &dynamicState;
 
 		//Optional Fields
 		if (mInstanceInfo.hasOptionalFields()) {
@@ -324,10 +331,12 @@ namespace DOH {
 			depthStencil.depthBoundsTestEnable = VK_FALSE;
 		}
 
+		const double creationStartTimeMillis = Time::getCurrentTimeMillis();
 		VK_TRY(
-			vkCreateGraphicsPipelines(logicDevice, VK_NULL_HANDLE, 1, &pipelineCreateInfo, nullptr, &mGraphicsPipeline),
+			vkCreateGraphicsPipelines(logicDevice, mPipelineCache.get(), 1, &pipelineCreateInfo, nullptr, &mGraphicsPipeline),
 			"Failed to create Graphics Pipeline."
 		);
+		mPipelineCache.recordPipelineCreation(Time::getCurrentTimeMillis() - creationStartTimeMillis);
 
 		mUsingGpuResource = true;
 
@@ -9,6 +9,7 @@ namespace DOH {
 
 	class AVertexInputLayout;
 	class IRenderable;
+	class PipelineCacheVulkan;
 	enum class ERenderPass;
 	struct CurrentBindingsState;
 
@@ -22,6 +23,8 @@ namespace DOH {
 		VkPolygonMode PolygonMode = VK_POLYGON_MODE_FILL;
 		VkPrimitiveTopology Topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
 		VkFrontFace FrontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+		//Input rate of the vertex input binding, VK_VERTEX_INPUT_RATE_INSTANCE for pipelines that read one record per instance.
+		VkVertexInputRate VertexInputRate = VK_VERTEX_INPUT_RATE_VERTEX;
 
 		VkCompareOp DepthCompareOp = VK_COMPARE_OP_NEVER;
 
@@ -94,6 +97,8 @@ namespace DOH {
 		VkPipeline mGraphicsPipeline;
 		VkPipelineLayout mGraphicsPipelineLayout;
 		GraphicsPipelineInstanceInfo& mInstanceInfo;
+		//Shared by every pipeline, see RenderingContextVulkan::getPipelineCache
+		PipelineCacheVulkan& mPipelineCache;
 		std::vector<std::shared_ptr<IRenderable>> mRenderableDrawList;
 
 	public:
@@ -101,13 +106,14 @@ namespace DOH {
 		GraphicsPipelineVulkan(const GraphicsPipelineVulkan& copy) = delete;
 		GraphicsPipelineVulkan operator=(const GraphicsPipelineVulkan& assignment) = delete;
 
-		GraphicsPipelineVulkan(GraphicsPipelineInstanceInfo& instanceInfo);
+		GraphicsPipelineVulkan(GraphicsPipelineInstanceInfo& instanceInfo, PipelineCacheVulkan& pipelineCache);
 
 		virtual ~GraphicsPipelineVulkan() override;
 		virtual void close(VkDevice logicDevice) override;
 
-		void init(VkDevice logicDevice, VkExtent2D extent, VkRenderPass renderPass);
-		void resize(VkDevice logicDevice, VkExtent2D extent, VkRenderPass renderPass);
+		void init(VkDevice logicDevice, VkRenderPass renderPass);
+		//Only needed when renderPass is no longer compatible with the one the pipeline was created with, resizing doesn't require it.
+		void recreate(VkDevice logicDevice, VkRenderPass renderPass);
 		void recordDrawCommand(uint32_t imageIndex, VkCommandBuffer cmd, IRenderable& renderable, CurrentBindingsState& currentBindings, uint32_t descSetOffset);
 		inline void addRenderableToDraw(std::shared_ptr<IRenderable> renderable) { mRenderableDrawList.emplace_back(renderable); }
 		inline void clearRenderableToDraw() { mRenderableDrawList.clear(); }
@@ -122,7 +128,7 @@ namespace DOH {
 
 	private:
 		void createPipelineLayout(VkDevice logicDevice);
-		void createPipeline(VkDevice logicDevice, VkExtent2D extent, VkRenderPass renderPass);
+		void createPipeline(VkDevice logicDevice, VkRenderPass renderPass);
 	};
 
 	class PipelineRenderableConveyor {
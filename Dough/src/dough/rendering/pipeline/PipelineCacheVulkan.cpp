@@ -0,0 +1,169 @@
+#include "dough/rendering/pipeline/PipelineCacheVulkan.h"
+
+#include "dough/Utils.h"
+#include "dough/files/ResourceHandler.h"
+#include "dough/files/FileView.h"
+
+#include <tracy/public/tracy/Tracy.hpp>
+
+#include <fstream>
+#include <cstdio>
+
+namespace DOH {
+
+	PipelineCacheVulkan::PipelineCacheVulkan(VkDevice logicDevice, const char* filePath)
+	:	mLogicDevice(logicDevice),
+		mPipelineCache(VK_NULL_HANDLE),
+		mFilePath(filePath),
+		mDeviceHeader({}),
+		mLoadedFromFile(false),
+		mLoadedByteSize(0),
+		mPipelineCreationCount(0),
+		mPipelineCreationTimeMillis(0.0)
+	{}
+
+	void PipelineCacheVulkan::init(const VkPhysicalDeviceProperties& deviceProperties) {
+		ZoneScoped;
+
+		mDeviceHeader.Magic = FILE_MAGIC;
+		mDeviceHeader.FileVersion = FILE_VERSION;
+		mDeviceHeader.VendorId = deviceProperties.vendorID;
+		mDeviceHeader.DeviceId = deviceProperties.deviceID;
+		mDeviceHeader.DriverVersion = deviceProperties.driverVersion;
+		memcpy(mDeviceHeader.PipelineCacheUuid, deviceProperties.pipelineCacheUUID, VK_UUID_SIZE);
+
+		//Only held for this function, the file is written to again on close()
+		std::shared_ptr<const FileView> fileData;
+		const char* cacheData = nullptr;
+		size_t cacheDataSize = 0;
+		if (ResourceHandler::doesFileExist(mFilePath.c_str())) {
+			fileData = ResourceHandler::openFileView(mFilePath.c_str());
+			if (fileData != nullptr) {
+				cacheData = getValidCacheData(fileData->getView(), cacheDataSize);
+			}
+
+			if (cacheData == nullptr) {
+				LOG_INFO("Pipeline cache file does not match the current device or driver, starting with an empty cache: " << mFilePath);
+			}
+		}
+
+		VkPipelineCacheCreateInfo cacheCreateInfo = {};
+		cacheCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+		cacheCreateInfo.initialDataSize = cacheDataSize;
+		cacheCreateInfo.pInitialData = cacheData;
+
+		if (vkCreatePipelineCache(mLogicDevice, &cacheCreateInfo, nullptr, &mPipelineCache) != VK_SUCCESS) {
+			//Drivers may still reject data that passed the header checks, an empty cache is always valid.
+			LOG_WARN("Failed to create pipeline cache from file data, starting with an empty cache: " << mFilePath);
+			cacheCreateInfo.initialDataSize = 0;
+			cacheCreateInfo.pInitialData = nullptr;
+			cacheData = nullptr;
+			cacheDataSize = 0;
+
+			VK_TRY(
+				vkCreatePipelineCache(mLogicDevice, &cacheCreateInfo, nullptr, &mPipelineCache),
+				"Failed to create pipeline cache."
+			);
+		}
+
+		mLoadedFromFile = cacheData != nullptr;
+		mLoadedByteSize = cacheDataSize;
+	}
+
+	void PipelineCacheVulkan::close() {
+		ZoneScoped;
+
+		if (mPipelineCache != VK_NULL_HANDLE) {
+			save();
+			vkDestroyPipelineCache(mLogicDevice, mPipelineCache, nullptr);
+			mPipelineCache = VK_NULL_HANDLE;
+		}
+	}
+
+	bool PipelineCacheVulkan::save() const {
+		ZoneScoped;
+
+		size_t dataSize = 0;
+		if (vkGetPipelineCacheData(mLogicDevice, mPipelineCache, &dataSize, nullptr) != VK_SUCCESS || dataSize == 0) {
+			return false;
+		}
+
+		std::vector<char> data(dataSize);
+		if (vkGetPipelineCacheData(mLogicDevice, mPipelineCache, &dataSize, data.data()) != VK_SUCCESS) {
+			LOG_WARN("Failed to get pipeline cache data");
+			return false;
+		}
+
+		FileHeader header = mDeviceHeader;
+		header.DataSize = static_cast<uint64_t>(dataSize);
+
+		//Written to a temporary file first so a crash while saving can't leave a half written cache behind.
+		const std::string tempFilePath = mFilePath + ".tmp";
+		{
+			std::ofstream file(tempFilePath, std::ios::binary | std::ios::trunc);
+			if (!file.is_open()) {
+				LOG_WARN("Failed to open pipeline cache file for writing: " << tempFilePath);
+				return false;
+			}
+
+			file.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+			file.write(data.data(), dataSize);
+			if (!file.good()) {
+				LOG_WARN("Failed to write pipeline cache file: " << tempFilePath);
+				return false;
+			}
+		}
+
+		std::remove(mFilePath.c_str());
+		if (std::rename(tempFilePath.c_str(), mFilePath.c_str()) != 0) {
+			LOG_WARN("Failed to replace pipeline cache file: " << mFilePath);
+			return false;
+		}
+
+		return true;
+	}
+
+	const char* PipelineCacheVulkan::getValidCacheData(const std::string_view fileData, size_t& dataSize) const {
+		dataSize = 0;
+
+		if (fileData.size() < sizeof(FileHeader)) {
+			return nullptr;
+		}
+
+		FileHeader fileHeader;
+		memcpy(&fileHeader, fileData.data(), sizeof(FileHeader));
+		if (
+			fileHeader.Magic != mDeviceHeader.Magic ||
+			fileHeader.FileVersion != mDeviceHeader.FileVersion ||
+			fileHeader.VendorId != mDeviceHeader.VendorId ||
+			fileHeader.DeviceId != mDeviceHeader.DeviceId ||
+			fileHeader.DriverVersion != mDeviceHeader.DriverVersion ||
+			memcmp(fileHeader.PipelineCacheUuid, mDeviceHeader.PipelineCacheUuid, VK_UUID_SIZE) != 0 ||
+			fileHeader.DataSize != fileData.size() - sizeof(FileHeader)
+		) {
+			return nullptr;
+		}
+
+		//Also check the header Vulkan puts at the start of the cache data, some drivers don't validate it themselves.
+		const char* cacheData = fileData.data() + sizeof(FileHeader);
+		const size_t cacheDataSize = static_cast<size_t>(fileHeader.DataSize);
+		constexpr size_t vkHeaderSize = (sizeof(uint32_t) * 4) + VK_UUID_SIZE;
+		if (cacheDataSize < vkHeaderSize) {
+			return nullptr;
+		}
+
+		uint32_t vkHeader[4];
+		memcpy(vkHeader, cacheData, sizeof(vkHeader));
+		if (
+			vkHeader[1] != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+			vkHeader[2] != mDeviceHeader.VendorId ||
+			vkHeader[3] != mDeviceHeader.DeviceId ||
+			memcmp(cacheData + sizeof(vkHeader), mDeviceHeader.PipelineCacheUuid, VK_UUID_SIZE) != 0
+		) {
+			return nullptr;
+		}
+
+		dataSize = cacheDataSize;
+		return cacheData;
+	}
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "dough/rendering/IGPUResourceVulkan.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace DOH {
+
+	/**
+	* VkPipelineCache shared by every pipeline the engine creates, including ImGui's, persisted to disk between runs.
+	*
+	* The file is the cache data prefixed with a small header identifying the device and driver it was created with.
+	* A file from a different device, driver or cache UUID is ignored (and overwritten on close) rather than handed to the driver.
+	*/
+	class PipelineCacheVulkan {
+	public:
+		static constexpr const char* DEFAULT_FILE_NAME = "dough_pipeline_cache.bin";
+
+	private:
+		//Written before the VkPipelineCache data in the cache file.
+		struct FileHeader {
+			uint32_t Magic;
+			uint32_t FileVersion;
+			uint32_t VendorId;
+			uint32_t DeviceId;
+			uint32_t DriverVersion;
+			uint8_t PipelineCacheUuid[VK_UUID_SIZE];
+			uint64_t DataSize;
+		};
+
+		static constexpr uint32_t FILE_MAGIC = 0x43504844; //"DHPC"
+		static constexpr uint32_t FILE_VERSION = 1;
+
+		VkDevice mLogicDevice;
+		VkPipelineCache mPipelineCache;
+		std::string mFilePath;
+		FileHeader mDeviceHeader;
+
+		//-----Debug information-----
+		bool mLoadedFromFile;
+		size_t mLoadedByteSize;
+		uint32_t mPipelineCreationCount;
+		double mPipelineCreationTimeMillis;
+
+	public:
+		PipelineCacheVulkan(VkDevice logicDevice, const char* filePath = DEFAULT_FILE_NAME);
+
+		PipelineCacheVulkan(const PipelineCacheVulkan& copy) = delete;
+		PipelineCacheVulkan operator=(const PipelineCacheVulkan& assignment) = delete;
+
+		//Create the cache, seeded with the cache file if it exists and matches the device.
+		void init(const VkPhysicalDeviceProperties& deviceProperties);
+		//Save then destroy the cache.
+		void close();
+		//Write the current cache data to the cache file, returns false if writing failed.
+		bool save() const;
+
+		//Used to show how long pipeline creation takes with the cache.
+		inline void recordPipelineCreation(const double timeMillis) {
+			mPipelineCreationCount++;
+			mPipelineCreationTimeMillis += timeMillis;
+		}
+
+		inline VkPipelineCache get() const { return mPipelineCache; }
+		inline const std::string& getFilePath() const { return mFilePath; }
+		inline bool isLoadedFromFile() const { return mLoadedFromFile; }
+		inline size_t getLoadedByteSize() const { return mLoadedByteSize; }
+		inline uint32_t getPipelineCreationCount() const { return mPipelineCreationCount; }
+		inline double getPipelineCreationTimeMillis() const { return mPipelineCreationTimeMillis; }
+
+	private:
+		//Returns the VkPipelineCache data in fileData if its header matches the device, otherwise nullptr.
+		const char* getValidCacheData(const std::string_view fileData, size_t& dataSize) const;
+	};
+}
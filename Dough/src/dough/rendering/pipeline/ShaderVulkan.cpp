@@ -1,6 +1,7 @@
 #include "dough/rendering/pipeline/ShaderVulkan.h"
 
 #include "dough/files/ResourceHandler.h"
+#include "dough/files/FileView.h"
 #include "dough/Utils.h"
 
 #include <tracy/public/tracy/Tracy.hpp>
@@ -31,12 +32,14 @@ namespace DOH {
 	void ShaderVulkan::init(VkDevice logicDevice) {
 		ZoneScoped;
 
-		std::vector<char> shaderByteCode = ResourceHandler::readFile(mFilePath);
+		//Mapped views are page aligned, so meet SPIR-V's 4 byte alignment
+		std::shared_ptr<const FileView> shaderByteCode = ResourceHandler::openFileView(mFilePath);
+		TRY(shaderByteCode == nullptr, "Failed to open shader file.");
 
 		VkShaderModuleCreateInfo createInfo = {};
 		createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-		createInfo.codeSize = shaderByteCode.size();
-		createInfo.pCode = reinterpret_cast<const uint32_t*>(shaderByteCode.data());
+		createInfo.codeSize = shaderByteCode->size();
+		createInfo.pCode = reinterpret_cast<const uint32_t*>(shaderByteCode->data());
 
 		VK_TRY(
 			vkCreateShaderModule(logicDevice, &createInfo, nullptr, &mShaderModule),
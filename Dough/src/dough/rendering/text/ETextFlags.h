@@ -1,20 +1,38 @@
 #pragma once
 
+#include <cstdint>
+
 namespace DOH {
 
 	//NOTE:: Reserved for adaption later on
 	//	Would some of these be done best in a shader?
 	enum class ETextFlags2d {
-		NONE = 0
+		NONE = 0,
+
+		//Ignore the font's kerning pairs, e.g. for scene text where overlapping glyph quads z-fight.
+		NO_KERNING = 1 << 0,
+		//Don't warn about chars the font has no glyph for, they are skipped either way.
+		IGNORE_MISSING_GLYPHS = 1 << 1,
+
+		//Horizontal alignment of each line, left aligned when neither is set.
+		//Lines are aligned within TextLayoutBounds2d::MaxWidth when wrapping, otherwise around the root.
+		ALIGN_CENTRE = 1 << 2,
+		ALIGN_RIGHT = 1 << 3
 
 		//TODO:: examples of text render options
 		// Will be more effective with SDF implementation & dedicated shader
 
-		//WRAP_TEXT
 		//NO_SPACES
 		//NO_TABS
-		//ALIGNMENT
 		//BOLD
 		//ITALIC
 	};
+
+	constexpr inline ETextFlags2d operator|(const ETextFlags2d a, const ETextFlags2d b) {
+		return static_cast<ETextFlags2d>(static_cast<uint32_t>(a) | static_cast<uint32_t>(b));
+	}
+
+	constexpr inline bool hasTextFlag(const ETextFlags2d flags, const ETextFlags2d flag) {
+		return (static_cast<uint32_t>(flags) & static_cast<uint32_t>(flag)) != 0;
+	}
 }
@@ -10,15 +10,21 @@
 
 namespace DOH {
 
-	FontBitmap::FontBitmap(const char* filePath, const char* imageDir, ETextRenderMethod textRenderMethod)
+	FontBitmap::FontBitmap(const char* filePath, const char* imageDir, ETextRenderMethod textRenderMethod, const bool streamPages)
 	:	mTextRenderMethod(textRenderMethod),
 		mPageCount(0),
 		mSpaceWidthNorm(0.0f),
 		mLineHeightNorm(0.0f),
-		mBaseNorm(0.0f)
+		mBaseNorm(0.0f),
+		mDenseGlyphTable({}),
+		mDenseGlyphPresent(),
+		mKerningTableMask(0),
+		mKerningCount(0)
 	{
 		ZoneScoped;
 
+		std::vector<std::tuple<uint32_t, uint32_t, float>> kernings;
+
 		//IMPORTANT:: Assumes charset is ASCII or unicode
 
 		//Prefer to use MSDF where possible
@@ -29,47 +35,42 @@ namespace DOH {
 			//
 			//Also, mBaseNorm isn't required for MSDF glyphs as it is accounted for in the glphy.Offset vector.
 
-			std::shared_ptr<JsonFileData> fileData = ResourceHandler::loadJsonFile(filePath);
+			std::shared_ptr<JsonDocument> fileData = ResourceHandler::loadJsonDocument(filePath);
 
-			if (fileData == nullptr || fileData->FileData.empty()) {
+			if (fileData == nullptr || !fileData->getRoot().isObject()) {
 				LOG_ERR("Failed to load json file for font bitmap: " << filePath);
 				return;
 			}
 
-			JsonElement& root = fileData->getRoot();
+			const JsonValue root = fileData->getRoot();
 
-			JsonElement& atlasAndTextureInfo = root["atlas"];
+			const JsonValue atlasAndTextureInfo = root["atlas"];
 			const float fontPixelSizeFloat = static_cast<float>(atlasAndTextureInfo["size"].getLong());
 			const uint32_t fileWidth = static_cast<uint32_t>(atlasAndTextureInfo["width"].getLong());
 			const uint32_t fileHeight = static_cast<uint32_t>(atlasAndTextureInfo["height"].getLong());
 			const bool isBottomY = atlasAndTextureInfo["yOrigin"].getString().compare("bottom") == 0;
 
-			JsonElement& metrics = root["metrics"];
+			const JsonValue metrics = root["metrics"];
 			const float scale = 1.0f / static_cast<float>(metrics["ascender"].getDouble() - metrics["descender"].getDouble());
 			mLineHeightNorm =  metrics["lineHeight"].getNumberAsFloat() * scale;
 			mSpaceWidthNorm = (fontPixelSizeFloat * 0.25f) / fontPixelSizeFloat; //Default to 1/4 of general glyph size.
 
-			JsonElement textureNames = atlasAndTextureInfo["textureName"];
+			const JsonValue textureNames = atlasAndTextureInfo["textureName"];
 			if (textureNames.isArray()) {
 				//TODO:: Is multiple texture support required?
 				LOG_ERR("Multiple textures for single MSDF font NOT SUPPORTED! FilePath: " << filePath);
 				THROW("");
 				return;
 			} else if (textureNames.isString()) {
-				auto& context = Application::get().getRenderer().getContext();
-				std::string textureFileName = atlasAndTextureInfo["textureName"].getString();
-				std::string textureFilePath = imageDir + textureFileName;
-				std::shared_ptr<TextureVulkan> texture = context.createTexture(textureFilePath);
-				mPageTextures.emplace_back(texture);
+				mPageFilePaths.emplace_back(imageDir + std::string(textureNames.getString()));
 				mPageCount = 1;
 			}
 
-			std::vector<JsonElement>& glyphs = root["glyphs"].getArray();
-			for (JsonElement& fileGlyph : glyphs) {
+			for (const JsonValue fileGlyph : root["glyphs"].getArray()) {
 				const uint32_t unicode = static_cast<uint32_t>(fileGlyph["unicode"].getLong());
 				//planeBounds and atlasBounds are required for a renderable glyph, all others are ignored, except space
-				std::optional<JsonElement> planeBounds = fileGlyph.getElement("planeBounds");
-				std::optional<JsonElement> atlasBounds = fileGlyph.getElement("atlasBounds");
+				const std::optional<JsonValue> planeBounds = fileGlyph.getElement("planeBounds");
+				const std::optional<JsonValue> atlasBounds = fileGlyph.getElement("atlasBounds");
 				if (!planeBounds.has_value() || !atlasBounds.has_value()) {
 					if (unicode == 32) { //Unicode decimal value for "space"
 
@@ -84,13 +85,13 @@ namespace DOH {
 				GlyphData g = {};
 				g.PageId = 0;
 
-				JsonElement& plane = planeBounds.value();
+				const JsonValue plane = planeBounds.value();
 				const float planeLeft = plane["left"].getNumberAsFloat();
 				const float planeBottom = plane["bottom"].getNumberAsFloat();
 				const float planeRight = plane["right"].getNumberAsFloat();
 				const float planeTop = plane["top"].getNumberAsFloat();
 
-				JsonElement& atlas = atlasBounds.value();
+				const JsonValue atlas = atlasBounds.value();
 				const float atlasLeft = atlas["left"].getNumberAsFloat();
 				const float atlasBottom = atlas["bottom"].getNumberAsFloat();
 				const float atlasRight = atlas["right"].getNumberAsFloat();
@@ -137,11 +138,21 @@ namespace DOH {
 				mGlyphMap.emplace(unicode, g);
 			}
 
-			//TODO:: Kernings, cause z-fighting when in a Perspective camera but not when in an Orthographic camera.
-			//std::vector<JsonElement>& kernings = root["kernings"].getArray();
+			//NOTE:: Kernings overlap glyph quads which causes z-fighting when in a Perspective camera but not when in an Orthographic camera,
+			// use ETextFlags2d::NO_KERNING when laying out text affected by this.
+			const std::optional<JsonValue> fileKernings = root.getElement("kerning");
+			if (fileKernings.has_value() && fileKernings->isArray()) {
+				kernings.reserve(fileKernings->size());
+				for (const JsonValue fileKerning : fileKernings->getArray()) {
+					kernings.emplace_back(
+						static_cast<uint32_t>(fileKerning["unicode1"].getLong()),
+						static_cast<uint32_t>(fileKerning["unicode2"].getLong()),
+						fileKerning["advance"].getNumberAsFloat() * scale
+					);
+				}
+			}
 
 		} else if (ResourceHandler::isFileOfType(filePath, "fnt")) {
-			auto& context = Application::get().getRenderer().getContext();
 			std::shared_ptr<FntFileData> fileData = ResourceHandler::loadFntFile(filePath);
 
 			if (fileData == nullptr) {
@@ -150,8 +161,7 @@ namespace DOH {
 			}
 
 			for (const FntFilePageData& page : fileData->Pages) {
-				std::shared_ptr<TextureVulkan> pageTexture = context.createTexture(imageDir + page.PageFilepath);
-				mPageTextures.emplace_back(pageTexture);
+				mPageFilePaths.emplace_back(imageDir + page.PageFilepath);
 			}
 
 			const float fileWidth = static_cast<float>(fileData->Width);
@@ -200,14 +210,83 @@ namespace DOH {
 				mSpaceWidthNorm = (pixelSize * 0.25f) / pixelSize; //Default to 1/4 of general glyph size.
 			}
 
-			//for (const FntFileKerningData& fileKerning : fileData->Kernings) {
-			//	KerningData k = {
-			//		fileKerning.FirstGlyphId,
-			//		fileKerning.SecondGlyphId,
-			//		fileKerning.Amount / pixelSize
-			//	};
-			//	mKernings.emplace_back(k);
-			//}
+			kernings.reserve(fileData->Kernings.size());
+			for (const FntFileKerningData& fileKerning : fileData->Kernings) {
+				kernings.emplace_back(
+					fileKerning.FirstGlyphId,
+					fileKerning.SecondGlyphId,
+					static_cast<float>(fileKerning.Amount) / pixelSize
+				);
+			}
+		}
+
+		buildDenseGlyphTable();
+		buildKerningTable(kernings);
+
+		if (!streamPages) {
+			auto& context = Application::get().getRenderer().getContext();
+			for (const std::string& pageFilePath : mPageFilePaths) {
+				mPageTextures.emplace_back(context.createTexture(pageFilePath, TextureMipSettings::noMips()));
+			}
+		}
+	}
+
+	void FontBitmap::addStreamedPageTexture(std::shared_ptr<TextureVulkan> pageTexture) {
+		if (isLoaded()) {
+			LOG_ERR("FontBitmap already has all of its " << mPageFilePaths.size() << " page textures");
+			return;
+		}
+
+		mPageTextures.emplace_back(pageTexture);
+	}
+
+	void FontBitmap::buildDenseGlyphTable() {
+		ZoneScoped;
+
+		mDenseGlyphPresent.reset();
+		for (const auto& glyph : mGlyphMap) {
+			if (glyph.first < DENSE_GLYPH_TABLE_SIZE) {
+				mDenseGlyphTable[glyph.first] = glyph.second;
+				mDenseGlyphPresent.set(glyph.first);
+			}
+		}
+	}
+
+	void FontBitmap::buildKerningTable(const std::vector<std::tuple<uint32_t, uint32_t, float>>& kernings) {
+		ZoneScoped;
+
+		mKerningTable.clear();
+		mKerningTableMask = 0;
+		mKerningCount = 0;
+
+		if (kernings.empty()) {
+			return;
+		}
+
+		//At most half full so probes stay short
+		uint32_t capacity = 16;
+		while (capacity < kernings.size() * 2) {
+			capacity <<= 1;
+		}
+		mKerningTable.resize(capacity, { 0, 0.0f });
+		mKerningTableMask = capacity - 1;
+
+		for (const auto& [first, second, amount] : kernings) {
+			if (first == 0 || second == 0) {
+				continue;
+			}
+
+			const uint64_t key = FontBitmap::getKerningKey(first, second);
+			uint32_t slot = FontBitmap::hashKerningKey(key) & mKerningTableMask;
+			while (mKerningTable[slot].Key != 0 && mKerningTable[slot].Key != key) {
+				slot = (slot + 1) & mKerningTableMask;
+			}
+
+			//Duplicate pairs overwrite the earlier amount
+			if (mKerningTable[slot].Key == 0) {
+				mKerningCount++;
+			}
+			mKerningTable[slot] = { key, amount };
 		}
 	}
 }
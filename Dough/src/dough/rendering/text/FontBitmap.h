@@ -5,6 +5,10 @@
 #include "dough/scene/geometry/primitives/Quad.h"
 #include "dough/rendering/text/ETextRenderMethod.h"
 
+#include <array>
+#include <bitset>
+#include <tuple>
+
 namespace DOH {
 
 	//All values except PageId are normalised to Page dimensions
@@ -17,27 +21,34 @@ namespace DOH {
 		uint32_t PageId;
 	};
 
-	//struct KerningData {
-	//	uint32_t FirstGlyphId;
-	//	uint32_t SecondGlyphId;
-	//	float Amount;
-	//};
-
-	//TODO:: Provide hash function so this struct can be used as a key in unordererd_map
-	//struct KerningMapKey {
-	//	uint32_t FirstGlyphId;
-	//	uint32_t SecondGlyphId;
-	//};
+	//Slot in FontBitmap's kerning table, Amount is normalised to Page dimensions.
+	struct KerningData {
+		//First codepoint in the high 32 bits, second in the low. 0 marks an empty slot.
+		uint64_t Key;
+		float Amount;
+	};
 
 	class FontBitmap {
+	public:
+		//Codepoints below this (Basic Latin and Latin-1 Supplement) are looked up in a flat table instead of mGlyphMap.
+		constexpr static const uint32_t DENSE_GLYPH_TABLE_SIZE = 256;
+
 	private:
 		constexpr static const uint32_t TAB_SPACE_COUNT = 4;
 		
 		const ETextRenderMethod mTextRenderMethod;
 		std::vector<std::shared_ptr<TextureVulkan>> mPageTextures;
+		//Page image files in page order, mPageTextures is filled from these.
+		std::vector<std::string> mPageFilePaths;
+		//Contains every glyph, only used for lookup of codepoints not in the dense table.
 		std::unordered_map<uint32_t, GlyphData> mGlyphMap;
-		//std::unordered_map<KerningMapKey, float> mKerningMap;
-		//std::vector<KerningData> mKernings;
+		std::array<GlyphData, DENSE_GLYPH_TABLE_SIZE> mDenseGlyphTable;
+		std::bitset<DENSE_GLYPH_TABLE_SIZE> mDenseGlyphPresent;
+		//Open addressed (linear probing) table of kerning pairs, size is a power of two and kept at most half full.
+		//Empty when the font has no kernings.
+		std::vector<KerningData> mKerningTable;
+		uint32_t mKerningTableMask;
+		uint32_t mKerningCount;
 		uint32_t mPageCount;
 		float mSpaceWidthNorm;
 		float mLineHeightNorm;
@@ -48,18 +59,69 @@ namespace DOH {
 		FontBitmap(const FontBitmap& copy) = delete;
 		FontBitmap operator=(const FontBitmap& assignment) = delete;
 
-		FontBitmap(const char* filepath, const char* imageDir, ETextRenderMethod textRenderMethod);
+		/**
+		* Load the font's glyphs and kernings from filepath, page images are read from imageDir.
+		* When streamPages is true page textures aren't created, they are expected to be added in page order through
+		* addStreamedPageTexture (see TextRenderer::loadFontBitmap). The font can't be laid out or drawn until isLoaded().
+		*/
+		FontBitmap(const char* filepath, const char* imageDir, ETextRenderMethod textRenderMethod, const bool streamPages = false);
+
+		//Add the texture of the next page when streaming pages.
+		void addStreamedPageTexture(std::shared_ptr<TextureVulkan> pageTexture);
+
+		//Returns nullptr if the font doesn't have a glyph for codepoint.
+		inline const GlyphData* getGlyph(const uint32_t codepoint) const {
+			if (codepoint < DENSE_GLYPH_TABLE_SIZE) {
+				return mDenseGlyphPresent[codepoint] ? &mDenseGlyphTable[codepoint] : nullptr;
+			}
+
+			const auto itr = mGlyphMap.find(codepoint);
+			return itr != mGlyphMap.end() ? &itr->second : nullptr;
+		}
+
+		//Returns the adjustment to the advance between first and second, 0.0f if the pair isn't kerned.
+		inline float getKerning(const uint32_t first, const uint32_t second) const {
+			if (mKerningCount == 0) {
+				return 0.0f;
+			}
+
+			const uint64_t key = FontBitmap::getKerningKey(first, second);
+			uint32_t slot = FontBitmap::hashKerningKey(key) & mKerningTableMask;
+			while (true) {
+				const KerningData& kerning = mKerningTable[slot];
+				if (kerning.Key == key) {
+					return kerning.Amount;
+				} else if (kerning.Key == 0) {
+					return 0.0f;
+				}
+				slot = (slot + 1) & mKerningTableMask;
+			}
+		}
 
 		inline const float getSpaceWidthNorm() const { return mSpaceWidthNorm; }
 		inline const float getTabWidthNorm() const { return mSpaceWidthNorm * static_cast<float>(FontBitmap::TAB_SPACE_COUNT); }
 		inline const float getLineHeightNorm() const { return mLineHeightNorm; }
 		inline const float getBaseNorm() const { return mBaseNorm; }
 		inline const std::unordered_map<uint32_t, GlyphData>& getGlyphMap() const { return mGlyphMap; }
-		//inline const std::unordered_map<KerningMapKey, float>& getKerningMap() const { return mKerningMap; }
-		//inline const std::vector<KerningData>& getKernings() const { return mKernings; }
-		inline const std::shared_ptr<TextureVulkan> getPageTexture(const uint32_t pageId) const { return mPageTextures[pageId]; }
+		inline const uint32_t getKerningCount() const { return mKerningCount; }
+		inline const std::shared_ptr<TextureVulkan>& getPageTexture(const uint32_t pageId) const { return mPageTextures[pageId]; }
 		inline const std::vector<std::shared_ptr<TextureVulkan>>& getPageTextures() const { return mPageTextures; }
 		inline const uint32_t getPageCount() const { return mPageCount; }
+		inline const std::vector<std::string>& getPageFilePaths() const { return mPageFilePaths; }
+		inline bool isLoaded() const { return mPageTextures.size() == mPageFilePaths.size(); }
 		inline const ETextRenderMethod getTextRenderMethod() const { return mTextRenderMethod; }
+
+	private:
+		void buildDenseGlyphTable();
+		//Builds mKerningTable from (first, second, amount) pairs, pairs with a 0 codepoint are ignored.
+		void buildKerningTable(const std::vector<std::tuple<uint32_t, uint32_t, float>>& kernings);
+
+		static inline uint64_t getKerningKey(const uint32_t first, const uint32_t second) {
+			return (static_cast<uint64_t>(first) << 32) | static_cast<uint64_t>(second);
+		}
+		static inline uint32_t hashKerningKey(const uint64_t key) {
+			//Fibonacci hashing, the high bits of the product are the best mixed
+			return static_cast<uint32_t>((key * 0x9E3779B97F4A7C15ull) >> 32);
+		}
 	};
 }
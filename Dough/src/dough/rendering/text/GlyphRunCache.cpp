@@ -0,0 +1,175 @@
+#include "dough/rendering/text/GlyphRunCache.h"
+
+#include "dough/scene/geometry/collections/TextString.h"
+
+#include <tracy/public/tracy/Tracy.hpp>
+
+#include <cstring>
+
+namespace DOH {
+
+	GlyphRunCache::GlyphRunCache(const size_t byteBudget)
+	:	mByteBudget(byteBudget),
+		mByteSize(0),
+		mHitCount(0u),
+		mMissCount(0u),
+		mEvictionCount(0u),
+		mLastFrameHitCount(0u),
+		mLastFrameMissCount(0u),
+		mLastFrameEvictionCount(0u)
+	{}
+
+	size_t GlyphRunCache::appendStringAsQuads(
+		std::vector<Quad>& quads,
+		const char* string,
+		const FontBitmap& bitmap,
+		const glm::vec3 rootPos,
+		const float scale,
+		const glm::vec4& colour,
+		const ETextFlags2d flags
+	) {
+		ZoneScoped;
+
+		const size_t length = strlen(string);
+		if (length == 0) {
+			return 0;
+		}
+
+		const uint64_t hash = GlyphRunCache::hashKey(string, length, bitmap, scale, flags);
+		const auto mapItr = mRunMap.find(hash);
+		if (mapItr != mRunMap.end()) {
+			GlyphRun& run = *mapItr->second;
+			if (
+				run.Bitmap == &bitmap &&
+				run.Scale == scale &&
+				run.Flags == flags &&
+				run.String.compare(0, std::string::npos, string, length) == 0
+			) {
+				mHitCount++;
+				mRuns.splice(mRuns.begin(), mRuns, mapItr->second);
+				GlyphRunCache::appendRunAsQuads(quads, run, rootPos, colour);
+				return run.Glyphs.size();
+			}
+
+			//Hash collision, the new string replaces the old one
+			eraseRun(mapItr->second);
+		}
+
+		mMissCount++;
+
+		//Laid out at the origin so the run can be translated to any root
+		mLayoutScratch.clear();
+		TextString::appendStringAsQuads(mLayoutScratch, string, bitmap, { 0.0f, 0.0f, 0.0f }, scale, colour, flags);
+
+		GlyphRun run = {};
+		run.Hash = hash;
+		run.String.assign(string, length);
+		run.Bitmap = &bitmap;
+		run.Scale = scale;
+		run.Flags = flags;
+		run.Glyphs.reserve(mLayoutScratch.size());
+
+		const auto& pages = bitmap.getPageTextures();
+		for (const Quad& quad : mLayoutScratch) {
+			uint32_t pageId = 0;
+			for (uint32_t i = 0; i < pages.size(); i++) {
+				if (pages[i]->getId() == quad.getTexture().getId()) {
+					pageId = i;
+					break;
+				}
+			}
+
+			run.Glyphs.push_back({
+				{ quad.Position.x, quad.Position.y },
+				quad.Size,
+				quad.TextureCoords,
+				pageId
+			});
+		}
+
+		//Approximate, includes list & map node overhead
+		run.ByteSize =
+			sizeof(GlyphRun) + run.String.capacity() + (run.Glyphs.capacity() * sizeof(CachedGlyph)) +
+			sizeof(std::pair<uint64_t, std::list<GlyphRun>::iterator>) + (sizeof(void*) * 4);
+
+		GlyphRunCache::appendRunAsQuads(quads, run, rootPos, colour);
+		const size_t glyphCount = run.Glyphs.size();
+
+		if (run.ByteSize <= mByteBudget) {
+			evictToFit(mByteBudget - run.ByteSize);
+			mByteSize += run.ByteSize;
+			mRuns.emplace_front(std::move(run));
+			mRunMap.emplace(hash, mRuns.begin());
+		}
+
+		return glyphCount;
+	}
+
+	void GlyphRunCache::setByteBudget(const size_t byteBudget) {
+		mByteBudget = byteBudget;
+		evictToFit(mByteBudget);
+	}
+
+	void GlyphRunCache::clear() {
+		mRuns.clear();
+		mRunMap.clear();
+		mByteSize = 0;
+	}
+
+	void GlyphRunCache::resetLocalDebugInfo() {
+		mLastFrameHitCount = mHitCount;
+		mLastFrameMissCount = mMissCount;
+		mLastFrameEvictionCount = mEvictionCount;
+		mHitCount = 0u;
+		mMissCount = 0u;
+		mEvictionCount = 0u;
+	}
+
+	void GlyphRunCache::evictToFit(const size_t byteBudget) {
+		while (mByteSize > byteBudget && !mRuns.empty()) {
+			eraseRun(std::prev(mRuns.end()));
+			mEvictionCount++;
+		}
+	}
+
+	void GlyphRunCache::eraseRun(std::list<GlyphRun>::iterator itr) {
+		mByteSize -= itr->ByteSize;
+		mRunMap.erase(itr->Hash);
+		mRuns.erase(itr);
+	}
+
+	void GlyphRunCache::appendRunAsQuads(
+		std::vector<Quad>& quads,
+		const GlyphRun& run,
+		const glm::vec3 rootPos,
+		const glm::vec4& colour
+	) {
+		ZoneScoped;
+
+		quads.reserve(quads.size() + run.Glyphs.size());
+		for (const CachedGlyph& glyph : run.Glyphs) {
+			Quad& quad = quads.emplace_back();
+			quad.Position = { rootPos.x + glyph.Offset.x, rootPos.y + glyph.Offset.y, rootPos.z };
+			quad.Size = glyph.Size;
+			quad.TextureCoords = glyph.TextureCoords;
+			quad.Colour = colour;
+			quad.setTexture(*run.Bitmap->getPageTexture(glyph.PageId));
+		}
+	}
+
+	uint64_t GlyphRunCache::hashKey(const char* string, const size_t length, const FontBitmap& bitmap, const float scale, const ETextFlags2d flags) {
+		//FNV-1a over the string, then the rest of the key mixed in the same way
+		constexpr uint64_t FNV_PRIME = 1099511628211ull;
+		uint64_t hash = 14695981039346656037ull;
+		for (size_t i = 0; i < length; i++) {
+			hash = (hash ^ static_cast<unsigned char>(string[i])) * FNV_PRIME;
+		}
+
+		uint32_t scaleBits;
+		memcpy(&scaleBits, &scale, sizeof(float));
+		hash = (hash ^ reinterpret_cast<uintptr_t>(&bitmap)) * FNV_PRIME;
+		hash = (hash ^ scaleBits) * FNV_PRIME;
+		hash = (hash ^ static_cast<uint32_t>(flags)) * FNV_PRIME;
+		return hash;
+	}
+}
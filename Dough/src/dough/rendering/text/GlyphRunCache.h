@@ -0,0 +1,97 @@
+#pragma once
+
+#include "dough/Core.h"
+#include "dough/rendering/text/FontBitmap.h"
+#include "dough/rendering/text/ETextFlags.h"
+#include "dough/scene/geometry/primitives/Quad.h"
+
+#include <list>
+
+namespace DOH {
+
+	//A laid out glyph relative to the root of its string, everything needed to rebuild its Quad at any root.
+	struct CachedGlyph {
+		glm::vec2 Offset;
+		glm::vec2 Size;
+		//Interlaced the same as Quad::TextureCoords
+		std::array<float, 4> TextureCoords;
+		uint32_t PageId;
+	};
+
+	/**
+	* LRU cache of laid out strings keyed by string, FontBitmap, scale and flags. A hit translates the cached glyph run to the
+	* requested root instead of looking up and positioning each glyph again. Colour isn't part of the key, it is applied on translation.
+	* FontBitmaps are keyed by address so the cache must be cleared before a FontBitmap it was used with is closed.
+	*
+	* Memory use is bounded by the byte budget, least recently used runs are evicted first. Runs larger than the budget aren't cached.
+	*/
+	class GlyphRunCache {
+	public:
+		constexpr static const size_t DEFAULT_BYTE_BUDGET = 256 * 1024;
+
+	private:
+		struct GlyphRun {
+			uint64_t Hash;
+			std::string String;
+			const FontBitmap* Bitmap;
+			float Scale;
+			ETextFlags2d Flags;
+			std::vector<CachedGlyph> Glyphs;
+			size_t ByteSize;
+		};
+
+		//Front is the most recently used
+		std::list<GlyphRun> mRuns;
+		std::unordered_map<uint64_t, std::list<GlyphRun>::iterator> mRunMap;
+		//Misses are laid out into this first so it isn't allocated per miss.
+		std::vector<Quad> mLayoutScratch;
+		size_t mByteBudget;
+		size_t mByteSize;
+
+		uint32_t mHitCount;
+		uint32_t mMissCount;
+		uint32_t mEvictionCount;
+		uint32_t mLastFrameHitCount;
+		uint32_t mLastFrameMissCount;
+		uint32_t mLastFrameEvictionCount;
+
+	public:
+		GlyphRunCache(const size_t byteBudget = GlyphRunCache::DEFAULT_BYTE_BUDGET);
+		GlyphRunCache(const GlyphRunCache& copy) = delete;
+		GlyphRunCache operator=(const GlyphRunCache& assignment) = delete;
+
+		//Same as TextString::appendStringAsQuads but only lays out string when it isn't cached.
+		size_t appendStringAsQuads(
+			std::vector<Quad>& quads,
+			const char* string,
+			const FontBitmap& bitmap,
+			const glm::vec3 rootPos,
+			const float scale,
+			const glm::vec4& colour,
+			const ETextFlags2d flags
+		);
+
+		//Evicts runs until the cache fits in byteBudget.
+		void setByteBudget(const size_t byteBudget);
+		void clear();
+		void resetLocalDebugInfo();
+
+		inline size_t getByteBudget() const { return mByteBudget; }
+		inline size_t getByteSize() const { return mByteSize; }
+		inline size_t getRunCount() const { return mRuns.size(); }
+		inline uint32_t getLastFrameHitCount() const { return mLastFrameHitCount; }
+		inline uint32_t getLastFrameMissCount() const { return mLastFrameMissCount; }
+		inline uint32_t getLastFrameEvictionCount() const { return mLastFrameEvictionCount; }
+
+	private:
+		void evictToFit(const size_t byteBudget);
+		void eraseRun(std::list<GlyphRun>::iterator itr);
+		static void appendRunAsQuads(
+			std::vector<Quad>& quads,
+			const GlyphRun& run,
+			const glm::vec3 rootPos,
+			const glm::vec4& colour
+		);
+		static uint64_t hashKey(const char* string, const size_t length, const FontBitmap& bitmap, const float scale, const ETextFlags2d flags);
+	};
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace DOH {
+
+	/**
+	* Optional limits applied while laying out a string, in the same space as the string's root.
+	* MaxWidth wraps lines at the last space (or mid-word when a word is longer than a line) once a line is wider than it, 0 means no wrapping.
+	* When HasClipRect is set glyphs outside the clip rect are never added and glyphs crossing its edges are cropped,
+	* lines above or below it are skipped without being laid out.
+	*/
+	struct TextLayoutBounds2d {
+		float MaxWidth = 0.0f;
+		bool HasClipRect = false;
+		glm::vec2 ClipBotLeft = { 0.0f, 0.0f };
+		glm::vec2 ClipTopRight = { 0.0f, 0.0f };
+
+		inline bool isWrapping() const { return MaxWidth > 0.0f; }
+	};
+}
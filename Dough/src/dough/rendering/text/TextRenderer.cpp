@@ -21,9 +21,22 @@ namespace DOH {
 
 	TextRenderer::TextRenderer(RenderingContextVulkan& context)
 	:	mContext(context),
-		mFontBitmapPagesDescSet(VK_NULL_HANDLE),
+		mFontBitmapPagesDescSets({}),
+		mFontBitmapPagesDescSetsStale({}),
 		mQuadIndexBufferShared(false),
+		mSceneViewFrustum(),
+		mSceneViewCulling(false),
 		mDrawnQuadCount(0u),
+		mDroppedQuadCount(0u),
+		mSplitQuadArrayCount(0u),
+		mLastFrameDrawnQuadCount(0u),
+		mLastFrameDroppedQuadCount(0u),
+		mLastFrameSplitQuadArrayCount(0u),
+		mRetainedUploadCount(0u),
+		mLastFrameRetainedUploadCount(0u),
+		mCulledQuadCount(0u),
+		mLastFrameCulledQuadCount(0u),
+		mNextRetainedStringId(1u),
 		mWarnOnNullSceneCameraData(true),
 		mWarnOnNullUiCameraData(true)
 	{}
@@ -39,6 +52,11 @@ namespace DOH {
 		mFontBitmaps = {};
 		mSoftMaskRendering = std::make_unique<TextRenderingObjects>();
 		mMsdfRendering = std::make_unique<TextRenderingObjects>();
+		mGlyphRunCache = std::make_unique<GlyphRunCache>();
+		mRetainedVertexScratch = std::make_unique<RenderBatchQuad>(
+			EBatchSizeLimits::QUAD_BATCH_MAX_GEO_COUNT,
+			EBatchSizeLimits::BATCH_MAX_COUNT_TEXTURE
+		);
 
 		mQuadIndexBuffer = ShapeRenderer::getQuadSharedIndexBufferPtr();
 		if (mQuadIndexBuffer == nullptr) {
@@ -71,21 +89,22 @@ namespace DOH {
 		};
 		std::shared_ptr<ShaderDescriptorSetLayoutsVulkan> textDescSetLayouts = std::make_shared<ShaderDescriptorSetLayoutsVulkan>(textDescSets);
 
-		mFontBitmapPagesDescSet = DescriptorApiVulkan::allocateDescriptorSetFromLayout(
-			mContext.getLogicDevice(),
-			mContext.getEngineDescriptorPool(),
-			texArrSetLayout
-		);
+		for (VkDescriptorSet& descSet : mFontBitmapPagesDescSets) {
+			descSet = DescriptorApiVulkan::allocateDescriptorSetFromLayout(
+				mContext.getLogicDevice(),
+				mContext.getEngineDescriptorPool(),
+				texArrSetLayout
+			);
+		}
 		const uint32_t descSetCount = 2;
 		mFontRenderingDescSetsInstanceScene = std::make_shared<DescriptorSetsInstanceVulkan>(descSetCount);
 		mFontRenderingDescSetsInstanceScene->setDescriptorSetArray(CAMERA_UBO_SLOT, { VK_NULL_HANDLE, VK_NULL_HANDLE }); // Camera UBO
-		mFontRenderingDescSetsInstanceScene->setDescriptorSetSingle(1, mFontBitmapPagesDescSet);
+		mFontRenderingDescSetsInstanceScene->setDescriptorSetArray(1, mFontBitmapPagesDescSets);
 		mFontRenderingDescSetsInstanceUi = std::make_shared<DescriptorSetsInstanceVulkan>(descSetCount);
 		mFontRenderingDescSetsInstanceUi->setDescriptorSetArray(CAMERA_UBO_SLOT, { VK_NULL_HANDLE, VK_NULL_HANDLE }); // Camera UBO
-		mFontRenderingDescSetsInstanceUi->setDescriptorSetSingle(1, mFontBitmapPagesDescSet);
+		mFontRenderingDescSetsInstanceUi->setDescriptorSetArray(1, mFontBitmapPagesDescSets);
 
 		const StaticVertexInputLayout& textVertexLayout = StaticVertexInputLayout::get(EVertexType::VERTEX_3D_TEXTURED_INDEXED);
-		const size_t batchSizeBytes = static_cast<size_t>(EBatchSizeLimits::QUAD_BATCH_MAX_GEO_COUNT) * Quad::BYTE_SIZE;
 
 		{ //Load fonts
 			bool createdDefaultFont = createFontBitmapImpl(
@@ -111,8 +130,10 @@ namespace DOH {
 			}
 		}
 
-		//Update descriptors after fonts have been loaded
-		updateFontBitmapTextureArrayDescriptorSetImpl();
+		//Nothing is using the descriptor sets yet so they can all be written now
+		for (uint32_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
+			writeFontBitmapPagesDescriptorSet(i);
+		}
 
 		{ //Soft Mask
 			mSoftMaskRendering->SceneVertexShader = mContext.createShader(EShaderStage::VERTEX, TextRenderer::SOFT_MASK_SHADER_PATH_VERT);
@@ -124,24 +145,15 @@ namespace DOH {
 			);
 
 			//Scene
-			mSoftMaskRendering->SceneBatch = std::make_unique<RenderBatchQuad>(
+			mSoftMaskRendering->SceneBatches = std::make_unique<BatchManager<RenderBatchQuad>>(
 				EBatchSizeLimits::QUAD_BATCH_MAX_GEO_COUNT,
-				EBatchSizeLimits::BATCH_MAX_COUNT_TEXTURE
+				Quad::BYTE_SIZE,
+				EBatchSizeLimits::BATCH_MAX_COUNT_TEXTURE,
+				mQuadIndexBuffer,
+				mFontRenderingDescSetsInstanceScene,
+				&mContext.getUploadRing()
 			);
 
-			std::shared_ptr<VertexArrayVulkan> vao = mContext.createVertexArray();
-			std::shared_ptr<VertexBufferVulkan> vbo = mContext.createVertexBuffer(
-				textVertexLayout,
-				batchSizeBytes,
-				VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-				VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
-			);
-			vao->addVertexBuffer(vbo);
-			vao->setIndexBuffer(mQuadIndexBuffer, true);
-			vao->getVertexBuffers()[0]->map(mContext.getLogicDevice(), batchSizeBytes);
-
-			mSoftMaskRendering->SceneRenderableBatch = std::make_shared<SimpleRenderable>(vao, mFontRenderingDescSetsInstanceScene);
-
 			mSoftMaskRendering->ScenePipelineInstanceInfo = std::make_unique<GraphicsPipelineInstanceInfo>(
 				textVertexLayout,
 				*mSoftMaskRendering->SceneShaderProgram,
@@ -166,29 +178,18 @@ namespace DOH {
 			mSoftMaskRendering->ScenePipeline = mContext.createGraphicsPipeline(*mSoftMaskRendering->ScenePipelineInstanceInfo);
 			mSoftMaskRendering->ScenePipeline->init(
 				mContext.getLogicDevice(),
-				mContext.getSwapChain().getExtent(),
 				mContext.getRenderPass(ERenderPass::APP_SCENE).get()
 			);
-			mSoftMaskRendering->ScenePipeline->addRenderableToDraw(mSoftMaskRendering->SceneRenderableBatch);
 
 			//UI
-			mSoftMaskRendering->UiBatch = std::make_unique<RenderBatchQuad>(
+			mSoftMaskRendering->UiBatches = std::make_unique<BatchManager<RenderBatchQuad>>(
 				EBatchSizeLimits::QUAD_BATCH_MAX_GEO_COUNT,
-				EBatchSizeLimits::BATCH_MAX_COUNT_TEXTURE
+				Quad::BYTE_SIZE,
+				EBatchSizeLimits::BATCH_MAX_COUNT_TEXTURE,
+				mQuadIndexBuffer,
+				mFontRenderingDescSetsInstanceUi,
+				&mContext.getUploadRing()
 			);
-			
-			std::shared_ptr<VertexArrayVulkan> uiVao = mContext.createVertexArray();
-			std::shared_ptr<VertexBufferVulkan> uiVbo = mContext.createVertexBuffer(
-				textVertexLayout,
-				batchSizeBytes,
-				VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-				VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
-			);
-			uiVao->addVertexBuffer(uiVbo);
-			uiVao->setIndexBuffer(mQuadIndexBuffer, true);
-			uiVao->getVertexBuffers()[0]->map(mContext.getLogicDevice(), batchSizeBytes);
-			
-			mSoftMaskRendering->UiRenderableBatch = std::make_shared<SimpleRenderable>(uiVao, mFontRenderingDescSetsInstanceUi);
 
 			mSoftMaskRendering->UiPipelineInstanceInfo = std::make_unique<GraphicsPipelineInstanceInfo>(
 				textVertexLayout,
@@ -214,10 +215,8 @@ namespace DOH {
 			mSoftMaskRendering->UiPipeline = mContext.createGraphicsPipeline(*mSoftMaskRendering->UiPipelineInstanceInfo);
 			mSoftMaskRendering->UiPipeline->init(
 				mContext.getLogicDevice(),
-				mContext.getSwapChain().getExtent(),
 				mContext.getRenderPass(ERenderPass::APP_UI).get()
 			);
-			mSoftMaskRendering->UiPipeline->addRenderableToDraw(mSoftMaskRendering->UiRenderableBatch);
 		}
 
 		{ //MSDF
@@ -230,9 +229,13 @@ namespace DOH {
 			);
 
 			//Scene
-			mMsdfRendering->SceneBatch = std::make_unique<RenderBatchQuad>(
+			mMsdfRendering->SceneBatches = std::make_unique<BatchManager<RenderBatchQuad>>(
 				EBatchSizeLimits::QUAD_BATCH_MAX_GEO_COUNT,
-				EBatchSizeLimits::BATCH_MAX_COUNT_TEXTURE
+				Quad::BYTE_SIZE,
+				EBatchSizeLimits::BATCH_MAX_COUNT_TEXTURE,
+				mQuadIndexBuffer,
+				mFontRenderingDescSetsInstanceScene,
+				&mContext.getUploadRing()
 			);
 
 			mMsdfRendering->ScenePipelineInstanceInfo = std::make_unique<GraphicsPipelineInstanceInfo>(
@@ -256,31 +259,20 @@ namespace DOH {
 			);
 			optionalFields.ClearRenderablesAfterDraw = false;
 
-			std::shared_ptr<VertexArrayVulkan> vao = mContext.createVertexArray();
-			std::shared_ptr<VertexBufferVulkan> vbo = mContext.createVertexBuffer(
-				textVertexLayout,
-				batchSizeBytes,
-				VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-				VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
-			);
-			vao->addVertexBuffer(vbo);
-			vao->setIndexBuffer(mQuadIndexBuffer, true);
-			vao->getVertexBuffers()[0]->map(mContext.getLogicDevice(), batchSizeBytes);
-
-			mMsdfRendering->SceneRenderableBatch = std::make_shared<SimpleRenderable>(vao, mFontRenderingDescSetsInstanceScene);
-
 			mMsdfRendering->ScenePipeline = mContext.createGraphicsPipeline(*mMsdfRendering->ScenePipelineInstanceInfo);
 			mMsdfRendering->ScenePipeline->init(
 				mContext.getLogicDevice(),
-				mContext.getSwapChain().getExtent(),
 				mContext.getRenderPass(ERenderPass::APP_SCENE).get()
 			);
-			mMsdfRendering->ScenePipeline->addRenderableToDraw(mMsdfRendering->SceneRenderableBatch);
 
 			//Ui
-			mMsdfRendering->UiBatch = std::make_unique<RenderBatchQuad>(
+			mMsdfRendering->UiBatches = std::make_unique<BatchManager<RenderBatchQuad>>(
 				EBatchSizeLimits::QUAD_BATCH_MAX_GEO_COUNT,
-				EBatchSizeLimits::BATCH_MAX_COUNT_TEXTURE
+				Quad::BYTE_SIZE,
+				EBatchSizeLimits::BATCH_MAX_COUNT_TEXTURE,
+				mQuadIndexBuffer,
+				mFontRenderingDescSetsInstanceUi,
+				&mContext.getUploadRing()
 			);
 
 			mMsdfRendering->UiPipelineInstanceInfo = std::make_unique<GraphicsPipelineInstanceInfo>(
@@ -304,26 +296,11 @@ namespace DOH {
 			);
 			uiOptionalFields.ClearRenderablesAfterDraw = false;
 
-			std::shared_ptr<VertexArrayVulkan> uiVao = mContext.createVertexArray();
-			std::shared_ptr<VertexBufferVulkan> uiVbo = mContext.createVertexBuffer(
-				textVertexLayout,
-				batchSizeBytes,
-				VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-				VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
-			);
-			uiVao->addVertexBuffer(uiVbo);
-			uiVao->setIndexBuffer(mQuadIndexBuffer, true);
-			uiVao->getVertexBuffers()[0]->map(mContext.getLogicDevice(), batchSizeBytes);
-
-			mMsdfRendering->UiRenderableBatch = std::make_shared<SimpleRenderable>(uiVao, mFontRenderingDescSetsInstanceUi);
-
 			mMsdfRendering->UiPipeline = mContext.createGraphicsPipeline(*mMsdfRendering->UiPipelineInstanceInfo);
 			mMsdfRendering->UiPipeline->init(
 				mContext.getLogicDevice(),
-				mContext.getSwapChain().getExtent(),
 				mContext.getRenderPass(ERenderPass::APP_UI).get()
 			);
-			mMsdfRendering->UiPipeline->addRenderableToDraw(mMsdfRendering->UiRenderableBatch);
 		}
 	}
 
@@ -334,20 +311,32 @@ namespace DOH {
 		mContext.addGpuResourceToClose(mSoftMaskRendering->SceneFragmentShader);
 		mContext.addGpuResourceToClose(mSoftMaskRendering->ScenePipeline);
 		mContext.addGpuResourceToClose(mSoftMaskRendering->UiPipeline);
-		mContext.addGpuResourceToClose(mSoftMaskRendering->SceneRenderableBatch->getVaoPtr());
-		mContext.addGpuResourceToClose(mSoftMaskRendering->UiRenderableBatch->getVaoPtr());
+		mSoftMaskRendering->SceneBatches->addOwnedResourcesToClose(mContext);
+		mSoftMaskRendering->UiBatches->addOwnedResourcesToClose(mContext);
 
 		mContext.addGpuResourceToClose(mMsdfRendering->SceneVertexShader);
 		mContext.addGpuResourceToClose(mMsdfRendering->SceneFragmentShader);
 		mContext.addGpuResourceToClose(mMsdfRendering->ScenePipeline);
 		mContext.addGpuResourceToClose(mMsdfRendering->UiPipeline);
-		mContext.addGpuResourceToClose(mMsdfRendering->SceneRenderableBatch->getVaoPtr());
-		mContext.addGpuResourceToClose(mMsdfRendering->UiRenderableBatch->getVaoPtr());
+		mMsdfRendering->SceneBatches->addOwnedResourcesToClose(mContext);
+		mMsdfRendering->UiBatches->addOwnedResourcesToClose(mContext);
 
-		mSoftMaskRendering->SceneBatch.release();
-		mSoftMaskRendering->UiBatch.release();
-		mMsdfRendering->SceneBatch.release();
-		mMsdfRendering->UiBatch.release();
+		mSoftMaskRendering->SceneBatches.reset();
+		mSoftMaskRendering->UiBatches.reset();
+		mMsdfRendering->SceneBatches.reset();
+		mMsdfRendering->UiBatches.reset();
+
+		//NOTE:: TextStrings still holding a retained id are ignored by releaseRetainedString after this.
+		for (auto& retained : mRetainedStrings) {
+			mContext.addGpuResourceToClose(retained.second.Vao);
+		}
+		mRetainedStrings.clear();
+		mSoftMaskRendering->SceneRetainedDraws.clear();
+		mSoftMaskRendering->UiRetainedDraws.clear();
+		mMsdfRendering->SceneRetainedDraws.clear();
+		mMsdfRendering->UiRetainedDraws.clear();
+		mRetainedVertexScratch.reset();
+		mGlyphRunCache.reset();
 
 		if (!mQuadIndexBufferShared) {
 			mContext.addGpuResourceToClose(mQuadIndexBuffer);
@@ -358,22 +347,36 @@ namespace DOH {
 				mContext.addGpuResourceToClose(page);
 			}
 		}
+
+		for (StreamingFontBitmap& font : mStreamingFontBitmaps) {
+			TextRenderer::discardStreamingFontBitmap(font);
+			for (auto& page : font.Bitmap->getPageTextures()) {
+				mContext.addGpuResourceToClose(page);
+			}
+		}
+		mStreamingFontBitmaps.clear();
 	}
 
-	void TextRenderer::onSwapChainResizeImpl(SwapChainVulkan& swapChain) {
+	void TextRenderer::onRenderPassesRecreatedImpl() {
 		ZoneScoped;
 
 		VkDevice logicDevice = mContext.getLogicDevice();
-		mSoftMaskRendering->ScenePipeline->resize(
+		mSoftMaskRendering->ScenePipeline->recreate(
 			logicDevice,
-			swapChain.getExtent(),
 			mContext.getRenderPass(ERenderPass::APP_SCENE).get()
 		);
-		mMsdfRendering->ScenePipeline->resize(
+		mSoftMaskRendering->UiPipeline->recreate(
+			logicDevice,
+			mContext.getRenderPass(ERenderPass::APP_UI).get()
+		);
+		mMsdfRendering->ScenePipeline->recreate(
 			logicDevice,
-			swapChain.getExtent(),
 			mContext.getRenderPass(ERenderPass::APP_SCENE).get()
 		);
+		mMsdfRendering->UiPipeline->recreate(
+			logicDevice,
+			mContext.getRenderPass(ERenderPass::APP_UI).get()
+		);
 	}
 
 	bool TextRenderer::createFontBitmapImpl(const char* fontName, const char* filePath, const char* imageDir, ETextRenderMethod textRenderMethod) {
@@ -392,6 +395,76 @@ namespace DOH {
 		}
 	}
 
+	bool TextRenderer::loadFontBitmapImpl(const char* fontName, const char* filePath, const char* imageDir, ETextRenderMethod textRenderMethod) {
+		ZoneScoped;
+
+		if (mFontBitmaps.find(fontName) != mFontBitmaps.end() || isFontBitmapLoadingImpl(fontName)) {
+			LOG_WARN("loadFontBitmap font already loaded or loading: " << fontName);
+			return false;
+		}
+
+		StreamingFontBitmap& font = mStreamingFontBitmaps.emplace_back();
+		font.Name = fontName;
+		font.Bitmap = mContext.createFontBitmap(filePath, imageDir, textRenderMethod, true);
+		font.NextPageLoad = 0;
+		font.PagesCreated = false;
+		for (const std::string& pageFilePath : font.Bitmap->getPageFilePaths()) {
+			//Only decoding is done on the worker thread, the GPU upload is recorded on the main thread in beginFrameImpl.
+			font.PageLoads.emplace_back(ResourceHandler::loadTextureAsync(pageFilePath, TextureMipSettings::noMips()));
+		}
+
+		return true;
+	}
+
+	bool TextRenderer::unloadFontBitmapImpl(const char* fontName) {
+		ZoneScoped;
+
+		if (strcmp(fontName, TextRenderer::ARIAL_SOFT_MASK_NAME) == 0) {
+			LOG_WARN("unloadFontBitmap can't unload the default font: " << fontName);
+			return false;
+		}
+
+		for (auto itr = mStreamingFontBitmaps.begin(); itr != mStreamingFontBitmaps.end(); itr++) {
+			if (itr->Name.compare(fontName) == 0) {
+				TextRenderer::discardStreamingFontBitmap(*itr);
+				for (auto& page : itr->Bitmap->getPageTextures()) {
+					mContext.addGpuResourceToClose(page);
+				}
+				mStreamingFontBitmaps.erase(itr);
+				return true;
+			}
+		}
+
+		const auto font = mFontBitmaps.find(fontName);
+		if (font == mFontBitmaps.end()) {
+			LOG_WARN("unloadFontBitmap font not found: " << fontName);
+			return false;
+		}
+
+		//Textures are closed after the frames in flight have finished, by which point every set has been updated
+		// to stop using them as the sets are updated when their frame begins.
+		for (auto& page : font->second->getPageTextures()) {
+			mFontBitmapPagesTextureArary->removeTexture(page->getId());
+			mContext.addGpuResourceToClose(page);
+		}
+		mFontBitmapPagesDescSetsStale.fill(true);
+
+		//Cached runs are keyed on the bitmap's address, which could be re-used by a later font
+		mGlyphRunCache->clear();
+		mFontBitmaps.erase(font);
+
+		return true;
+	}
+
+	bool TextRenderer::isFontBitmapLoadingImpl(const char* fontName) const {
+		for (const StreamingFontBitmap& font : mStreamingFontBitmaps) {
+			if (font.Name.compare(fontName) == 0) {
+				return true;
+			}
+		}
+		return false;
+	}
+
 	void TextRenderer::addFontBitmapToTextTextureArrayImpl(const FontBitmap& fontBitmap) {
 		ZoneScoped;
 
@@ -399,6 +472,7 @@ namespace DOH {
 			for (const auto& texture : fontBitmap.getPageTextures()) {
 				mFontBitmapPagesTextureArary->addNewTexture(*texture);
 			}
+			mFontBitmapPagesDescSetsStale.fill(true);
 		} else {
 			LOG_ERR(
 				"addFontBitmapToTextTextureArray failed, not enough texture slots available in batch. Required slots: " << fontBitmap.getPageCount()
@@ -407,100 +481,185 @@ namespace DOH {
 	}
 
 	void TextRenderer::updateFontBitmapTextureArrayDescriptorSetImpl() {
+		mFontBitmapPagesDescSetsStale.fill(true);
+	}
+
+	void TextRenderer::writeFontBitmapPagesDescriptorSet(uint32_t imageIndex) {
+		ZoneScoped;
+
 		const uint32_t textureArrBinding = 0;
 		DescriptorSetLayoutVulkan& texArrSetLayout = mContext.getCommonDescriptorSetLayouts().SingleTextureArray8.get();
 		DescriptorSetUpdate texArrUpdate = {
 			{{ texArrSetLayout.getDescriptors()[textureArrBinding], *mFontBitmapPagesTextureArary }},
-			mFontBitmapPagesDescSet
+			mFontBitmapPagesDescSets[imageIndex]
 		};
 		DescriptorApiVulkan::updateDescriptorSet(mContext.getLogicDevice(), texArrUpdate);
+		mFontBitmapPagesDescSetsStale[imageIndex] = false;
 	}
 
-	void TextRenderer::drawSceneImpl(uint32_t imageIndex, VkCommandBuffer cmd, CurrentBindingsState& currentBindings) {
+	void TextRenderer::beginFrameImpl(uint32_t imageIndex) {
 		ZoneScoped;
 
-		if (mSceneCameraData == nullptr) {
-			if (mWarnOnNullSceneCameraData) {
-				LOG_ERR("TextRenderer::drawSceneImpl mSceneCameraData is null");
+		//Pages created last frame were submitted at the start of this one, so these fonts can be drawn from now on.
+		for (auto itr = mStreamingFontBitmaps.begin(); itr != mStreamingFontBitmaps.end();) {
+			if (!itr->PagesCreated) {
+				itr++;
+				continue;
 			}
-			return;
-		}
 
-		VkDevice logicDevice = mContext.getLogicDevice();
-		AppDebugInfo& debugInfo = Application::get().getDebugInfo();
-		const size_t softMaskQuadCount = mSoftMaskRendering->SceneBatch->getGeometryCount();
-		const size_t textMsdfQuadCount = mMsdfRendering->SceneBatch->getGeometryCount();
-		const StaticVertexInputLayout& textVertexLayout = StaticVertexInputLayout::get(EVertexType::VERTEX_3D_TEXTURED_INDEXED);
+			const FontBitmap& bitmap = *itr->Bitmap;
+			if (mFontBitmapPagesTextureArary->hasTextureSlotsAvailable(bitmap.getPageCount())) {
+				addFontBitmapToTextTextureArrayImpl(bitmap);
+				mFontBitmaps.emplace(itr->Name, itr->Bitmap);
+			} else {
+				LOG_ERR("Failed to load font: " << itr->Name << ". Not enough font page texture slots for " << bitmap.getPageCount() << " pages");
+				for (auto& page : bitmap.getPageTextures()) {
+					mContext.addGpuResourceToClose(page);
+				}
+			}
+			itr = mStreamingFontBitmaps.erase(itr);
+		}
 
-		if (softMaskQuadCount > 0) {
-			VertexArrayVulkan& vao = mSoftMaskRendering->SceneRenderableBatch->getVao();
-			vao.getVertexBuffers()[0]->setDataMapped(
-				logicDevice,
-				mSoftMaskRendering->SceneBatch->getData().data(),
-				softMaskQuadCount * Quad::BYTE_SIZE
-			);
-			vao.setDrawCount(static_cast<uint32_t>(softMaskQuadCount * EBatchSizeLimits::QUAD_INDEX_COUNT));
+		if (mFontBitmapPagesDescSetsStale[imageIndex]) {
+			writeFontBitmapPagesDescriptorSet(imageIndex);
+		}
 
-			if (currentBindings.Pipeline != mSoftMaskRendering->ScenePipeline->get()) {
-				mSoftMaskRendering->ScenePipeline->bind(cmd);
-				debugInfo.PipelineBinds++;
-				currentBindings.Pipeline = mSoftMaskRendering->ScenePipeline->get();
+		for (auto itr = mStreamingFontBitmaps.begin(); itr != mStreamingFontBitmaps.end();) {
+			StreamingFontBitmap& font = *itr;
+			bool failed = false;
+			while (
+				font.NextPageLoad < font.PageLoads.size() &&
+				font.PageLoads[font.NextPageLoad].wait_for(std::chrono::seconds(0)) == std::future_status::ready
+			) {
+				TextureCreationData pageData = font.PageLoads[font.NextPageLoad].get();
+				font.NextPageLoad++;
+
+				const std::string& pageFilePath = font.Bitmap->getPageFilePaths()[font.Bitmap->getPageTextures().size()];
+				if (pageData.Failed) {
+					LOG_ERR("Failed to load font: " << font.Name << ". Failed to load page: " << pageFilePath);
+					failed = true;
+					break;
+				}
+
+				font.Bitmap->addStreamedPageTexture(mContext.createTexture(pageFilePath, pageData));
+				ResourceHandler::freeTexture(pageData);
 			}
 
-			if (mQuadIndexBuffer->getBuffer() != currentBindings.IndexBuffer) {
-				//NOTE:: Text is currently rendered as a Quad so it can share the Quad batch index buffer
-				mQuadIndexBuffer->bind(cmd);
-				currentBindings.IndexBuffer = mQuadIndexBuffer->getBuffer();
-				debugInfo.IndexBufferBinds++;
+			if (failed) {
+				TextRenderer::discardStreamingFontBitmap(font);
+				for (auto& page : font.Bitmap->getPageTextures()) {
+					mContext.addGpuResourceToClose(page);
+				}
+				itr = mStreamingFontBitmaps.erase(itr);
+			} else {
+				font.PagesCreated = font.NextPageLoad == font.PageLoads.size();
+				itr++;
 			}
+		}
+	}
 
-			mSoftMaskRendering->ScenePipeline->recordDrawCommand(
-				imageIndex,
-				cmd,
-				*mSoftMaskRendering->SceneRenderableBatch,
-				currentBindings,
-				0
-			);
-			debugInfo.SceneDrawCalls++;
+	void TextRenderer::discardStreamingFontBitmap(StreamingFontBitmap& font) {
+		ZoneScoped;
 
-			mSoftMaskRendering->SceneBatch->reset();
+		for (size_t i = font.NextPageLoad; i < font.PageLoads.size(); i++) {
+			TextureCreationData pageData = font.PageLoads[i].get();
+			if (!pageData.Failed) {
+				ResourceHandler::freeTexture(pageData);
+			}
 		}
+		font.PageLoads.clear();
+		font.NextPageLoad = 0;
+	}
 
-		//MSDF
-		if (textMsdfQuadCount > 0) {
-			VertexArrayVulkan& vao = mMsdfRendering->SceneRenderableBatch->getVao();
-			vao.getVertexBuffers()[0]->setDataMapped(
-				logicDevice,
-				mMsdfRendering->SceneBatch->getData().data(),
-				textMsdfQuadCount * Quad::BYTE_SIZE
-			);
-			vao.setDrawCount(static_cast<uint32_t>(textMsdfQuadCount * EBatchSizeLimits::QUAD_INDEX_COUNT));
+	void TextRenderer::drawBatches(
+		BatchManager<RenderBatchQuad>& batches,
+		GraphicsPipelineVulkan& pipeline,
+		uint32_t imageIndex,
+		VkCommandBuffer cmd,
+		CurrentBindingsState& currentBindings,
+		uint32_t& drawCallCount
+	) {
+		ZoneScoped;
 
-			if (currentBindings.Pipeline != mMsdfRendering->ScenePipeline->get()) {
-				mMsdfRendering->ScenePipeline->bind(cmd);
+		if (batches.upload(mContext) > 0) {
+			AppDebugInfo& debugInfo = Application::get().getDebugInfo();
+			debugInfo.TextRendererUploadBytes += batches.getLastUploadByteSize();
+			SimpleRenderable& renderable = batches.getRenderable();
+			VertexArrayVulkan& vao = renderable.getVao();
+
+			if (currentBindings.Pipeline != pipeline.get()) {
+				pipeline.bind(cmd);
 				debugInfo.PipelineBinds++;
-				currentBindings.Pipeline = mMsdfRendering->ScenePipeline->get();
+				currentBindings.Pipeline = pipeline.get();
 			}
 
-			if (mQuadIndexBuffer->getBuffer() != currentBindings.IndexBuffer) {
-				//NOTE:: Text is currently rendered as a Quad so it can share the Quad batch index buffer
-				mQuadIndexBuffer->bind(cmd);
-				currentBindings.IndexBuffer = mQuadIndexBuffer->getBuffer();
-				debugInfo.IndexBufferBinds++;
+			//NOTE:: Text is currently rendered as a Quad so it can share the Quad batch index buffer, which covers a single batch.
+			for (uint32_t i = 0; i <= batches.getOpenBatchIndex(); i++) {
+				const uint32_t quadCount = static_cast<uint32_t>(batches.getBatches()[i]->getGeometryCount());
+				if (quadCount > 0) {
+					const UploadRingAllocation& allocation = batches.getBatchAllocation(i);
+					vao.setSharedVertexBuffer(allocation.Buffer, allocation.Offset);
+					vao.setDrawCount(quadCount * EBatchSizeLimits::QUAD_INDEX_COUNT);
+
+					pipeline.recordDrawCommand(imageIndex, cmd, renderable, currentBindings, 0);
+					drawCallCount++;
+				}
 			}
+		}
 
-			mMsdfRendering->ScenePipeline->recordDrawCommand(
-				imageIndex,
-				cmd,
-				*mMsdfRendering->SceneRenderableBatch,
-				currentBindings,
-				0
-			);
-			debugInfo.SceneDrawCalls++;
-			mMsdfRendering->SceneBatch->reset();
+		batches.endFrame();
+	}
+
+	void TextRenderer::drawRetainedStrings(
+		std::vector<std::shared_ptr<SimpleRenderable>>& retainedDraws,
+		GraphicsPipelineVulkan& pipeline,
+		uint32_t imageIndex,
+		VkCommandBuffer cmd,
+		CurrentBindingsState& currentBindings,
+		uint32_t& drawCallCount
+	) {
+		ZoneScoped;
+
+		if (retainedDraws.empty()) {
+			return;
+		}
+
+		if (currentBindings.Pipeline != pipeline.get()) {
+			pipeline.bind(cmd);
+			Application::get().getDebugInfo().PipelineBinds++;
+			currentBindings.Pipeline = pipeline.get();
 		}
 
-		//TODO:: some kind of function to reduce duplicate code?
+		for (const std::shared_ptr<SimpleRenderable>& renderable : retainedDraws) {
+			pipeline.recordDrawCommand(imageIndex, cmd, *renderable, currentBindings, 0);
+			drawCallCount++;
+		}
+
+		retainedDraws.clear();
+	}
+
+	void TextRenderer::drawSceneImpl(uint32_t imageIndex, VkCommandBuffer cmd, CurrentBindingsState& currentBindings) {
+		ZoneScoped;
+
+		if (mSceneCameraData == nullptr) {
+			if (mWarnOnNullSceneCameraData) {
+				LOG_ERR("TextRenderer::drawSceneImpl mSceneCameraData is null");
+			}
+
+			//Discard this frame's text so the batch pools don't keep growing while nothing is drawn
+			mSoftMaskRendering->SceneBatches->endFrame();
+			mMsdfRendering->SceneBatches->endFrame();
+			mSoftMaskRendering->SceneRetainedDraws.clear();
+			mMsdfRendering->SceneRetainedDraws.clear();
+			return;
+		}
+
+		AppDebugInfo& debugInfo = Application::get().getDebugInfo();
+
+		drawBatches(*mSoftMaskRendering->SceneBatches, *mSoftMaskRendering->ScenePipeline, imageIndex, cmd, currentBindings, debugInfo.SceneDrawCalls);
+		drawRetainedStrings(mSoftMaskRendering->SceneRetainedDraws, *mSoftMaskRendering->ScenePipeline, imageIndex, cmd, currentBindings, debugInfo.SceneDrawCalls);
+		drawBatches(*mMsdfRendering->SceneBatches, *mMsdfRendering->ScenePipeline, imageIndex, cmd, currentBindings, debugInfo.SceneDrawCalls);
+		drawRetainedStrings(mMsdfRendering->SceneRetainedDraws, *mMsdfRendering->ScenePipeline, imageIndex, cmd, currentBindings, debugInfo.SceneDrawCalls);
 	}
 
 	void TextRenderer::drawUiImpl(uint32_t imageIndex, VkCommandBuffer cmd, CurrentBindingsState& currentBindings) {
@@ -510,171 +669,268 @@ namespace DOH {
 			if (mWarnOnNullUiCameraData) {
 				LOG_ERR("TextRenderer::drawUiImpl mUiCameraData is null");
 			}
+
+			//Discard this frame's text so the batch pools don't keep growing while nothing is drawn
+			mSoftMaskRendering->UiBatches->endFrame();
+			mMsdfRendering->UiBatches->endFrame();
+			mSoftMaskRendering->UiRetainedDraws.clear();
+			mMsdfRendering->UiRetainedDraws.clear();
 			return;
 		}
 
-		VkDevice logicDevice = mContext.getLogicDevice();
 		AppDebugInfo& debugInfo = Application::get().getDebugInfo();
-		const size_t softMaskQuadCount = mSoftMaskRendering->UiBatch->getGeometryCount();
-		const size_t textMsdfQuadCount = mMsdfRendering->UiBatch->getGeometryCount();
-		const StaticVertexInputLayout& textVertexLayout = StaticVertexInputLayout::get(EVertexType::VERTEX_3D_TEXTURED_INDEXED);
 
-		if (softMaskQuadCount > 0) {
-			VertexArrayVulkan& vao = mSoftMaskRendering->UiRenderableBatch->getVao();
-			vao.getVertexBuffers()[0]->setDataMapped(
-				logicDevice,
-				mSoftMaskRendering->UiBatch->getData().data(),
-				softMaskQuadCount * Quad::BYTE_SIZE
-			);
-			vao.setDrawCount(static_cast<uint32_t>(softMaskQuadCount * EBatchSizeLimits::QUAD_INDEX_COUNT));
+		drawBatches(*mSoftMaskRendering->UiBatches, *mSoftMaskRendering->UiPipeline, imageIndex, cmd, currentBindings, debugInfo.UiDrawCalls);
+		drawRetainedStrings(mSoftMaskRendering->UiRetainedDraws, *mSoftMaskRendering->UiPipeline, imageIndex, cmd, currentBindings, debugInfo.UiDrawCalls);
+		drawBatches(*mMsdfRendering->UiBatches, *mMsdfRendering->UiPipeline, imageIndex, cmd, currentBindings, debugInfo.UiDrawCalls);
+		drawRetainedStrings(mMsdfRendering->UiRetainedDraws, *mMsdfRendering->UiPipeline, imageIndex, cmd, currentBindings, debugInfo.UiDrawCalls);
+	}
 
-			if (currentBindings.Pipeline != mSoftMaskRendering->UiPipeline->get()) {
-				mSoftMaskRendering->UiPipeline->bind(cmd);
-				debugInfo.PipelineBinds++;
-				currentBindings.Pipeline = mSoftMaskRendering->UiPipeline->get();
-			}
+	void TextRenderer::drawTextFromQuadImpl(const Quad& quad, BatchManager<RenderBatchQuad>& batches) {
+		ZoneScoped;
 
-			if (mQuadIndexBuffer->getBuffer() != currentBindings.IndexBuffer) {
-				//NOTE:: Text is currently rendered as a Quad so it can share the Quad batch index buffer
-				mQuadIndexBuffer->bind(cmd);
-				currentBindings.IndexBuffer = mQuadIndexBuffer->getBuffer();
-				debugInfo.IndexBufferBinds++;
-			}
+		if (!quad.hasTexture()) {
+			LOG_ERR("Text quad does not have texture");
+			mDroppedQuadCount++;
+			return;
+		}
 
-			const uint32_t drawCount = mSoftMaskRendering->UiPipeline->getVaoDrawCount();
-			mSoftMaskRendering->UiPipeline->recordDrawCommand(
-				imageIndex,
-				cmd,
-				*mSoftMaskRendering->UiRenderableBatch,
-				currentBindings,
-				0
-			);
-			debugInfo.UiDrawCalls++;
+		const uint32_t slotIndex = getFontPageSlotIndex(quad.getTexture());
+		if (slotIndex != static_cast<uint32_t>(-1)) {
+			batches.add(quad, slotIndex);
+			mDrawnQuadCount++;
+		} else {
+			mDroppedQuadCount++;
+		}
+	}
 
-			mSoftMaskRendering->UiBatch->reset();
+	void TextRenderer::drawTextFromQuadsImpl(
+		const std::vector<Quad>& quadArr,
+		const size_t startIndex,
+		const size_t endIndex,
+		const FontBitmap& bitmap,
+		BatchManager<RenderBatchQuad>& batches
+	) {
+		ZoneScoped;
+
+		const size_t quadCount = endIndex - startIndex;
+		if (quadCount == 0) {
+			return;
 		}
 
-		//MSDF
-		if (textMsdfQuadCount > 0) {
-			VertexArrayVulkan& vao = mMsdfRendering->UiRenderableBatch->getVao();
-			vao.getVertexBuffers()[0]->setDataMapped(
-				logicDevice,
-				mMsdfRendering->UiBatch->getData().data(),
-				textMsdfQuadCount * Quad::BYTE_SIZE
-			);
-			vao.setDrawCount(static_cast<uint32_t>(textMsdfQuadCount * EBatchSizeLimits::QUAD_INDEX_COUNT));
+		if (!batches.getBatchWithSpace(1).hasSpace(quadCount)) {
+			mSplitQuadArrayCount++;
+		}
 
-			if (currentBindings.Pipeline != mMsdfRendering->UiPipeline->get()) {
-				mMsdfRendering->UiPipeline->bind(cmd);
-				debugInfo.PipelineBinds++;
-				currentBindings.Pipeline = mMsdfRendering->UiPipeline->get();
+		//Quads can be on different font pages so the slot is looked up per quad, BatchManager opens new batches as each one fills.
+		uint32_t addedCount = 0;
+		for (size_t i = startIndex; i < endIndex; i++) {
+			const Quad& quad = quadArr[i];
+			const uint32_t slotIndex = getFontPageSlotIndex(quad.getTexture());
+			if (slotIndex != static_cast<uint32_t>(-1)) {
+				batches.add(quad, slotIndex);
+				addedCount++;
 			}
+		}
+		mDrawnQuadCount += addedCount;
+		mDroppedQuadCount += static_cast<uint32_t>(quadCount) - addedCount;
+	}
 
-			if (mQuadIndexBuffer->getBuffer() != currentBindings.IndexBuffer) {
-				//NOTE:: Text is currently rendered as a Quad so it can share the Quad batch index buffer
-				mQuadIndexBuffer->bind(cmd);
-				currentBindings.IndexBuffer = mQuadIndexBuffer->getBuffer();
-				debugInfo.IndexBufferBinds++;
-			}
+	void TextRenderer::drawTextSameTextureFromQuadsImpl(
+		const std::vector<Quad>& quadArr,
+		const size_t startIndex,
+		const size_t endIndex,
+		const FontBitmap& bitmap,
+		BatchManager<RenderBatchQuad>& batches
+	) {
+		ZoneScoped;
 
-			mMsdfRendering->UiPipeline->recordDrawCommand(
-				imageIndex,
-				cmd,
-				*mMsdfRendering->UiRenderableBatch,
-				currentBindings,
-				0
-			);
-			debugInfo.UiDrawCalls++;
+		const size_t quadCount = endIndex - startIndex;
+		if (quadCount == 0) {
+			//TODO:: Is this worth a warning?
+			//LOG_WARN("drawTextSameTextureFromQuads() quadArr size = 0");
+			return;
+		} else if (!quadArr[startIndex].hasTexture()) {
+			LOG_ERR("Quad array does not have texture");
+			mDroppedQuadCount += static_cast<uint32_t>(quadCount);
+			return;
+		}
 
-			mMsdfRendering->UiBatch->reset();
+		const uint32_t slotIndex = getFontPageSlotIndex(quadArr[startIndex].getTexture());
+		if (slotIndex == static_cast<uint32_t>(-1)) {
+			mDroppedQuadCount += static_cast<uint32_t>(quadCount);
+			return;
+		}
+
+		if (!batches.getBatchWithSpace(1).hasSpace(quadCount)) {
+			mSplitQuadArrayCount++;
 		}
 
-		//TODO:: some kind of function to reduce duplicate code?
+		batches.addAll(quadArr, startIndex, endIndex, slotIndex);
+		mDrawnQuadCount += static_cast<uint32_t>(quadCount);
 	}
 
-	void TextRenderer::drawTextFromQuadImpl(const Quad& quad, RenderBatchQuad& renderBatch) {
+	void TextRenderer::drawTextStringImpl(TextString& string, const bool scene) {
 		ZoneScoped;
 
-		if (renderBatch.hasSpace(1)) {
-			renderBatch.add(
-				quad,
-				mFontBitmapPagesTextureArary->getTextureSlotIndex(quad.getTexture().getId())
-			);
-			mDrawnQuadCount++;
+		EFrustumIntersection intersection = EFrustumIntersection::INSIDE;
+		if (scene && mSceneViewCulling) {
+			intersection = mSceneViewFrustum.intersects(string.getBounds());
+			if (intersection == EFrustumIntersection::OUTSIDE) {
+				mCulledQuadCount += static_cast<uint32_t>(string.getQuads().size());
+				return;
+			}
+		}
+
+		TextRenderingObjects& textObjects = getSuitableTextRenderingObjects(string.getCurrentFontBitmap());
+		//Retained strings are drawn whole when any of them is in view, their vertices are already on the GPU.
+		if (string.isStatic() && drawRetainedTextStringImpl(string, textObjects, scene)) {
+			return;
+		}
+
+		BatchManager<RenderBatchQuad>& batches = scene ? *textObjects.SceneBatches : *textObjects.UiBatches;
+		if (intersection == EFrustumIntersection::INTERSECTS && !string.getLineBounds().empty()) {
+			drawTextStringVisibleLinesImpl(string, batches);
+		} else if (string.getCurrentFontBitmap().getPageCount() > 1) {
+			drawTextFromQuadsImpl(string.getQuads(), string.getCurrentFontBitmap(), batches);
+		} else {
+			drawTextSameTextureFromQuadsImpl(string.getQuads(), string.getCurrentFontBitmap(), batches);
 		}
 	}
 
-	void TextRenderer::drawTextFromQuadsImpl(const std::vector<Quad>& quadArr, const FontBitmap& bitmap, RenderBatchQuad& renderBatch) {
+	void TextRenderer::drawTextStringVisibleLinesImpl(TextString& string, BatchManager<RenderBatchQuad>& batches) {
 		ZoneScoped;
 
-		size_t quadCount = quadArr.size();
-
-		if (quadCount > 0) {
-			//Only render if there is space for whole string
-			//if (textBatch.hasSpace(quadCount)) {
-			//	for (const Quad& quad : quadArr) {
-			//		textBatch.add(
-			//			quad,
-			//			mFontBitmapPagesTextureArary->getTextureSlotIndex(quad.getTexture().getId())
-			//		);
-			//	}
-			//	mDrawnQuadCount += static_cast<uint32_t>(quadCount);
-			//}
-
-			//Or
-
-			//Add as many quads as possible (even if size limitations prevent a whole string from being added) and track additions/truncations.
-			uint32_t toAddCount = static_cast<uint32_t>(std::min(quadCount, renderBatch.getRemainingGeometrySpace()));
-			for (uint32_t i = 0; i < toAddCount; i++) {
-				renderBatch.add(
-					quadArr[i],
-					mFontBitmapPagesTextureArary->getTextureSlotIndex(quadArr[i].getTexture().getId())
-				);
+		const std::vector<Quad>& quads = string.getQuads();
+		const FontBitmap& bitmap = string.getCurrentFontBitmap();
+		const bool singlePage = bitmap.getPageCount() == 1;
+		size_t visibleStart = 0;
+		size_t visibleEnd = 0;
+		for (const TextLineBounds& line : string.getLineBounds()) {
+			if (mSceneViewFrustum.intersects(line.Bounds) == EFrustumIntersection::OUTSIDE) {
+				mCulledQuadCount += line.QuadEnd - line.QuadStart;
+				continue;
+			}
+
+			if (line.QuadStart != visibleEnd && visibleEnd > visibleStart) {
+				if (singlePage) {
+					drawTextSameTextureFromQuadsImpl(quads, visibleStart, visibleEnd, bitmap, batches);
+				} else {
+					drawTextFromQuadsImpl(quads, visibleStart, visibleEnd, bitmap, batches);
+				}
+				visibleStart = line.QuadStart;
+			} else if (visibleEnd == visibleStart) {
+				visibleStart = line.QuadStart;
+			}
+			visibleEnd = line.QuadEnd;
+		}
+
+		if (visibleEnd > visibleStart) {
+			if (singlePage) {
+				drawTextSameTextureFromQuadsImpl(quads, visibleStart, visibleEnd, bitmap, batches);
+			} else {
+				drawTextFromQuadsImpl(quads, visibleStart, visibleEnd, bitmap, batches);
+			}
+		}
+	}
+
+	bool TextRenderer::drawRetainedTextStringImpl(TextString& string, TextRenderingObjects& textObjects, const bool scene) {
+		ZoneScoped;
+
+		const size_t quadCount = string.getQuads().size();
+		if (quadCount > EBatchSizeLimits::QUAD_BATCH_MAX_GEO_COUNT) {
+			return false;
+		} else if (quadCount == 0) {
+			return true;
+		}
+
+		if (string.mRetainedId == 0) {
+			string.mRetainedId = mNextRetainedStringId++;
+			string.mGpuDirty = true;
+		}
+
+		RetainedTextString& retained = mRetainedStrings[string.mRetainedId];
+		if (string.isGpuDirty() || retained.Vao == nullptr) {
+			if (!uploadRetainedTextString(string, retained)) {
+				return false;
 			}
-			mDrawnQuadCount += toAddCount;
-			//mTruncatedQuadCount += static_cast<uint32_t>(quadCount) - toAddCount;
+			string.mGpuDirty = false;
+		}
+
+		if (scene) {
+			textObjects.SceneRetainedDraws.emplace_back(retained.SceneRenderable);
+		} else {
+			textObjects.UiRetainedDraws.emplace_back(retained.UiRenderable);
 		}
+		mDrawnQuadCount += static_cast<uint32_t>(quadCount);
+
+		return true;
 	}
 
-	void TextRenderer::drawTextSameTextureFromQuadsImpl(const std::vector<Quad>& quadArr, const FontBitmap& bitmap, RenderBatchQuad& renderBatch) {
+	bool TextRenderer::uploadRetainedTextString(TextString& string, RetainedTextString& retained) {
 		ZoneScoped;
 
-		size_t quadCount = quadArr.size();
+		const std::vector<Quad>& quads = string.getQuads();
+		RenderBatchQuad& scratch = *mRetainedVertexScratch;
+		scratch.reset();
+		for (const Quad& quad : quads) {
+			const uint32_t slotIndex = getFontPageSlotIndex(quad.getTexture());
+			if (slotIndex != static_cast<uint32_t>(-1)) {
+				scratch.add(quad, slotIndex);
+			} else {
+				mDroppedQuadCount++;
+			}
+		}
+
+		const uint32_t quadCount = static_cast<uint32_t>(scratch.getGeometryCount());
 		if (quadCount == 0) {
-			//TODO:: Is this worth a warning?
-			//LOG_WARN("drawTextSameTextureFromQuads() quadArr size = 0");
-			return;
-		} else if (!quadArr[0].hasTexture()) {
-			LOG_ERR("Quad array does not have texture");
-			return;
+			return false;
 		}
 
-		if (renderBatch.hasSpace(quadCount)) {
-			renderBatch.addAll(
-				quadArr,
-				mFontBitmapPagesTextureArary->getTextureSlotIndex(quadArr[0].getTexture().getId())
-			);
-			mDrawnQuadCount += static_cast<uint32_t>(quadCount);
+		//The previous buffer may still be in use by frames in flight so a new one is always created, static strings
+		// are expected to change rarely enough that this is cheaper than synchronising writes to the old one.
+		if (retained.Vao != nullptr) {
+			mContext.addGpuResourceToClose(retained.Vao);
 		}
-		//TODO:: truncated system like Renderer2d::drawQuadScene or just leave at not rendering whole array?
+
+		std::shared_ptr<VertexBufferVulkan> vertexBuffer = mContext.createStagedVertexBuffer(
+			StaticVertexInputLayout::get(EVertexType::VERTEX_3D_TEXTURED_INDEXED),
+			scratch.getData(),
+			static_cast<VkDeviceSize>(quadCount) * Quad::BYTE_SIZE,
+			VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+		);
+		scratch.reset();
+
+		retained.Vao = mContext.createVertexArray();
+		retained.Vao->addVertexBuffer(vertexBuffer);
+		retained.Vao->setIndexBuffer(mQuadIndexBuffer, true);
+		retained.Vao->setDrawCount(quadCount * EBatchSizeLimits::QUAD_INDEX_COUNT);
+		retained.SceneRenderable = std::make_shared<SimpleRenderable>(retained.Vao, mFontRenderingDescSetsInstanceScene);
+		retained.UiRenderable = std::make_shared<SimpleRenderable>(retained.Vao, mFontRenderingDescSetsInstanceUi);
+
+		mRetainedUploadCount++;
+		return true;
 	}
 
-	void TextRenderer::drawTextStringImpl(TextString& string, RenderBatchQuad& renderBatch) {
+	void TextRenderer::releaseRetainedStringImpl(const uint32_t retainedId) {
 		ZoneScoped;
 
-		if (string.getCurrentFontBitmap().getPageCount() > 1) {
-			drawTextFromQuadsImpl(string.getQuads(), string.getCurrentFontBitmap(), renderBatch);
-		} else {
-			drawTextSameTextureFromQuadsImpl(string.getQuads(), string.getCurrentFontBitmap(), renderBatch);
+		const auto itr = mRetainedStrings.find(retainedId);
+		if (itr != mRetainedStrings.end()) {
+			if (itr->second.Vao != nullptr) {
+				mContext.addGpuResourceToClose(itr->second.Vao);
+			}
+			mRetainedStrings.erase(itr);
 		}
 	}
 
-	RenderBatchQuad& TextRenderer::getSuitableTextBatchSceneImpl(const FontBitmap& bitmap) {
-		return bitmap.getTextRenderMethod() == ETextRenderMethod::SOFT_MASK ? *mSoftMaskRendering->SceneBatch : *mMsdfRendering->SceneBatch;
+	BatchManager<RenderBatchQuad>& TextRenderer::getSuitableTextBatchSceneImpl(const FontBitmap& bitmap) {
+		return bitmap.getTextRenderMethod() == ETextRenderMethod::SOFT_MASK ? *mSoftMaskRendering->SceneBatches : *mMsdfRendering->SceneBatches;
 	}
 	
-	RenderBatchQuad& TextRenderer::getSuitableTextBatchUiImpl(const FontBitmap& bitmap) {
-		return bitmap.getTextRenderMethod() == ETextRenderMethod::SOFT_MASK ? *mSoftMaskRendering->UiBatch : *mMsdfRendering->UiBatch;
+	BatchManager<RenderBatchQuad>& TextRenderer::getSuitableTextBatchUiImpl(const FontBitmap& bitmap) {
+		return bitmap.getTextRenderMethod() == ETextRenderMethod::SOFT_MASK ? *mSoftMaskRendering->UiBatches : *mMsdfRendering->UiBatches;
 	}
 
 	void TextRenderer::init(RenderingContextVulkan& context) {
@@ -696,11 +952,11 @@ namespace DOH {
 		}
 	}
 
-	void TextRenderer::onSwapChainResize(SwapChainVulkan& swapChain) {
+	void TextRenderer::onRenderPassesRecreated() {
 		if (INSTANCE != nullptr) {
-			INSTANCE->onSwapChainResizeImpl(swapChain);
+			INSTANCE->onRenderPassesRecreatedImpl();
 		} else {
-			LOG_ERR("onSwapChainResize called when text renderer is NOT initialised.");
+			LOG_ERR("onRenderPassesRecreated called when text renderer is NOT initialised.");
 		}
 	}
 
@@ -712,6 +968,33 @@ namespace DOH {
 		}
 	}
 
+	void TextRenderer::beginFrame(uint32_t imageIndex) {
+		//NOTE:: No nullptr check as this function is expected to be called each frame.
+		INSTANCE->beginFrameImpl(imageIndex);
+	}
+
+	bool TextRenderer::loadFontBitmap(const char* fontName, const char* filePath, const char* imageDir, ETextRenderMethod textRenderMethod) {
+		if (INSTANCE != nullptr) {
+			return INSTANCE->loadFontBitmapImpl(fontName, filePath, imageDir, textRenderMethod);
+		} else {
+			LOG_ERR("loadFontBitmap called when text renderer is NOT initialised.");
+			return false;
+		}
+	}
+
+	bool TextRenderer::unloadFontBitmap(const char* fontName) {
+		if (INSTANCE != nullptr) {
+			return INSTANCE->unloadFontBitmapImpl(fontName);
+		} else {
+			LOG_ERR("unloadFontBitmap called when text renderer is NOT initialised.");
+			return false;
+		}
+	}
+
+	bool TextRenderer::isFontBitmapLoading(const char* fontName) {
+		return INSTANCE != nullptr && INSTANCE->isFontBitmapLoadingImpl(fontName);
+	}
+
 	void TextRenderer::updateFontBitmapTextureArrayDescriptorSet() {
 		if (INSTANCE != nullptr) {
 			INSTANCE->updateFontBitmapTextureArrayDescriptorSetImpl();
@@ -720,6 +1003,45 @@ namespace DOH {
 		}
 	}
 
+	void TextRenderer::resetLocalDebugInfo() {
+		//NOTE:: No nullptr check as this function is expected to be called each frame.
+		INSTANCE->mLastFrameDrawnQuadCount = INSTANCE->mDrawnQuadCount;
+		INSTANCE->mLastFrameDroppedQuadCount = INSTANCE->mDroppedQuadCount;
+		INSTANCE->mLastFrameSplitQuadArrayCount = INSTANCE->mSplitQuadArrayCount;
+		INSTANCE->mLastFrameRetainedUploadCount = INSTANCE->mRetainedUploadCount;
+		INSTANCE->mLastFrameCulledQuadCount = INSTANCE->mCulledQuadCount;
+		INSTANCE->mDrawnQuadCount = 0u;
+		INSTANCE->mDroppedQuadCount = 0u;
+		INSTANCE->mSplitQuadArrayCount = 0u;
+		INSTANCE->mRetainedUploadCount = 0u;
+		INSTANCE->mCulledQuadCount = 0u;
+		INSTANCE->mGlyphRunCache->resetLocalDebugInfo();
+	}
+
+	size_t TextRenderer::appendCachedStringAsQuads(
+		std::vector<Quad>& quads,
+		const char* string,
+		const FontBitmap& bitmap,
+		const glm::vec3 rootPos,
+		const float scale,
+		const glm::vec4& colour,
+		const ETextFlags2d flags
+	) {
+		//NOTE:: Strings can be laid out before init or after close, the cache only exists in between.
+		if (INSTANCE != nullptr && INSTANCE->mGlyphRunCache != nullptr) {
+			return INSTANCE->mGlyphRunCache->appendStringAsQuads(quads, string, bitmap, rootPos, scale, colour, flags);
+		}
+
+		return TextString::appendStringAsQuads(quads, string, bitmap, rootPos, scale, colour, flags);
+	}
+
+	void TextRenderer::releaseRetainedString(const uint32_t retainedId) {
+		//NOTE:: Static TextStrings can outlive the text renderer, their GPU data is closed with the renderer.
+		if (INSTANCE != nullptr) {
+			INSTANCE->releaseRetainedStringImpl(retainedId);
+		}
+	}
+
 	bool TextRenderer::hasFont(const char* fontName) {
 		if (INSTANCE != nullptr) {
 			return INSTANCE->mFontBitmaps.find(fontName) != INSTANCE->mFontBitmaps.end();
@@ -750,7 +1072,7 @@ namespace DOH {
 
 		descInfoTypes.push_back({ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1u }); //Soft Mask Font
 		descInfoTypes.push_back({ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1u }); //MSDF Font
-		descInfoTypes.push_back({ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 8u }); //Font Pages Texture Array
+		descInfoTypes.push_back({ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 8u * MAX_FRAMES_IN_FLIGHT }); //Font Pages Texture Array, one per frame in flight
 
 		return descInfoTypes;
 	}
@@ -765,6 +1087,17 @@ namespace DOH {
 		mFontRenderingDescSetsInstanceUi->setDescriptorSetArray(TextRenderer::CAMERA_UBO_SLOT, { cameraData->DescriptorSets[0], cameraData->DescriptorSets[1] });
 	}
 
+	void TextRenderer::drawBatchManagerImGui(const char* label, const BatchManager<RenderBatchQuad>& batches) {
+		if (ImGui::CollapsingHeader(label)) {
+			ImGui::PushID(label);
+			ImGui::Text("Batch Count: %i (%i used last frame)", batches.getBatchCount(), batches.getLastFrameBatchCount());
+			ImGui::Text("Quad Count last frame: %i", batches.getLastFrameGeoCount());
+			ImGui::Text("Uploaded last frame: %.2f KiB", static_cast<double>(batches.getLastUploadByteSize()) / 1024.0);
+			ImGui::Text("Idle Frames: %i of %i", batches.getIdleFrameCount(), BatchManager<RenderBatchQuad>::SHRINK_IDLE_FRAME_COUNT);
+			ImGui::PopID();
+		}
+	}
+
 	void TextRenderer::drawImGuiImpl(EImGuiContainerType type) {
 		ZoneScoped;
 
@@ -781,9 +1114,68 @@ namespace DOH {
 
 		if (open) {
 
-			ImGui::Text("This is the text renderer");
+			ImGui::Text("Quads drawn last frame: %i", mLastFrameDrawnQuadCount);
+			ImGui::Text("Quads dropped last frame: %i (texture isn't a font page)", mLastFrameDroppedQuadCount);
+			ImGui::Text("Quad arrays split across batches last frame: %i", mLastFrameSplitQuadArrayCount);
+			ImGui::Text(
+				"Scene quads culled last frame: %i (view culling %s)",
+				mLastFrameCulledQuadCount,
+				mSceneViewCulling ? "on" : "off"
+			);
+			ImGui::Text(
+				"Static strings: %i (%i uploaded last frame)",
+				static_cast<uint32_t>(mRetainedStrings.size()),
+				mLastFrameRetainedUploadCount
+			);
+
+			if (ImGui::CollapsingHeader("Fonts")) {
+				ImGui::Text(
+					"Font page slots: %i of %i",
+					mFontBitmapPagesTextureArary->getCurrentTextureCount(),
+					mFontBitmapPagesTextureArary->getMaxTextureCount()
+				);
+				for (const auto& font : mFontBitmaps) {
+					ImGui::Text("%s: %i page(s)", font.first.c_str(), font.second->getPageCount());
+				}
+				for (const StreamingFontBitmap& font : mStreamingFontBitmaps) {
+					ImGui::Text(
+						"%s: Loading %i of %i page(s)",
+						font.Name.c_str(),
+						static_cast<uint32_t>(font.Bitmap->getPageTextures().size()),
+						static_cast<uint32_t>(font.Bitmap->getPageFilePaths().size())
+					);
+				}
+			}
+
+			if (ImGui::CollapsingHeader("Glyph Run Cache")) {
+				const uint32_t hits = mGlyphRunCache->getLastFrameHitCount();
+				const uint32_t lookups = hits + mGlyphRunCache->getLastFrameMissCount();
+				ImGui::Text(
+					"Hits last frame: %i of %i (%.1f%%)",
+					hits,
+					lookups,
+					lookups > 0 ? (static_cast<double>(hits) / static_cast<double>(lookups)) * 100.0 : 0.0
+				);
+				ImGui::Text("Evictions last frame: %i", mGlyphRunCache->getLastFrameEvictionCount());
+				ImGui::Text(
+					"Runs: %i using %.2f KiB of %.2f KiB",
+					static_cast<uint32_t>(mGlyphRunCache->getRunCount()),
+					static_cast<double>(mGlyphRunCache->getByteSize()) / 1024.0,
+					static_cast<double>(mGlyphRunCache->getByteBudget()) / 1024.0
+				);
+				int budgetKiB = static_cast<int>(mGlyphRunCache->getByteBudget() / 1024);
+				if (ImGui::InputInt("Budget KiB", &budgetKiB, 16, 256)) {
+					mGlyphRunCache->setByteBudget(static_cast<size_t>(budgetKiB < 0 ? 0 : budgetKiB) * 1024);
+				}
+				if (ImGui::Button("Clear Glyph Run Cache")) {
+					mGlyphRunCache->clear();
+				}
+			}
 
-			ImGui::Text("TODO:: This will be filled with related info.");
+			drawBatchManagerImGui("Soft Mask Scene", *mSoftMaskRendering->SceneBatches);
+			drawBatchManagerImGui("Soft Mask UI", *mSoftMaskRendering->UiBatches);
+			drawBatchManagerImGui("MSDF Scene", *mMsdfRendering->SceneBatches);
+			drawBatchManagerImGui("MSDF UI", *mMsdfRendering->UiBatches);
 
 			//TODO:: Fill this out with info and controls.
 
@@ -2,12 +2,17 @@
 
 #include "dough/Core.h"
 #include "dough/rendering/text/FontBitmap.h"
+#include "dough/rendering/text/GlyphRunCache.h"
 #include "dough/rendering/textures/TextureArray.h"
 #include "dough/rendering/pipeline/GraphicsPipelineVulkan.h"
 #include "dough/rendering/SwapChainVulkan.h"
 #include "dough/rendering/batches/RenderBatchQuad.h"
+#include "dough/rendering/batches/BatchManager.h"
 #include "dough/rendering/renderables/SimpleRenderable.h"
 #include "dough/scene/geometry/collections/TextString.h"
+#include "dough/files/ResourceHandler.h"
+
+#include <future>
 
 namespace DOH {
 
@@ -41,7 +46,22 @@ namespace DOH {
 		bool mQuadIndexBufferShared;
 		std::shared_ptr<DescriptorSetsInstanceVulkan> mFontRenderingDescSetsInstanceScene;
 		std::shared_ptr<DescriptorSetsInstanceVulkan> mFontRenderingDescSetsInstanceUi;
-		VkDescriptorSet mFontBitmapPagesDescSet;
+		//One per frame in flight so a set can be updated when fonts change without touching one the GPU may be using.
+		std::array<VkDescriptorSet, MAX_FRAMES_IN_FLIGHT> mFontBitmapPagesDescSets;
+		//Whether the set for that image index is out of date with mFontBitmapPagesTextureArary, updated in beginFrameImpl.
+		std::array<bool, MAX_FRAMES_IN_FLIGHT> mFontBitmapPagesDescSetsStale;
+
+		//A font loaded with loadFontBitmap, its page images are decoded on worker threads and uploaded when ready.
+		struct StreamingFontBitmap {
+			std::string Name;
+			std::shared_ptr<FontBitmap> Bitmap;
+			//In page order, only NextPageLoad is waited on so pages are added in order.
+			std::vector<std::future<TextureCreationData>> PageLoads;
+			size_t NextPageLoad;
+			//Set once every page has been uploaded, published at the start of the next frame when the uploads have been submitted.
+			bool PagesCreated;
+		};
+		std::vector<StreamingFontBitmap> mStreamingFontBitmaps;
 
 		struct TextRenderingObjects {
 			std::shared_ptr<ShaderProgram> SceneShaderProgram;
@@ -50,21 +70,42 @@ namespace DOH {
 			//Scene
 			std::unique_ptr<GraphicsPipelineInstanceInfo> ScenePipelineInstanceInfo;
 			std::shared_ptr<GraphicsPipelineVulkan> ScenePipeline;
-			std::unique_ptr<RenderBatchQuad> SceneBatch;
-			std::shared_ptr<SimpleRenderable> SceneRenderableBatch;
+			std::unique_ptr<BatchManager<RenderBatchQuad>> SceneBatches;
+			std::vector<std::shared_ptr<SimpleRenderable>> SceneRetainedDraws;
 			//Ui
 			std::unique_ptr<GraphicsPipelineInstanceInfo> UiPipelineInstanceInfo;
 			std::shared_ptr<GraphicsPipelineVulkan> UiPipeline;
-			std::unique_ptr<RenderBatchQuad> UiBatch;
-			std::shared_ptr<SimpleRenderable> UiRenderableBatch;
+			std::unique_ptr<BatchManager<RenderBatchQuad>> UiBatches;
+			std::vector<std::shared_ptr<SimpleRenderable>> UiRetainedDraws;
 		};
 
 		std::unique_ptr<TextRenderingObjects> mSoftMaskRendering;
 		std::unique_ptr<TextRenderingObjects> mMsdfRendering;
 
+		//GPU data of a static TextString, see TextString::setStatic().
+		struct RetainedTextString {
+			//Device local vertex buffer and the shared quad index buffer.
+			std::shared_ptr<VertexArrayVulkan> Vao;
+			//Both use Vao, one for each camera's descriptor sets.
+			std::shared_ptr<SimpleRenderable> SceneRenderable;
+			std::shared_ptr<SimpleRenderable> UiRenderable;
+		};
+		std::unordered_map<uint32_t, RetainedTextString> mRetainedStrings;
+		uint32_t mNextRetainedStringId;
+		//Retained string vertices are written here before being uploaded. Only needs to be the size of a single batch as
+		// retained strings share the quad index buffer, longer strings are drawn through the text batches instead.
+		std::unique_ptr<RenderBatchQuad> mRetainedVertexScratch;
+
+		//Laid out strings re-used by TextString::getStringAsQuads and appendCachedStringAsQuads.
+		std::unique_ptr<GlyphRunCache> mGlyphRunCache;
+
 		std::shared_ptr<CameraGpuData> mSceneCameraData;
 		std::shared_ptr<CameraGpuData> mUiCameraData;
 
+		//Scene TextStrings outside of this aren't drawn while mSceneViewCulling, see setSceneViewCulling().
+		ViewFrustum mSceneViewFrustum;
+		bool mSceneViewCulling;
+
 		//TODO:: A better way of doing no rendering with TextRenderer would be to "unload" and "load" when needed,
 		// including just removing it from the "render order" as needed.
 		// 
@@ -76,31 +117,107 @@ namespace DOH {
 		//Local Debug Info
 		//Includes both Scene & UI Quads
 		uint32_t mDrawnQuadCount;
+		//Quads not drawn because their texture isn't a font page in mFontBitmapPagesTextureArary.
+		uint32_t mDroppedQuadCount;
+		//Quad arrays that didn't fit in the open batch and were split across batches.
+		//Before text had a pool of batches these were truncated (multi-page fonts) or not drawn at all (single page fonts).
+		uint32_t mSplitQuadArrayCount;
+		//Static TextStrings uploaded because they were new or changed.
+		uint32_t mRetainedUploadCount;
+		//Scene TextString quads not drawn because they were out of view.
+		uint32_t mCulledQuadCount;
+		uint32_t mLastFrameDrawnQuadCount;
+		uint32_t mLastFrameDroppedQuadCount;
+		uint32_t mLastFrameSplitQuadArrayCount;
+		uint32_t mLastFrameRetainedUploadCount;
+		uint32_t mLastFrameCulledQuadCount;
 
 		void initImpl();
 		void closeImpl();
-		void onSwapChainResizeImpl(SwapChainVulkan& swapChain);
+		void onRenderPassesRecreatedImpl();
 		bool createFontBitmapImpl(const char* fontName, const char* filePath, const char* imageDir, ETextRenderMethod textRenderMethod);
+		bool loadFontBitmapImpl(const char* fontName, const char* filePath, const char* imageDir, ETextRenderMethod textRenderMethod);
+		bool unloadFontBitmapImpl(const char* fontName);
+		bool isFontBitmapLoadingImpl(const char* fontName) const;
 		void addFontBitmapToTextTextureArrayImpl(const FontBitmap& fontBitmap);
 		void updateFontBitmapTextureArrayDescriptorSetImpl();
+		void writeFontBitmapPagesDescriptorSet(uint32_t imageIndex);
+		//Update the stale font pages descriptor set of imageIndex, publish fonts whose pages were uploaded last frame and
+		// upload the pages decoded since.
+		void beginFrameImpl(uint32_t imageIndex);
+		//Wait on and free any page images still being decoded for font.
+		static void discardStreamingFontBitmap(StreamingFontBitmap& font);
 
 		void drawSceneImpl(uint32_t imageIndex, VkCommandBuffer cmd, CurrentBindingsState& currentBindings);
 		void drawUiImpl(uint32_t imageIndex, VkCommandBuffer cmd, CurrentBindingsState& currentBindings);
 
-		void drawTextFromQuadImpl(const Quad& quad, RenderBatchQuad& renderbatch);
-		void drawTextFromQuadsImpl(const std::vector<Quad>& quadArr, const FontBitmap& bitmap, RenderBatchQuad& renderBatch);
-		void drawTextSameTextureFromQuadsImpl(const std::vector<Quad>& quadArr, const FontBitmap& bitmap, RenderBatchQuad& renderBatch);
-		void drawTextStringImpl(TextString& string, RenderBatchQuad& renderBatch);
+		//Upload batches into the context's upload ring, record a draw per used batch and reset the batches for the next frame.
+		void drawBatches(
+			BatchManager<RenderBatchQuad>& batches,
+			GraphicsPipelineVulkan& pipeline,
+			uint32_t imageIndex,
+			VkCommandBuffer cmd,
+			CurrentBindingsState& currentBindings,
+			uint32_t& drawCallCount
+		);
+
+		//Record a draw for each retained string drawn this frame, then clear retainedDraws.
+		void drawRetainedStrings(
+			std::vector<std::shared_ptr<SimpleRenderable>>& retainedDraws,
+			GraphicsPipelineVulkan& pipeline,
+			uint32_t imageIndex,
+			VkCommandBuffer cmd,
+			CurrentBindingsState& currentBindings,
+			uint32_t& drawCallCount
+		);
+
+		//Slot of texture in mFontBitmapPagesTextureArary, or -1 if texture isn't a font page.
+		inline uint32_t getFontPageSlotIndex(const TextureVulkan& texture) const { return mFontBitmapPagesTextureArary->getTextureSlotIndex(texture.getId()); }
+
+		void drawTextFromQuadImpl(const Quad& quad, BatchManager<RenderBatchQuad>& batches);
+		inline void drawTextFromQuadsImpl(const std::vector<Quad>& quadArr, const FontBitmap& bitmap, BatchManager<RenderBatchQuad>& batches) {
+			drawTextFromQuadsImpl(quadArr, 0, quadArr.size(), bitmap, batches);
+		}
+		inline void drawTextSameTextureFromQuadsImpl(const std::vector<Quad>& quadArr, const FontBitmap& bitmap, BatchManager<RenderBatchQuad>& batches) {
+			drawTextSameTextureFromQuadsImpl(quadArr, 0, quadArr.size(), bitmap, batches);
+		}
+		//Draw quadArr from startIndex up to endIndex.
+		void drawTextFromQuadsImpl(
+			const std::vector<Quad>& quadArr,
+			const size_t startIndex,
+			const size_t endIndex,
+			const FontBitmap& bitmap,
+			BatchManager<RenderBatchQuad>& batches
+		);
+		void drawTextSameTextureFromQuadsImpl(
+			const std::vector<Quad>& quadArr,
+			const size_t startIndex,
+			const size_t endIndex,
+			const FontBitmap& bitmap,
+			BatchManager<RenderBatchQuad>& batches
+		);
+		void drawTextStringImpl(TextString& string, const bool scene);
+		//Draw the lines of string that are in mSceneViewFrustum, adjacent visible lines are added as one range.
+		void drawTextStringVisibleLinesImpl(TextString& string, BatchManager<RenderBatchQuad>& batches);
+		//Returns false if string can't be retained, in which case it should be drawn through the text batches.
+		bool drawRetainedTextStringImpl(TextString& string, TextRenderingObjects& textObjects, const bool scene);
+		//Upload the vertices of string to a new buffer, closing its previous one.
+		bool uploadRetainedTextString(TextString& string, RetainedTextString& retained);
+		void releaseRetainedStringImpl(const uint32_t retainedId);
 
 		void setSceneCameraDataImpl(std::shared_ptr<CameraGpuData> cameraData);
 		void setUiCameraDataImpl(std::shared_ptr<CameraGpuData> cameraData);
 
-		RenderBatchQuad& getSuitableTextBatchSceneImpl(const FontBitmap& bitmap);
-		RenderBatchQuad& getSuitableTextBatchUiImpl(const FontBitmap& bitmap);
-		static inline RenderBatchQuad& getSuitableTextBatchScene(TextString& string) { return INSTANCE->getSuitableTextBatchSceneImpl(string.getCurrentFontBitmap()); }
-		static inline RenderBatchQuad& getSuitableTextBatchUi(TextString& string) { return INSTANCE->getSuitableTextBatchUiImpl(string.getCurrentFontBitmap()); }
+		inline TextRenderingObjects& getSuitableTextRenderingObjects(const FontBitmap& bitmap) {
+			return bitmap.getTextRenderMethod() == ETextRenderMethod::SOFT_MASK ? *mSoftMaskRendering : *mMsdfRendering;
+		}
+		BatchManager<RenderBatchQuad>& getSuitableTextBatchSceneImpl(const FontBitmap& bitmap);
+		BatchManager<RenderBatchQuad>& getSuitableTextBatchUiImpl(const FontBitmap& bitmap);
+		static inline BatchManager<RenderBatchQuad>& getSuitableTextBatchScene(TextString& string) { return INSTANCE->getSuitableTextBatchSceneImpl(string.getCurrentFontBitmap()); }
+		static inline BatchManager<RenderBatchQuad>& getSuitableTextBatchUi(TextString& string) { return INSTANCE->getSuitableTextBatchUiImpl(string.getCurrentFontBitmap()); }
 
 		void drawImGuiImpl(EImGuiContainerType type);
+		void drawBatchManagerImGui(const char* label, const BatchManager<RenderBatchQuad>& batches);
 
 	public:
 		static constexpr const char* ARIAL_SOFT_MASK_NAME = "Arial-SoftMask";
@@ -112,19 +229,47 @@ namespace DOH {
 
 		static void init(RenderingContextVulkan& context);
 		static void close();
-		static void onSwapChainResize(SwapChainVulkan& swapChain);
-		//TODO:: Currently only private impl function is usable because creating font bitmaps post-init is not available.
-		//static void createFontBitmap(const char* fontName, std::shared_ptr<FontBitmap> fontBitmap);
+		static void onRenderPassesRecreated();
+		//Called by the context each frame after acquiring imageIndex and before any text is drawn.
+		static void beginFrame(uint32_t imageIndex);
+		/**
+		* Load a font at runtime. Glyphs are read now, page images are decoded on worker threads and uploaded over the following frames.
+		* The font is available through hasFont/getFontBitmap once its pages are on the GPU, see isFontBitmapLoading.
+		* Returns false if a font with fontName is already loaded or loading.
+		*/
+		static bool loadFontBitmap(const char* fontName, const char* filePath, const char* imageDir, ETextRenderMethod textRenderMethod);
+		/**
+		* Unload a font loaded at init or through loadFontBitmap, or cancel its loading. The default font can't be unloaded.
+		* IMPORTANT:: TextStrings and quads laid out with the font must not be drawn after this, their texture slots may be re-used.
+		*/
+		static bool unloadFontBitmap(const char* fontName);
+		static bool isFontBitmapLoading(const char* fontName);
 		static void addFontBitmapToTextTextureArray(const FontBitmap& fontBitmap);
-		//TEMP:: Updates mFontBitmapPagesDescSet to point to textures currently in mFontBitmapPagesTextureArary.
-		//TODO:: Rework this system to allow for more textures and not rely on the app logic to call this function if more font bitmaps are added.
+		//Mark the font pages descriptor sets as out of date, each is updated the next time its frame begins.
 		static void updateFontBitmapTextureArrayDescriptorSet();
+		/**
+		* Same as TextString::appendStringAsQuads but goes through the glyph run cache, strings drawn often (labels, counters, captions)
+		* are only laid out again after being evicted. Lays out directly when the text renderer isn't initialised.
+		*/
+		static size_t appendCachedStringAsQuads(
+			std::vector<Quad>& quads,
+			const char* string,
+			const FontBitmap& bitmap,
+			const glm::vec3 rootPos,
+			const float scale = 1.0f,
+			const glm::vec4& colour = { 1.0f, 1.0f, 1.0f, 1.0f },
+			const ETextFlags2d flags = ETextFlags2d::NONE
+		);
+		static inline void setGlyphRunCacheByteBudget(const size_t byteBudget) { INSTANCE->mGlyphRunCache->setByteBudget(byteBudget); }
+		//Close the GPU data of a static TextString, called by TextString.
+		static void releaseRetainedString(const uint32_t retainedId);
 
 		static inline void drawScene(uint32_t imageIndex, VkCommandBuffer cmd, CurrentBindingsState& currentBindings) { INSTANCE->drawSceneImpl(imageIndex, cmd, currentBindings); }
 		static inline void drawUi(uint32_t imageIndex, VkCommandBuffer cmd, CurrentBindingsState& currentBindings) { INSTANCE->drawUiImpl(imageIndex, cmd, currentBindings); }
 
 		static inline uint32_t getDrawnQuadCount() { return INSTANCE->mDrawnQuadCount; }
-		static inline void resetLocalDebugInfo() { INSTANCE->mDrawnQuadCount = 0; }
+		static inline uint32_t getDroppedQuadCount() { return INSTANCE->mDroppedQuadCount; }
+		static void resetLocalDebugInfo();
 
 		static bool hasFont(const char* fontName);
 		static FontBitmap& getFontBitmap(const char* fontName);
@@ -139,11 +284,24 @@ namespace DOH {
 		static inline void drawTextSameTextureFromQuadsUi(const std::vector<Quad>& quadArr, const FontBitmap& bitmap) { INSTANCE->drawTextSameTextureFromQuadsImpl(quadArr, bitmap, INSTANCE->getSuitableTextBatchUiImpl(bitmap)); }
 
 		//-----Collection Objects-----
-		static inline void drawTextStringScene(TextString& string) { INSTANCE->drawTextStringImpl(string, INSTANCE->getSuitableTextBatchSceneImpl(string.getCurrentFontBitmap())); }
-		static inline void drawTextStringUi(TextString& string) { INSTANCE->drawTextStringImpl(string, INSTANCE->getSuitableTextBatchUiImpl(string.getCurrentFontBitmap())); }
+		static inline void drawTextStringScene(TextString& string) { INSTANCE->drawTextStringImpl(string, true); }
+		static inline void drawTextStringUi(TextString& string) { INSTANCE->drawTextStringImpl(string, false); }
 
 		static inline void setSceneCameraData(std::shared_ptr<CameraGpuData> cameraData) { INSTANCE->setSceneCameraDataImpl(cameraData); }
 		static inline void setUiCameraData(std::shared_ptr<CameraGpuData> cameraData) { INSTANCE->setUiCameraDataImpl(cameraData); }
+		/**
+		* Cull scene TextStrings against the view volume of projectionView, e.g. from ICamera::getProjectionViewMatrix().
+		* Strings entirely out of view aren't drawn and long strings partly in view only have their visible lines drawn.
+		* Call again whenever the scene camera moves, culling uses the last matrix given until disableSceneViewCulling().
+		* Quads drawn through drawTextFromQuads*Scene aren't culled.
+		*/
+		static inline void setSceneViewCulling(const glm::mat4x4& projectionView) {
+			INSTANCE->mSceneViewFrustum.setProjectionView(projectionView);
+			INSTANCE->mSceneViewCulling = true;
+		}
+		static inline void disableSceneViewCulling() { INSTANCE->mSceneViewCulling = false; }
+		static inline bool isSceneViewCulling() { return INSTANCE->mSceneViewCulling; }
+		static inline uint32_t getLastFrameCulledQuadCount() { return INSTANCE->mLastFrameCulledQuadCount; }
 		static inline void setWarnOnNullSceneCameraData(bool enabled) { INSTANCE->mWarnOnNullSceneCameraData = enabled; }
 		static inline void setWarnOnNullUiCameraData(bool enabled) { INSTANCE->mWarnOnNullUiCameraData = enabled; }
 
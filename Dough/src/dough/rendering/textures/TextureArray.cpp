@@ -16,7 +16,11 @@ namespace DOH {
 		mTextureSlots(textures),
 		FALLBACK_TEXTURE(fallbackTexture),
 		mNextTextureSlotIndex(static_cast<uint32_t>(textures.size()))
-	{}
+	{
+		for (uint32_t i = 0; i < mTextureSlots.size(); i++) {
+			mTextureIdSlotIndices.emplace(mTextureSlots[i].get().getId(), i);
+		}
+	}
 
 	TextureArray::TextureArray(
 		const uint32_t maxTextureCount,
@@ -28,28 +32,18 @@ namespace DOH {
 	{
 		for (TextureVulkan& texture : textures) {
 			mTextureSlots.push_back(texture);
+			mTextureIdSlotIndices.emplace(texture.getId(), mNextTextureSlotIndex);
 			mNextTextureSlotIndex++;
 		}
 	}
 
 	bool TextureArray::hasTextureId(const uint32_t textureId) const {
-		for (TextureVulkan& texture : mTextureSlots) {
-			if (texture.getId() == textureId) {
-				return true;
-			}
-		}
-
-		return false;
+		return mTextureIdSlotIndices.find(textureId) != mTextureIdSlotIndices.end();
 	}
 
 	uint32_t TextureArray::getTextureSlotIndex(const uint32_t textureId) const {
-		for (size_t i = 0; i < mTextureSlots.size(); i++) {
-			if (mTextureSlots[i].get().getId() == textureId) {
-				return static_cast<uint32_t>(i);
-			}
-		}
-
-		return -1;
+		const auto slot = mTextureIdSlotIndices.find(textureId);
+		return slot != mTextureIdSlotIndices.end() ? slot->second : -1;
 	}
 
 	uint32_t TextureArray::addNewTexture(TextureVulkan& texture) {
@@ -59,8 +53,14 @@ namespace DOH {
 		}
 
 		uint32_t slotIndex = 0;
-		if (hasTextureSlotAvailable()) {
+		if (!mFreeSlotIndices.empty()) {
+			slotIndex = mFreeSlotIndices.back();
+			mFreeSlotIndices.pop_back();
+			mTextureSlots[slotIndex] = texture;
+			mTextureIdSlotIndices.emplace(texture.getId(), slotIndex);
+		} else if (hasTextureSlotAvailable()) {
 			mTextureSlots.push_back(texture);
+			mTextureIdSlotIndices.emplace(texture.getId(), mNextTextureSlotIndex);
 			slotIndex = mNextTextureSlotIndex;
 			mNextTextureSlotIndex++;
 		}
@@ -68,13 +68,20 @@ namespace DOH {
 		return slotIndex;
 	}
 
-	const int TextureArray::isTextureInUse(const uint32_t textureId) const {
-		for (int i = 0; i < mTextureSlots.size(); i++) {
-			if (mTextureSlots[i].get().getId() == textureId) {
-				return i;
-			}
+	bool TextureArray::removeTexture(const uint32_t textureId) {
+		const auto slot = mTextureIdSlotIndices.find(textureId);
+		if (slot == mTextureIdSlotIndices.end()) {
+			return false;
 		}
 
-		return -1;
+		mTextureSlots[slot->second] = FALLBACK_TEXTURE;
+		mFreeSlotIndices.push_back(slot->second);
+		mTextureIdSlotIndices.erase(slot);
+		return true;
+	}
+
+	const int TextureArray::isTextureInUse(const uint32_t textureId) const {
+		const auto slot = mTextureIdSlotIndices.find(textureId);
+		return slot != mTextureIdSlotIndices.end() ? static_cast<int>(slot->second) : -1;
 	}
 }
@@ -3,16 +3,22 @@
 #include "dough/Core.h"
 #include "dough/rendering/textures/TextureVulkan.h"
 
+#include <unordered_map>
+
 namespace DOH {
 
 	class TextureArray {
 
 	private:
 		const uint32_t MAX_TEXTURE_COUNT;
-		const TextureVulkan& FALLBACK_TEXTURE;
+		TextureVulkan& FALLBACK_TEXTURE;
 
 		std::vector<std::reference_wrapper<TextureVulkan>> mTextureSlots;
+		//Texture id to slot index, so lookups don't have to search through mTextureSlots
+		std::unordered_map<uint32_t, uint32_t> mTextureIdSlotIndices;
 		uint32_t mNextTextureSlotIndex;
+		//Slots below mNextTextureSlotIndex emptied by removeTexture, they hold FALLBACK_TEXTURE until re-used by addNewTexture.
+		std::vector<uint32_t> mFreeSlotIndices;
 
 	public:
 		TextureArray(
@@ -31,7 +37,7 @@ namespace DOH {
 		);
 
 		bool hasTextureId(const uint32_t textureId) const;
-		//Search through texture slots for matching texture id, else return -1.
+		//Slot index of matching texture id, else return -1.
 		uint32_t getTextureSlotIndex(const uint32_t textureId) const;
 
 		//TODO:: Sometimes when this is called it is after hasTextureSlotAvailable() has already been called,
@@ -39,17 +45,24 @@ namespace DOH {
 
 		// Attemp to add a new texture, if successful return its index, else return 0
 		uint32_t addNewTexture(TextureVulkan& texture);
+		//Empty the slot of textureId so it can be re-used, other textures keep their slots. Returns false if textureId isn't in the array.
+		//Descriptor sets using this array must be updated before the texture is closed.
+		bool removeTexture(const uint32_t textureId);
 
 		inline void reset() {
 			mTextureSlots.clear();
+			mTextureIdSlotIndices.clear();
 			mNextTextureSlotIndex = 0;
+			mFreeSlotIndices.clear();
 		}
 
 		inline const std::vector<std::reference_wrapper<TextureVulkan>> getTextureSlots() const { return mTextureSlots; }
-		inline bool hasTextureSlotAvailable() const { return mNextTextureSlotIndex < MAX_TEXTURE_COUNT; }
-		inline bool hasTextureSlotsAvailable(uint32_t slotCount) const { return (mNextTextureSlotIndex + slotCount) < MAX_TEXTURE_COUNT - 1; }
+		inline bool hasTextureSlotAvailable() const { return !mFreeSlotIndices.empty() || mNextTextureSlotIndex < MAX_TEXTURE_COUNT; }
+		inline bool hasTextureSlotsAvailable(uint32_t slotCount) const {
+			return (mNextTextureSlotIndex - static_cast<uint32_t>(mFreeSlotIndices.size()) + slotCount) < MAX_TEXTURE_COUNT - 1;
+		}
 		inline const uint32_t getMaxTextureCount() const { return MAX_TEXTURE_COUNT; }
-		inline const uint32_t getCurrentTextureCount() const { return static_cast<uint32_t>(mTextureSlots.size()); }
+		inline const uint32_t getCurrentTextureCount() const { return static_cast<uint32_t>(mTextureSlots.size() - mFreeSlotIndices.size()); }
 		inline const uint32_t getNextTextureSlotIndex() const { return mNextTextureSlotIndex; }
 		inline const TextureVulkan& getFallbackTexture() const { return FALLBACK_TEXTURE; }
 
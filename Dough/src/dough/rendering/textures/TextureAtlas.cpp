@@ -14,7 +14,13 @@ namespace DOH {
 		const std::string& textureFilePath,
 		const uint32_t rowCount,
 		const uint32_t colCount
-	) : TextureVulkan(logicDevice, physicalDevice, textureFilePath),
+	) : TextureVulkan(
+			logicDevice,
+			physicalDevice,
+			textureFilePath,
+			//Rows are laid out along x, see getInnerTextureCoordsOrigin
+			TextureMipSettings::tileGrid(rowCount != 0 ? rowCount : 1, colCount != 0 ? colCount : 1)
+		),
 		mRowCount(rowCount != 0 ? rowCount : 1),
 		mColCount(colCount != 0 ? colCount : 1),
 		mNormalisedInnerTextureWidth(1.0f / mRowCount),
@@ -83,7 +89,11 @@ namespace DOH {
 		std::string imageFilePath = atlasTextureDir;
 		imageFilePath.append(atlasFileData->TextureFileName);
 
-		TextureCreationData textureCreationData = ResourceHandler::loadTexture(imageFilePath.c_str());
+		TextureCreationData textureCreationData = ResourceHandler::loadTexture(
+			imageFilePath.c_str(),
+			true,
+			{ IndexedTextureAtlas::getMaxMipLevels(mInnerTextureMap) }
+		);
 		if (textureCreationData.Failed) {
 			//TODO:: Handle this OUTSIDE of this function, maybe have mName = "FAILED" or mChannels = INT_MAX to signal that the texture creation failed.
 			LOG_ERR("IndexedAtlas " << atlasFileData->Name << " failed to loadTexture: " << imageFilePath);
@@ -95,10 +105,34 @@ namespace DOH {
 		mChannels = textureCreationData.Channels;
 
 		//IMPORTANT:: Textures used in the engine are assumed to have 4 channels when used.
-		VkDeviceSize imageSize = textureCreationData.Width * textureCreationData.Height * 4;
-
-		load(textureCreationData.Data, imageSize);
+		load(textureCreationData.Data, textureCreationData.getByteSize(), textureCreationData.MipLevels);
+		ResourceHandler::freeTexture(textureCreationData);
 
 		mId = ResourceHandler::getNextUniqueTextureId();
 	}
+
+	uint32_t IndexedTextureAtlas::getMaxMipLevels(const std::unordered_map<std::string, InnerTexture>& innerTextures) {
+		if (innerTextures.empty()) {
+			return 0;
+		}
+
+		//Add levels while every inner texture's edges still land on texel boundaries and none shrink below MIN_TILE_SIZE
+		uint32_t mipLevels = 1;
+		for (uint32_t scale = 2; scale != 0; scale <<= 1) {
+			for (const auto& [name, innerTexture] : innerTextures) {
+				const uint32_t width = innerTexture.getWidthTexels();
+				const uint32_t height = innerTexture.getHeightTexels();
+				if (
+					innerTexture.TexelCoords[0] % scale != 0 || innerTexture.TexelCoords[1] % scale != 0 ||
+					width % scale != 0 || height % scale != 0 ||
+					width / scale < TextureMipSettings::MIN_TILE_SIZE || height / scale < TextureMipSettings::MIN_TILE_SIZE
+				) {
+					return mipLevels;
+				}
+			}
+			mipLevels++;
+		}
+
+		return mipLevels;
+	}
 }
@@ -89,6 +89,9 @@ namespace DOH {
 		std::unordered_map<std::string, InnerTexture> mInnerTextureMap;
 		std::unordered_map<std::string, TextureAtlasAnimation> mAnimations;
 
+		//Levels the atlas can be mipped to before filtering blends inner textures together
+		static uint32_t getMaxMipLevels(const std::unordered_map<std::string, InnerTexture>& innerTextures);
+
 	public:
 		IndexedTextureAtlas(VkDevice logicDevice, VkPhysicalDevice physicalDevice, const char* atlasInfoFilePath, const char* atlasTextureDir);
 
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+
+namespace DOH {
+
+	//How ResourceHandler::loadTexture builds a texture's mip chain. Part of the cooked texture's file name so each choice is cooked separately.
+	struct TextureMipSettings {
+		//Smallest size in texels a tile may be shrunk to, below this bilinear filtering blends neighbouring tiles together.
+		constexpr static uint32_t MIN_TILE_SIZE = 4;
+
+		//Upper limit on the level count, 0 for no limit. 1 disables mips, e.g. for font pages where
+		//alpha weighted averaging would distort distance fields and soft masks.
+		uint32_t MaxLevels = 0;
+		//Textures made from a grid of equally sized tiles, such as MonoSpaceTextureAtlas, stop before a level would
+		//blend tiles together or shift their edges off texel boundaries.
+		uint32_t TileColumns = 1;
+		uint32_t TileRows = 1;
+
+		constexpr static inline TextureMipSettings noMips() { return { 1, 1, 1 }; }
+		constexpr static inline TextureMipSettings tileGrid(uint32_t columns, uint32_t rows) { return { 0, columns, rows }; }
+	};
+}
@@ -13,23 +13,26 @@ namespace DOH {
 		mId(ResourceHandler::INVALID_TEXTURE_ID),
 		mWidth(0),
 		mHeight(0),
-		mChannels(0)
+		mChannels(0),
+		mPendingUploadQueue(nullptr)
 	{}
 
 	TextureVulkan::TextureVulkan(
 		VkDevice logicDevice,
 		VkPhysicalDevice physicalDevice,
-		const std::string& filePath
+		const std::string& filePath,
+		const TextureMipSettings& mipSettings
 	) : mName(filePath),
 		mSampler(VK_NULL_HANDLE),
 		mId(0),
 		mWidth(0),
 		mHeight(0),
-		mChannels(0)
+		mChannels(0),
+		mPendingUploadQueue(nullptr)
 	{
 		ZoneScoped;
 
-		TextureCreationData textureData = ResourceHandler::loadTexture(filePath.c_str());
+		TextureCreationData textureData = ResourceHandler::loadTexture(filePath.c_str(), true, mipSettings);
 
 		if (textureData.Failed) {
 			//TODO:: Handle this
@@ -42,9 +45,38 @@ namespace DOH {
 		mChannels = textureData.Channels;
 
 		//IMPORTANT:: Textures used in the engine are assumed to have 4 channels when used.
-		VkDeviceSize imageSize = textureData.Width * textureData.Height * 4;
+		load(textureData.Data, textureData.getByteSize(), textureData.MipLevels);
+		ResourceHandler::freeTexture(textureData);
 
-		load(textureData.Data, imageSize);
+		mId = ResourceHandler::getNextUniqueTextureId();
+	}
+
+	TextureVulkan::TextureVulkan(
+		VkDevice logicDevice,
+		VkPhysicalDevice physicalDevice,
+		const std::string& name,
+		const TextureCreationData& textureData
+	) : mName(name),
+		mSampler(VK_NULL_HANDLE),
+		mId(0),
+		mWidth(0),
+		mHeight(0),
+		mChannels(0),
+		mPendingUploadQueue(nullptr)
+	{
+		ZoneScoped;
+
+		if (textureData.Failed) {
+			LOG_ERR("Failed to create texture from loaded data: " << name);
+			return;
+		}
+
+		mWidth = textureData.Width;
+		mHeight = textureData.Height;
+		mChannels = textureData.Channels;
+
+		//IMPORTANT:: Textures used in the engine are assumed to have 4 channels when used.
+		load(textureData.Data, textureData.getByteSize(), textureData.MipLevels);
 
 		mId = ResourceHandler::getNextUniqueTextureId();
 	}
@@ -63,7 +95,8 @@ namespace DOH {
 		mId(0),
 		mWidth(1),
 		mHeight(1),
-		mChannels(4)
+		mChannels(4),
+		mPendingUploadQueue(nullptr)
 	{
 		ZoneScoped;
 
@@ -115,53 +148,44 @@ namespace DOH {
 	void TextureVulkan::close(VkDevice logicDevice) {
 		ZoneScoped;
 
+		if (mPendingUploadQueue != nullptr) {
+			mPendingUploadQueue->wait(mPendingUpload);
+			mPendingUploadQueue = nullptr;
+		}
+
 		vkDestroySampler(logicDevice, mSampler, nullptr);
 		mTextureImage->close(logicDevice);
 		mUsingGpuResource = false;
 	}
 
-	void TextureVulkan::load(void* data, VkDeviceSize size) {
+	void TextureVulkan::load(const void* data, VkDeviceSize size, uint32_t mipLevels) {
 		ZoneScoped;
 
 		if (!isUsingGpuResource()) {
 			auto& context = Application::get().getRenderer().getContext();
-			std::shared_ptr<BufferVulkan> imageStagingBuffer = context.createStagedBuffer(
-				data,
-				size,
-				VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-				VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
-			);
 			VkImage image = context.createImage(
 				static_cast<uint32_t>(mWidth),
 				static_cast<uint32_t>(mHeight),
 				VK_FORMAT_R8G8B8A8_SRGB,
 				VK_IMAGE_TILING_OPTIMAL,
-				VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT
-			);
-			VkDeviceMemory imageMem = context.createImageMemory(image, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-			context.transitionStagedImageLayout(
-				image,
-				VK_IMAGE_LAYOUT_UNDEFINED,
-				VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-				VK_IMAGE_ASPECT_COLOR_BIT
+				VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+				mipLevels
 			);
-			context.copyBufferToImage(
-				imageStagingBuffer->getBuffer(),
+			DeviceMemoryAllocation imageMem = context.createImageMemory(image, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+			//Layout transitions and copy are batched with other uploads, the image is ready to sample once the batch is submitted.
+			mPendingUploadQueue = &context.getStagingUploadQueue();
+			mPendingUpload = mPendingUploadQueue->uploadImage(
 				image,
+				data,
+				size,
 				static_cast<uint32_t>(mWidth),
-				static_cast<uint32_t>(mHeight)
-			);
-			context.transitionStagedImageLayout(
-				image,
-				VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-				VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-				VK_IMAGE_ASPECT_COLOR_BIT
+				static_cast<uint32_t>(mHeight),
+				VK_IMAGE_ASPECT_COLOR_BIT,
+				mipLevels
 			);
-			VkImageView imageView = context.createImageView(image, VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_ASPECT_COLOR_BIT);
-			mSampler = context.createSampler();
-			mTextureImage = std::make_unique<ImageVulkan>(image, imageMem, imageView);
-
-			imageStagingBuffer->close(context.getLogicDevice());
+			VkImageView imageView = context.createImageView(image, VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_ASPECT_COLOR_BIT, mipLevels);
+			mSampler = context.createSampler(mipLevels);
+			mTextureImage = std::make_unique<ImageVulkan>(context.getMemoryAllocator(), image, imageMem, imageView);
 
 			mUsingGpuResource = true;
 		}
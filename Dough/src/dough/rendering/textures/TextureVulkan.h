@@ -3,9 +3,13 @@
 #include "dough/Utils.h"
 #include "dough/rendering/IGPUResourceVulkan.h"
 #include "dough/rendering/ImageVulkan.h"
+#include "dough/rendering/StagingUploadQueueVulkan.h"
+#include "dough/rendering/textures/TextureMipSettings.h"
 
 namespace DOH {
 
+	struct TextureCreationData;
+
 	class TextureVulkan : public IGPUResourceVulkan {
 
 	protected:
@@ -18,6 +22,10 @@ namespace DOH {
 		int mHeight;
 		int mChannels;
 
+		//Upload of the image recorded by load(), close() waits for it so the image isn't destroyed while it's still being copied into.
+		StagingUploadQueueVulkan* mPendingUploadQueue;
+		StagingUploadHandle mPendingUpload;
+
 	public:
 		//TODO:: Keep this here or place somewhere else in another class?
 		static constexpr float COLOUR_MAX_VALUE = 255.0f;
@@ -34,11 +42,28 @@ namespace DOH {
 		* @param logicDevice The logic device needed to create the resource on GPU.
 		* @param physicalDevice The physical device needed to create the resource on GPU.
 		* @param filePath The file path of the texture. This is used as the texture's name.
+		* @param mipSettings Limits on the texture's mip chain, see TextureMipSettings.
+		*/
+		TextureVulkan(
+			VkDevice logicDevice,
+			VkPhysicalDevice physicalDevice,
+			const std::string& filePath,
+			const TextureMipSettings& mipSettings = {}
+		);
+
+		/**
+		* Upload already loaded texture data onto GPU, e.g. data read by ResourceHandler::loadTexture on another thread.
+		* 
+		* @param logicDevice The logic device needed to create the resource on GPU.
+		* @param physicalDevice The physical device needed to create the resource on GPU.
+		* @param name A name for the texture, usually the file path it was loaded from.
+		* @param textureData The loaded texture, still owned by the caller.
 		*/
 		TextureVulkan(
 			VkDevice logicDevice,
 			VkPhysicalDevice physicalDevice,
-			const std::string& filePath
+			const std::string& name,
+			const TextureCreationData& textureData
 		);
 
 		//TODO:: Custom width & height with limits.
@@ -81,6 +106,7 @@ namespace DOH {
 		//Allow for loading outside of contructor
 		TextureVulkan();
 
-		void load(void* data, VkDeviceSize size);
+		//data holds mipLevels levels laid out as TextureCreationData::Data
+		void load(const void* data, VkDeviceSize size, uint32_t mipLevels = 1);
 	};
 }
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "dough/Maths.h"
+
+#include <array>
+
+namespace DOH {
+
+	struct AxisAlignedBounds3d {
+		glm::vec3 Min;
+		glm::vec3 Max;
+	};
+
+	enum class EFrustumIntersection {
+		OUTSIDE,
+		INTERSECTS,
+		INSIDE
+	};
+
+	/**
+	* The view volume of a camera as six inward facing planes extracted from its projection view matrix, for culling on the CPU.
+	* Works for both OrthographicCamera and PerspectiveCamera. Planes are extracted for a -1 to 1 clip depth, which is looser than
+	* Vulkan's 0 to 1 near plane, so culling errs on the side of drawing.
+	*
+	* A default constructed frustum has all zero planes and intersects everything as INSIDE.
+	*/
+	class ViewFrustum {
+	private:
+		//Left, right, bottom, top, near, far. xyz is the (unnormalised) normal and w the distance, points in front have a positive distance.
+		std::array<glm::vec4, 6> mPlanes;
+
+	public:
+		ViewFrustum() {
+			mPlanes.fill(glm::vec4(0.0f));
+		}
+		ViewFrustum(const glm::mat4x4& projectionView) {
+			setProjectionView(projectionView);
+		}
+
+		inline void setProjectionView(const glm::mat4x4& projectionView) {
+			//glm matrices are column major, m[column][row]
+			const glm::vec4 row0 = { projectionView[0][0], projectionView[1][0], projectionView[2][0], projectionView[3][0] };
+			const glm::vec4 row1 = { projectionView[0][1], projectionView[1][1], projectionView[2][1], projectionView[3][1] };
+			const glm::vec4 row2 = { projectionView[0][2], projectionView[1][2], projectionView[2][2], projectionView[3][2] };
+			const glm::vec4 row3 = { projectionView[0][3], projectionView[1][3], projectionView[2][3], projectionView[3][3] };
+
+			mPlanes = {
+				row3 + row0,
+				row3 - row0,
+				row3 + row1,
+				row3 - row1,
+				row3 + row2,
+				row3 - row2
+			};
+		}
+
+		inline EFrustumIntersection intersects(const AxisAlignedBounds3d& bounds) const {
+			bool inside = true;
+			for (const glm::vec4& plane : mPlanes) {
+				//If the corner furthest along the plane's normal is behind it, so is the whole box
+				const glm::vec3 furthest = {
+					plane.x >= 0.0f ? bounds.Max.x : bounds.Min.x,
+					plane.y >= 0.0f ? bounds.Max.y : bounds.Min.y,
+					plane.z >= 0.0f ? bounds.Max.z : bounds.Min.z
+				};
+				if (glm::dot(glm::vec3(plane), furthest) + plane.w < 0.0f) {
+					return EFrustumIntersection::OUTSIDE;
+				}
+
+				const glm::vec3 nearest = {
+					plane.x >= 0.0f ? bounds.Min.x : bounds.Max.x,
+					plane.y >= 0.0f ? bounds.Min.y : bounds.Max.y,
+					plane.z >= 0.0f ? bounds.Min.z : bounds.Max.z
+				};
+				if (glm::dot(glm::vec3(plane), nearest) + plane.w < 0.0f) {
+					inside = false;
+				}
+			}
+
+			return inside ? EFrustumIntersection::INSIDE : EFrustumIntersection::INTERSECTS;
+		}
+	};
+}
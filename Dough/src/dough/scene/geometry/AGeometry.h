@@ -3,6 +3,7 @@
 #include "dough/Utils.h"
 
 #include <glm/glm.hpp>
+#include <array>
 
 namespace DOH {
 
@@ -30,5 +31,31 @@ namespace DOH {
 		inline void translateZ(float z) { Position.z += z; }
 		inline void translateXY(float x, float y) { Position.x += x; Position.y += y; }
 		inline void translateXYZ(float x, float y, float z = 0.0f) { Position.x += x; Position.y += y; Position.z += z; }
+
+		/**
+		* Calculate the XY position of each corner ordered: botLeft, botRight, topRight, topLeft.
+		* Rotation is around the centre. sin & cos are only calculated once per geometry (and skipped when not rotated),
+		* each corner is then the centre plus/minus the two rotated half extents.
+		*/
+		inline void getCornersXY(std::array<glm::vec2, 4>& corners) const {
+			if (Rotation == 0.0f) {
+				corners[0] = { Position.x, Position.y };
+				corners[1] = { Position.x + Size.x, Position.y };
+				corners[2] = { Position.x + Size.x, Position.y + Size.y };
+				corners[3] = { Position.x, Position.y + Size.y };
+			} else {
+				const glm::vec2 halfSize = Size * 0.5f;
+				const glm::vec2 centre = { Position.x + halfSize.x, Position.y + halfSize.y };
+				const float sinRot = glm::sin(Rotation);
+				const float cosRot = glm::cos(Rotation);
+				const glm::vec2 axisX = { cosRot * halfSize.x, sinRot * halfSize.x };
+				const glm::vec2 axisY = { -sinRot * halfSize.y, cosRot * halfSize.y };
+
+				corners[0] = centre - axisX - axisY;
+				corners[1] = centre + axisX - axisY;
+				corners[2] = centre + axisX + axisY;
+				corners[3] = centre - axisX + axisY;
+			}
+		}
 	};
 }
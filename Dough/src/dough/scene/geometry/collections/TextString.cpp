@@ -1,6 +1,11 @@
 #include "dough/scene/geometry/collections/TextString.h"
 
 #include "dough/Logging.h"
+#include "dough/rendering/text/TextRenderer.h"
+
+#include <tracy/public/tracy/Tracy.hpp>
+
+#include <algorithm>
 
 namespace DOH {
 
@@ -9,73 +14,81 @@ namespace DOH {
 		mString(string),
 		mFontBitmap(fontBitmap),
 		mScale(scale),
-		mColour({ 1.0f, 1.0f, 1.0f, 1.0f })
+		mColour({ 1.0f, 1.0f, 1.0f, 1.0f }),
+		mFlags(ETextFlags2d::NONE),
+		mLayoutBounds(),
+		mStatic(false),
+		mGpuDirty(true),
+		mRetainedId(0),
+		mBounds({ Position, Position })
 	{
 		if (getLength() == 0) {
 			LOG_WARN("TextString given empty string");
 		}
 
-		mStringQuads = TextString::getStringAsQuads(string, fontBitmap, Position, mScale, mColour);
+		relayout();
+	}
+
+	TextString::~TextString() {
+		if (mRetainedId != 0) {
+			TextRenderer::releaseRetainedString(mRetainedId);
+		}
 	}
 
 	void TextString::setString(const char* string) {
+		mGpuDirty = true;
+
 		size_t length = strlen(string);
 		if (length == 0) {
 			mStringQuads.clear();
 			mString = "";
+			updateBounds();
 			return;
 		}
 
 		mString = string;
 
 		//Immediately change quad data
-		mStringQuads = TextString::getStringAsQuads(mString, mFontBitmap, Position, mScale, mColour);
+		relayout();
 	}
 
 	void TextString::setRoot(glm::vec3 root) {
-		glm::vec3 delta = (Position - root) * mScale;
+		mGpuDirty = true;
+
+		//Moving a clipped string changes which glyphs are visible
+		if (mLayoutBounds.HasClipRect) {
+			Position = root;
+			relayout();
+			return;
+		}
+
+		const glm::vec3 delta = root - Position;
 		for (Quad& quad : mStringQuads) {
-			quad.Position -= delta;
+			quad.Position += delta;
 		}
 		Position = root;
+
+		mBounds.Min += delta;
+		mBounds.Max += delta;
+		for (TextLineBounds& line : mLineBounds) {
+			line.Bounds.Min += delta;
+			line.Bounds.Max += delta;
+		}
 	}
 
 	void TextString::setScale(const float scale) {
 		if (mScale == scale) {
 			return;
-		} else if (mStringQuads.size() == 0) {
-			mScale = scale;
-			return;
-		}
-
-		//Immediately change quad data
-		const size_t stringLength = strlen(mString);
-		size_t quadIndex = 0;
-		for (size_t stringIndex = 0; stringIndex < stringLength; stringIndex++) {
-			//Special characters not represented by quads
-			const char currentChar = mString[stringIndex];
-			if (currentChar == 32 || currentChar == '\n' || currentChar == '\t') {
-				continue;
-			} else { //Characters represented by quads
-				Quad& quad = mStringQuads[quadIndex];
-
-				//Remove old scale transformations
-				quad.Size /= mScale;
-				quad.Position /= mScale;
-
-				//Apply new scale transformations
-				quad.Size *= scale;
-				quad.Position *= scale;
-
-				quadIndex++;
-			}
 		}
 
+		//Laid out again rather than scaling each quad so kerning, wrapping & clipping stay correct
 		mScale = scale;
+		relayout();
 	}
 
 	void TextString::setColour(const glm::vec4& colourRgba) {
 		mColour = colourRgba;
+		mGpuDirty = true;
 		
 		//Immediately change quad data
 		for (Quad& quad : mStringQuads) {
@@ -83,6 +96,87 @@ namespace DOH {
 		}
 	}
 
+	void TextString::setFlags(const ETextFlags2d flags) {
+		if (mFlags == flags) {
+			return;
+		}
+
+		mFlags = flags;
+		relayout();
+	}
+
+	void TextString::setLayoutBounds(const TextLayoutBounds2d& bounds) {
+		mLayoutBounds = bounds;
+		relayout();
+	}
+
+	void TextString::setStatic(const bool isStatic) {
+		if (mStatic == isStatic) {
+			return;
+		}
+
+		mStatic = isStatic;
+		mGpuDirty = true;
+
+		if (!mStatic && mRetainedId != 0) {
+			TextRenderer::releaseRetainedString(mRetainedId);
+			mRetainedId = 0;
+		}
+	}
+
+	void TextString::updateBounds() {
+		ZoneScoped;
+
+		mLineBounds.clear();
+		if (mStringQuads.empty()) {
+			mBounds = { Position, Position };
+			return;
+		}
+
+		const bool perLine = mStringQuads.size() >= TextString::LINE_BOUNDS_MIN_QUAD_COUNT;
+		const Quad& firstQuad = mStringQuads[0];
+		mBounds = { firstQuad.Position, firstQuad.Position + glm::vec3(firstQuad.Size, 0.0f) };
+		TextLineBounds line = { mBounds, 0u, 0u };
+		float lastQuadX = firstQuad.Position.x;
+		for (uint32_t i = 0; i < static_cast<uint32_t>(mStringQuads.size()); i++) {
+			const Quad& quad = mStringQuads[i];
+			const glm::vec3 quadMin = quad.Position;
+			const glm::vec3 quadMax = quad.Position + glm::vec3(quad.Size, 0.0f);
+			mBounds.Min = glm::min(mBounds.Min, quadMin);
+			mBounds.Max = glm::max(mBounds.Max, quadMax);
+
+			if (perLine) {
+				//Quads are in line order and each line starts back towards the left, so a quad left of the last starts a new line.
+				//At worst (e.g. right aligned lines) lines are merged, their bounds are still correct just less tight.
+				if (quad.Position.x < lastQuadX) {
+					mLineBounds.emplace_back(line);
+					line = { { quadMin, quadMax }, i, i };
+				} else {
+					line.Bounds.Min = glm::min(line.Bounds.Min, quadMin);
+					line.Bounds.Max = glm::max(line.Bounds.Max, quadMax);
+				}
+				line.QuadEnd = i + 1;
+				lastQuadX = quad.Position.x;
+			}
+		}
+
+		if (perLine) {
+			mLineBounds.emplace_back(line);
+		}
+	}
+
+	void TextString::relayout() {
+		mGpuDirty = true;
+		mStringQuads.clear();
+
+		//mLayoutBounds are relative to the root
+		TextLayoutBounds2d bounds = mLayoutBounds;
+		bounds.ClipBotLeft += glm::vec2(Position);
+		bounds.ClipTopRight += glm::vec2(Position);
+		TextString::appendStringAsQuads(mStringQuads, mString, mFontBitmap, Position, bounds, mScale, mColour, mFlags);
+		updateBounds();
+	}
+
 	std::vector<Quad> TextString::getStringAsQuads(
 		const char* string,
 		const FontBitmap& bitmap,
@@ -91,74 +185,285 @@ namespace DOH {
 		const glm::vec4& colour,
 		const ETextFlags2d flags
 	) {
+		std::vector<Quad> quads;
+		TextRenderer::appendCachedStringAsQuads(quads, string, bitmap, rootPos, scale, colour, flags);
+		return quads;
+	}
+
+	size_t TextString::appendStringAsQuads(
+		std::vector<Quad>& quads,
+		const char* string,
+		const FontBitmap& bitmap,
+		const glm::vec3 rootPos,
+		const float scale,
+		const glm::vec4& colour,
+		const ETextFlags2d flags
+	) {
+		return TextString::appendStringAsQuads(quads, string, bitmap, rootPos, TextLayoutBounds2d{}, scale, colour, flags);
+	}
+
+	size_t TextString::appendStringAsQuads(
+		std::vector<Quad>& quads,
+		const char* string,
+		const FontBitmap& bitmap,
+		const glm::vec3 rootPos,
+		const TextLayoutBounds2d& bounds,
+		const float scale,
+		const glm::vec4& colour,
+		const ETextFlags2d flags
+	) {
+		ZoneScoped;
+
 		const size_t stringLength = strlen(string);
 
 		if (stringLength == 0) {
-			return {};
+			return 0;
 		}
 
-		std::vector<Quad> quads;
-		quads.reserve(stringLength);
+		const size_t startQuadCount = quads.size();
+		const bool wrap = bounds.isWrapping();
+		const bool clip = bounds.HasClipRect;
+
+		//Byte length is an upper bound on glyph count, so quads isn't re-allocated during layout.
+		//Not reserved when clipping as most of a clipped string is usually culled.
+		if (!clip) {
+			quads.reserve(startQuadCount + stringLength);
+		}
+
+		const float baseNormScaled = bitmap.getBaseNorm() * scale;
+		const float lineHeightScaled = bitmap.getLineHeightNorm() * scale;
+		const bool kerning = bitmap.getKerningCount() > 0 && !hasTextFlag(flags, ETextFlags2d::NO_KERNING);
+		const float alignFactor = hasTextFlag(flags, ETextFlags2d::ALIGN_RIGHT) ?
+			1.0f : (hasTextFlag(flags, ETextFlags2d::ALIGN_CENTRE) ? 0.5f : 0.0f);
+		const float alignWidth = wrap ? bounds.MaxWidth : 0.0f;
+
+		//Conservative check of whether a line's glyphs can reach the clip rect, glyphs don't reach further than a line above or below their pen.
+		//A line is also laid out when the line after it is visible as wrapping can carry its last word down.
+		const auto isLineInClip = [&](const float penY) {
+			return penY - (lineHeightScaled * 3.0f) < bounds.ClipTopRight.y && penY + (lineHeightScaled * 2.0f) > bounds.ClipBotLeft.y;
+		};
 
 		glm::vec3 currentPos = rootPos;
 		uint32_t lastCharId = 0;
-		for (size_t i = 0; i < stringLength; i++) {
-			//TODO:: currently doesn't support a UTF-8 conversion so a cast to uint produces ASCII decimal values
-			const uint32_t charId = static_cast<uint32_t>(string[i]);
+		uint32_t missingCharCount = 0;
+		uint32_t firstMissingCharId = 0;
+
+		//Current line, its quads start at lineStartQuad and lineEndX is the pen after its last glyph so trailing spaces aren't aligned
+		size_t lineStartQuad = startQuadCount;
+		float lineEndX = rootPos.x;
+		bool lineVisible = !clip || isLineInClip(currentPos.y);
+
+		//Last point the current line can be wrapped at, just after a space or tab
+		bool hasWrapPoint = false;
+		size_t wrapPointQuad = 0;
+		float wrapPointX = 0.0f;
+		float wrapPointLineEndX = 0.0f;
+
+		const auto markWrapPoint = [&]() {
+			hasWrapPoint = true;
+			wrapPointQuad = quads.size();
+			wrapPointX = currentPos.x;
+			wrapPointLineEndX = lineEndX;
+		};
+
+		//Align then clip the current line's quads up to lineEndQuad, culled quads are removed.
+		//Returns the index after the line's remaining quads.
+		const auto finishLine = [&](const size_t lineEndQuad) {
+			if (alignFactor > 0.0f) {
+				const float offsetX = alignFactor * (alignWidth - (lineEndX - rootPos.x));
+				for (size_t q = lineStartQuad; q < lineEndQuad; q++) {
+					quads[q].Position.x += offsetX;
+				}
+			}
+
+			if (!clip) {
+				return lineEndQuad;
+			}
+
+			size_t keptEnd = lineStartQuad;
+			for (size_t q = lineStartQuad; q < lineEndQuad; q++) {
+				if (TextString::clipQuad(quads[q], bounds.ClipBotLeft, bounds.ClipTopRight)) {
+					if (keptEnd != q) {
+						quads[keptEnd] = quads[q];
+					}
+					keptEnd++;
+				}
+			}
+
+			if (keptEnd != lineEndQuad) {
+				quads.erase(quads.begin() + keptEnd, quads.begin() + lineEndQuad);
+			}
+			return keptEnd;
+		};
+
+		size_t i = 0;
+		while (i < stringLength) {
+			if (!lineVisible) {
+				//Lines only move down so nothing after this can be visible
+				if (currentPos.y + (lineHeightScaled * 2.0f) <= bounds.ClipBotLeft.y) {
+					break;
+				}
+
+				//Above the clip rect. Without wrapping the line can't affect those after it so skip to its new line without decoding it.
+				if (!wrap) {
+					const char* newLine = static_cast<const char*>(memchr(string + i, '\n', stringLength - i));
+					if (newLine == nullptr) {
+						break;
+					}
+					i = static_cast<size_t>(newLine - string);
+				}
+			}
+
+			const uint32_t charId = TextString::decodeUtf8(string, stringLength, i);
 
 			//Handle special characters
 			if (charId == 32) { //space
 				currentPos.x += bitmap.getSpaceWidthNorm() * scale;
-				lastCharId = 0;
+				lastCharId = charId;
+				if (wrap) {
+					markWrapPoint();
+				}
 				continue;
 			} else if (charId == 10) { //new line
-				currentPos.y -= bitmap.getLineHeightNorm() * scale;
+				lineStartQuad = finishLine(quads.size());
+				currentPos.y -= lineHeightScaled;
 				currentPos.x = rootPos.x;
+				lineEndX = rootPos.x;
+				hasWrapPoint = false;
+				lineVisible = !clip || isLineInClip(currentPos.y);
 				lastCharId = 0;
 				continue;
 			} else if (charId == 9) { //tab
 				currentPos.x += bitmap.getTabWidthNorm() * scale;
 				lastCharId = 0;
+				if (wrap) {
+					markWrapPoint();
+				}
 				continue;
 			}
 
-			const auto& g = bitmap.getGlyphMap().find(charId);
-			if (g != bitmap.getGlyphMap().end()) {
-				const float glyphHeightScaled = g->second.Size.y * scale;
-
-				Quad quad = {};
-				quad.Position = {
-					currentPos.x + (g->second.Offset.x * scale),
-					currentPos.y - glyphHeightScaled + ((bitmap.getBaseNorm() + g->second.Offset.y) * scale),
-					currentPos.z
-				};
-				quad.Size = {
-					g->second.Size.x * scale,
-					glyphHeightScaled
-				};
-				quad.TextureCoords = {
-					//botLeft
-					g->second.TexCoordTopLeft.x,
-					g->second.TexCoordBotRight.y,
-
-					//topRight
-					g->second.TexCoordBotRight.x,
-					g->second.TexCoordTopLeft.y
-				};
-				quad.Colour = colour;
+			const GlyphData* g = bitmap.getGlyph(charId);
+			if (g != nullptr) {
+				float penX = currentPos.x;
+				if (kerning && lastCharId != 0) {
+					penX += bitmap.getKerning(lastCharId, charId) * scale;
+				}
 
-				lastCharId = charId;
+				const float advanceScaled = g->AdvanceX * scale;
+
+				//Wrap when this glyph would overflow the line, a glyph wider than a whole line is left to overflow on its own
+				if (wrap && penX + advanceScaled - rootPos.x > bounds.MaxWidth && lineEndX > rootPos.x) {
+					if (hasWrapPoint) {
+						//Carry the word after the wrap point down to the start of the next line
+						const float carryOffsetX = rootPos.x - wrapPointX;
+						for (size_t q = wrapPointQuad; q < quads.size(); q++) {
+							quads[q].Position.x += carryOffsetX;
+							quads[q].Position.y -= lineHeightScaled;
+						}
+
+						const float carriedLineEndX = lineEndX > wrapPointX ? lineEndX + carryOffsetX : rootPos.x;
+						lineEndX = wrapPointLineEndX;
+						lineStartQuad = finishLine(wrapPointQuad);
+						lineEndX = carriedLineEndX;
+						currentPos.x += carryOffsetX;
+						penX += carryOffsetX;
+					} else {
+						//No space to wrap at, break the word before this glyph
+						lineStartQuad = finishLine(quads.size());
+						lineEndX = rootPos.x;
+						currentPos.x = rootPos.x;
+						penX = rootPos.x;
+					}
+
+					currentPos.y -= lineHeightScaled;
+					hasWrapPoint = false;
+					lineVisible = !clip || isLineInClip(currentPos.y);
+				}
+
+				if (lineVisible) {
+					const float glyphHeightScaled = g->Size.y * scale;
+
+					//Constructed in place to avoid copying each quad into the array
+					Quad& quad = quads.emplace_back();
+					quad.Position = {
+						penX + (g->Offset.x * scale),
+						currentPos.y - glyphHeightScaled + baseNormScaled + (g->Offset.y * scale),
+						currentPos.z
+					};
+					quad.Size = {
+						g->Size.x * scale,
+						glyphHeightScaled
+					};
+					quad.TextureCoords = {
+						//botLeft
+						g->TexCoordTopLeft.x,
+						g->TexCoordBotRight.y,
 
-				quad.setTexture(*bitmap.getPageTexture(g->second.PageId));
-				quads.emplace_back(quad);
+						//topRight
+						g->TexCoordBotRight.x,
+						g->TexCoordTopLeft.y
+					};
+					quad.Colour = colour;
+					quad.setTexture(*bitmap.getPageTexture(g->PageId));
+				}
 
-				currentPos.x += g->second.AdvanceX * scale;
+				lastCharId = charId;
+
+				currentPos.x = penX + advanceScaled;
+				lineEndX = currentPos.x;
 
 			} else {
-				LOG_WARN("Failed to find charId: " << charId << " in bitmap");
+				//Counted and logged once after layout so text in an unsupported script doesn't log per character
+				if (missingCharCount == 0) {
+					firstMissingCharId = charId;
+				}
+				missingCharCount++;
+				lastCharId = 0;
 			}
 		}
 
-		return quads;
+		finishLine(quads.size());
+
+		if (missingCharCount > 0 && !hasTextFlag(flags, ETextFlags2d::IGNORE_MISSING_GLYPHS)) {
+			LOG_WARN("Failed to find " << missingCharCount << " chars in bitmap, first charId: " << firstMissingCharId);
+		}
+
+		return quads.size() - startQuadCount;
+	}
+
+	bool TextString::clipQuad(Quad& quad, const glm::vec2& clipBotLeft, const glm::vec2& clipTopRight) {
+		const float left = quad.Position.x;
+		const float bottom = quad.Position.y;
+		const float right = left + quad.Size.x;
+		const float top = bottom + quad.Size.y;
+
+		if (right <= clipBotLeft.x || left >= clipTopRight.x || top <= clipBotLeft.y || bottom >= clipTopRight.y) {
+			return false;
+		} else if (left >= clipBotLeft.x && right <= clipTopRight.x && bottom >= clipBotLeft.y && top <= clipTopRight.y) {
+			return true;
+		} else if (quad.Size.x == 0.0f || quad.Size.y == 0.0f) {
+			//Nothing would be drawn and the texture coords can't be rescaled without dividing by zero
+			return false;
+		}
+
+		const float croppedLeft = std::max(left, clipBotLeft.x);
+		const float croppedRight = std::min(right, clipTopRight.x);
+		const float croppedBottom = std::max(bottom, clipBotLeft.y);
+		const float croppedTop = std::min(top, clipTopRight.y);
+
+		//Texture coords are cropped by the same proportion as the quad
+		const float texCoordsPerX = (quad.TextureCoords[2] - quad.TextureCoords[0]) / quad.Size.x;
+		const float texCoordsPerY = (quad.TextureCoords[3] - quad.TextureCoords[1]) / quad.Size.y;
+		quad.TextureCoords = {
+			quad.TextureCoords[0] + ((croppedLeft - left) * texCoordsPerX),
+			quad.TextureCoords[1] + ((croppedBottom - bottom) * texCoordsPerY),
+			quad.TextureCoords[0] + ((croppedRight - left) * texCoordsPerX),
+			quad.TextureCoords[1] + ((croppedTop - bottom) * texCoordsPerY)
+		};
+		quad.Position.x = croppedLeft;
+		quad.Position.y = croppedBottom;
+		quad.Size = { croppedRight - croppedLeft, croppedTop - croppedBottom };
+
+		return true;
 	}
 }
@@ -4,27 +4,73 @@
 #include "dough/scene/geometry/primitives/Quad.h"
 #include "dough/rendering/text/FontBitmap.h"
 #include "dough/rendering/text/ETextFlags.h"
+#include "dough/rendering/text/TextLayoutBounds2d.h"
+#include "dough/scene/camera/ViewFrustum.h"
 
 namespace DOH {
 
+	//Bounds of a line's quads, lines are contiguous in TextString::getQuads() from QuadStart up to QuadEnd.
+	struct TextLineBounds {
+		AxisAlignedBounds3d Bounds;
+		uint32_t QuadStart;
+		uint32_t QuadEnd;
+	};
+
 	//TODO:: keep this as AGeometry or make a "ACollection" that extends AGeometry
 	class TextString : public AGeometry {
+		friend class TextRenderer;
+
 	private:
 		std::vector<Quad> mStringQuads;
 		const char* mString;
 		FontBitmap& mFontBitmap;
 		float mScale;
 		glm::vec4 mColour;
+		ETextFlags2d mFlags;
+		TextLayoutBounds2d mLayoutBounds;
+
+		//Static strings are kept on the GPU by TextRenderer and only re-uploaded when mGpuDirty, see setStatic().
+		bool mStatic;
+		bool mGpuDirty;
+		//TextRenderer's id for this string's GPU data, 0 when it has none.
+		uint32_t mRetainedId;
+
+		//Bounds of every quad, and of each line when there are at least LINE_BOUNDS_MIN_QUAD_COUNT quads,
+		// used by TextRenderer to cull scene strings out of view. Moved with the quads on setRoot.
+		AxisAlignedBounds3d mBounds;
+		std::vector<TextLineBounds> mLineBounds;
 
 	public:
+		constexpr static const uint32_t UTF8_REPLACEMENT_CHARACTER = 0xFFFD;
+		//Shorter strings are only culled as a whole.
+		constexpr static const size_t LINE_BOUNDS_MIN_QUAD_COUNT = 64;
+
 		TextString(const char* string, FontBitmap& fontBitmap, const float scale = 1.0f);
 		TextString(const TextString& copy) = delete;
 		TextString& operator=(const TextString& assignment) = delete;
+		~TextString();
 
 		void setString(const char* string);
 		void setRoot(glm::vec3 root);
 		void setScale(const float scale);
 		void setColour(const glm::vec4& colourRgba);
+		void setFlags(const ETextFlags2d flags);
+		/**
+		* Wrap, and/or clip the string to bounds. Bounds are relative to the root, so moving the string moves its bounds.
+		* A clipped string is laid out again on setRoot as only the visible glyphs have quads.
+		*/
+		void setLayoutBounds(const TextLayoutBounds2d& bounds);
+		/**
+		* Static strings have their vertices uploaded once to a GPU buffer owned by TextRenderer and are drawn from that every frame,
+		* instead of being added to a text batch. The buffer is only re-uploaded after setString, setRoot, setScale or setColour.
+		* Best for text that rarely changes, e.g. labels.
+		*
+		* IMPORTANT:: Changing quads directly through getQuads() or Position doesn't mark the string as changed, call markGpuDirty() after.
+		*/
+		void setStatic(const bool isStatic);
+		inline void markGpuDirty() { mGpuDirty = true; }
+		//Re-calculate the bounds used for culling, only needed after changing quads directly through getQuads().
+		void updateBounds();
 		//void setFontBitmap(const FontBitmap& fontBitmap);
 
 		inline std::vector<Quad>& getQuads() { return mStringQuads; }
@@ -32,7 +78,15 @@ namespace DOH {
 		inline const FontBitmap& getCurrentFontBitmap() const { return mFontBitmap; }
 		inline float getScale() const { return mScale; }
 		inline const glm::vec4& getColour() const { return mColour; }
+		inline ETextFlags2d getFlags() const { return mFlags; }
+		inline const TextLayoutBounds2d& getLayoutBounds() const { return mLayoutBounds; }
+		//Length in bytes, multi-byte UTF-8 characters count as more than one.
 		inline size_t getLength() const { return strlen(mString); }
+		inline bool isStatic() const { return mStatic; }
+		inline bool isGpuDirty() const { return mGpuDirty; }
+		inline const AxisAlignedBounds3d& getBounds() const { return mBounds; }
+		//Empty for strings shorter than LINE_BOUNDS_MIN_QUAD_COUNT quads.
+		inline const std::vector<TextLineBounds>& getLineBounds() const { return mLineBounds; }
 
 		static inline std::vector<Quad> getStringAsQuads(
 			const char* string,
@@ -43,6 +97,8 @@ namespace DOH {
 		) {
 			return TextString::getStringAsQuads(string, bitmap, { 0.0f, 0.0f, 0.0f }, scale, colour, flags);
 		}
+		//Laid out through TextRenderer's glyph run cache, repeated strings are translated from the cached run instead of laid out again.
+		//Alignment flags are applied, for wrapping or clipping use appendStringAsQuads with TextLayoutBounds2d.
 		static std::vector<Quad> getStringAsQuads(
 			const char* string,
 			const FontBitmap& bitmap,
@@ -51,5 +107,96 @@ namespace DOH {
 			const glm::vec4& colour = { 1.0f, 1.0f, 1.0f, 1.0f },
 			const ETextFlags2d flags = ETextFlags2d::NONE
 		);
+		/**
+		* Decode the UTF-8 character starting at string[index] and move index past it.
+		* Malformed or truncated sequences, overlong encodings and surrogates decode as U+FFFD and advance index by one byte.
+		*/
+		static inline uint32_t decodeUtf8(const char* string, const size_t length, size_t& index) {
+			const unsigned char lead = static_cast<unsigned char>(string[index]);
+			if (lead < 0x80) {
+				index++;
+				return lead;
+			}
+
+			size_t continuationCount;
+			uint32_t codepoint;
+			uint32_t minCodepoint;
+			if ((lead & 0xE0) == 0xC0) {
+				continuationCount = 1;
+				codepoint = lead & 0x1F;
+				minCodepoint = 0x80;
+			} else if ((lead & 0xF0) == 0xE0) {
+				continuationCount = 2;
+				codepoint = lead & 0x0F;
+				minCodepoint = 0x800;
+			} else if ((lead & 0xF8) == 0xF0) {
+				continuationCount = 3;
+				codepoint = lead & 0x07;
+				minCodepoint = 0x10000;
+			} else {
+				index++;
+				return TextString::UTF8_REPLACEMENT_CHARACTER;
+			}
+
+			if (index + continuationCount >= length) {
+				index++;
+				return TextString::UTF8_REPLACEMENT_CHARACTER;
+			}
+
+			for (size_t i = 1; i <= continuationCount; i++) {
+				const unsigned char continuation = static_cast<unsigned char>(string[index + i]);
+				if ((continuation & 0xC0) != 0x80) {
+					index++;
+					return TextString::UTF8_REPLACEMENT_CHARACTER;
+				}
+				codepoint = (codepoint << 6) | (continuation & 0x3F);
+			}
+
+			if (codepoint < minCodepoint || codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF)) {
+				index++;
+				return TextString::UTF8_REPLACEMENT_CHARACTER;
+			}
+
+			index += continuationCount + 1;
+			return codepoint;
+		}
+
+		/**
+		* Lay out string and append a quad for each glyph to quads, returns the number of quads appended.
+		* Prefer this over getStringAsQuads when laying out strings often, reusing quads (e.g. clear() then append) avoids allocating per string.
+		* string is decoded as UTF-8 and the font's kerning pairs are applied unless flags has ETextFlags2d::NO_KERNING.
+		*/
+		static size_t appendStringAsQuads(
+			std::vector<Quad>& quads,
+			const char* string,
+			const FontBitmap& bitmap,
+			const glm::vec3 rootPos,
+			const float scale = 1.0f,
+			const glm::vec4& colour = { 1.0f, 1.0f, 1.0f, 1.0f },
+			const ETextFlags2d flags = ETextFlags2d::NONE
+		);
+		/**
+		* Same as above but wraps, aligns and clips each line in the same pass the glyphs are positioned in, see TextLayoutBounds2d.
+		* Glyphs outside the clip rect are culled before they get a quad and lines outside it aren't laid out, when not wrapping
+		* they aren't even decoded. So a clipped view of a long string, e.g. a scrolling log, only pays for its visible lines.
+		* Bounds are in the same space as rootPos, not relative to it.
+		*/
+		static size_t appendStringAsQuads(
+			std::vector<Quad>& quads,
+			const char* string,
+			const FontBitmap& bitmap,
+			const glm::vec3 rootPos,
+			const TextLayoutBounds2d& bounds,
+			const float scale = 1.0f,
+			const glm::vec4& colour = { 1.0f, 1.0f, 1.0f, 1.0f },
+			const ETextFlags2d flags = ETextFlags2d::NONE
+		);
+
+	private:
+		//Lay out mString again from scratch, re-using mStringQuads' allocation.
+		void relayout();
+		//Crop quad to the rect, adjusting its texture coords to match. Returns false if quad is entirely outside of it,
+		//or has zero width or height and crosses its edge.
+		static bool clipQuad(Quad& quad, const glm::vec2& clipBotLeft, const glm::vec2& clipTopRight);
 	};
 }
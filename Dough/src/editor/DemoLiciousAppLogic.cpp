@@ -6,10 +6,16 @@
 #include "dough/rendering/ShapeRenderer.h"
 #include "dough/rendering/text/TextRenderer.h"
 #include "dough/files/readers/JsonFileReader.h"
+#include "dough/files/JsonDocument.h"
+#include "dough/files/readers/JsonStreamReader.h"
+#include "dough/files/writers/JsonStreamWriter.h"
 #include "dough/input/InputCodes.h"
 
 #include <tracy/public/tracy/Tracy.hpp>
 
+#include <filesystem>
+#include <sstream>
+
 #define GET_RENDERER Application::get().getRenderer()
 
 namespace DOH::EDITOR {
@@ -446,9 +452,12 @@ namespace DOH::EDITOR {
 
 		RenderingContextVulkan& context = GET_RENDERER.getContext();
 
+		//Read on worker threads so init doesn't wait on them, the models are uploaded in update as they finish
+		LoadedModels.resize(ObjModelFilePaths.size());
 		for (const auto& filePath : ObjModelFilePaths) {
-			LoadedModels.emplace_back(ModelVulkan::createModel(filePath, ColouredVertexInputLayout));
+			ModelLoads.emplace_back(ResourceHandler::loadObjModelAsync(filePath, ColouredVertexInputLayout));
 		}
+		TexturedModelLoad = ResourceHandler::loadObjModelAsync("Dough/Dough/res/models/textured_cube.obj", TexturedVertexInputLayout);
 
 		const std::vector<VkDescriptorSet>& perspSceneCameraDescSets = SharedResources.PerspectiveSceneCamera->getGpuData()->DescriptorSets;
 
@@ -475,13 +484,8 @@ namespace DOH::EDITOR {
 					1.0f
 				);
 				transform->updateTranslationMatrix();
-				
-				RenderableObjects.emplace_back(std::make_shared<RenderableModelVulkan>(
-					ObjModelFilePaths[modelIndex],
-					LoadedModels[modelIndex],
-					transform,
-					SceneDescSetsInstance
-				));
+
+				addObject(modelIndex, transform);
 			}
 		}
 
@@ -523,11 +527,9 @@ namespace DOH::EDITOR {
 		ScenePipelineConveyor = context.createPipelineInCurrentRenderState(ScenePipelineName, *ScenePipelineInfo);
 		WireframePipelineConveyor = context.createPipelineInCurrentRenderState(SceneWireframePipelineName, *SceneWireframePipelineInfo);
 
-		TexturedModel = ModelVulkan::createModel("Dough/Dough/res/models/textured_cube.obj", TexturedVertexInputLayout);
 		TexturedModelDescriptorSets = std::make_shared<DescriptorSetsInstanceVulkan>(2);
 		TexturedModelDescriptorSets->setDescriptorSetArray(0, { perspSceneCameraDescSets[0], perspSceneCameraDescSets[1] }); //Camera UBO
 		TexturedModelDescriptorSets->setDescriptorSetSingle(1, SharedResources.TestTexture1DescSet);
-		RenderableTexturedModel = std::make_shared<RenderableModelVulkan>("TexturedObjModel", TexturedModel, TexturedModelDescriptorSets);
 
 		GpuResourcesLoaded = true;
 	}
@@ -537,12 +539,22 @@ namespace DOH::EDITOR {
 
 		RendererVulkan& renderer = GET_RENDERER;
 		for (const auto& model : LoadedModels) {
-			renderer.closeGpuResource(model);
+			if (model != nullptr) {
+				renderer.closeGpuResource(model);
+			}
 		}
 
-		renderer.closeGpuResource(TexturedModel);
+		if (TexturedModel != nullptr) {
+			renderer.closeGpuResource(TexturedModel);
+		}
+		//Loads still running are left to finish on their own, their results are discarded
+		ModelLoads.clear();
+		TexturedModelLoad = {};
+		PendingObjects.clear();
 		LoadedModels.clear();
 		RenderableObjects.clear();
+		TexturedModel.reset();
+		RenderableTexturedModel.reset();
 		renderer.closeGpuResource(SceneVertexShader);
 		renderer.closeGpuResource(SceneFragmentShader);
 
@@ -554,6 +566,10 @@ namespace DOH::EDITOR {
 	}
 
 	void DemoLiciousAppLogic::ObjModelsDemo::update(float delta) {
+		if (GpuResourcesLoaded) {
+			updateModelLoads();
+		}
+
 		//NOTE:: Obj models aren't updated per Update cycle, done during ImGui render stage, as currently only the ImGui
 		// UI has control over the transform data. And recalculating x number of object's transformation is a lot of wasted
 		// work.
@@ -582,7 +598,7 @@ namespace DOH::EDITOR {
 				}
 			}
 		
-			if (SharedResources.TexturedConveyor.isValid() && RenderableTexturedModel->Render) {
+			if (SharedResources.TexturedConveyor.isValid() && RenderableTexturedModel != nullptr && RenderableTexturedModel->Render) {
 				SharedResources.TexturedConveyor.addRenderable(RenderableTexturedModel);
 			}
 		}
@@ -607,7 +623,17 @@ namespace DOH::EDITOR {
 
 		ImGui::Checkbox("Render", &Render);
 		ImGui::Checkbox("Update", &Update);
+		if (!ModelLoads.empty() || TexturedModelLoad.valid()) {
+			int loadingCount = TexturedModelLoad.valid() ? 1 : 0;
+			for (const auto& load : ModelLoads) {
+				loadingCount += load.valid() ? 1 : 0;
+			}
+			ImGui::Text("Loading Models: %i", loadingCount);
+		}
 		ImGui::Text("Object Count: %i", RenderableObjects.size());
+		if (!PendingObjects.empty()) {
+			ImGui::Text("Objects Waiting On Their Model: %i", static_cast<int>(PendingObjects.size()));
+		}
 		if (ImGui::InputInt(addLabel.c_str(), &AddNewObjectsCount, 5, 5)) {
 			if (AddNewObjectsCount < 0) {
 				AddNewObjectsCount = 0;
@@ -639,11 +665,38 @@ namespace DOH::EDITOR {
 		ImGui::Checkbox("Display Renderable Models List", &RenderObjModelsList);
 		if (ImGui::Button("Clear Objects")) {
 			RenderableObjects.clear();
+			PendingObjects.clear();
 		}
 
-		ImGui::Checkbox("Render Textured Model", &RenderableTexturedModel->Render);
+		if (RenderableTexturedModel != nullptr) {
+			ImGui::Checkbox("Render Textured Model", &RenderableTexturedModel->Render);
+		}
 		//TODO:: TexturedModel Wireframe rendering not currently supported
 		//ImGui::Checkbox("Render Wireframe Textured Model", &mObjModelsDemo->RenderableTexturedModel->RenderWireframe);
+
+		ImGui::Text("Load Benchmark:");
+		if (ImGui::InputInt("Load Count", &LoadBenchmarkCount, 8, 32)) {
+			LoadBenchmarkCount = std::clamp(LoadBenchmarkCount, 1, 1024);
+		}
+		if (ImGui::Button("Run Load Benchmark")) {
+			runLoadBenchmark();
+		}
+		EditorGui::displayHelpTooltip("Load the test texture and each obj model Load Count times, one after another on this thread then all at once on the async loader's worker threads. Obj models are also loaded one after another without their cooked mesh. Blocks until finished.");
+		ImGui::Text("Async Loader Threads: %u", ResourceHandler::getAsyncLoader().getThreadCount());
+		for (const LoadBenchmarkResult& result : LoadBenchmarkResults) {
+			ImGui::Text(
+				"%s x%u: Serial %fms, Parallel %fms (%.2fx)",
+				result.Name.c_str(),
+				result.Count,
+				result.SerialMillis,
+				result.ParallelMillis,
+				result.ParallelMillis > 0.0 ? result.SerialMillis / result.ParallelMillis : 0.0
+			);
+			if (result.UncookedSerialMillis > 0.0) {
+				ImGui::SameLine();
+				ImGui::Text("Serial Uncooked %fms", result.UncookedSerialMillis);
+			}
+		}
 	}
 
 	void DemoLiciousAppLogic::ObjModelsDemo::renderImGuiExtras() {
@@ -713,7 +766,16 @@ namespace DOH::EDITOR {
 			scale
 		);
 		transform->updateTranslationMatrix();
-	
+
+		addObject(modelIndex, transform);
+	}
+
+	void DemoLiciousAppLogic::ObjModelsDemo::addObject(const uint32_t modelIndex, std::shared_ptr<TransformationData> transform) {
+		if (LoadedModels[modelIndex] == nullptr) {
+			PendingObjects.push_back({ modelIndex, transform });
+			return;
+		}
+
 		RenderableObjects.emplace_back(std::make_shared<RenderableModelVulkan>(
 			ObjModelFilePaths[modelIndex],
 			LoadedModels[modelIndex],
@@ -722,6 +784,120 @@ namespace DOH::EDITOR {
 		));
 	}
 
+	void DemoLiciousAppLogic::ObjModelsDemo::updateModelLoads() {
+		ZoneScoped;
+
+		if (ModelLoads.empty() && !TexturedModelLoad.valid()) {
+			return;
+		}
+
+		//Loads are in the same order as ObjModelFilePaths, ones already taken are left invalid until all have finished
+		bool modelLoaded = false;
+		bool allFinished = true;
+		for (size_t i = 0; i < ModelLoads.size(); i++) {
+			auto& load = ModelLoads[i];
+			if (!load.valid()) {
+				continue;
+			} else if (load.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+				allFinished = false;
+				continue;
+			}
+
+			LoadedModels[i] = std::make_shared<ModelVulkan>(load.get());
+			modelLoaded = true;
+		}
+		if (allFinished) {
+			ModelLoads.clear();
+		}
+
+		if (modelLoaded) {
+			std::vector<PendingObject> pendingObjects = std::move(PendingObjects);
+			PendingObjects.clear();
+			for (PendingObject& object : pendingObjects) {
+				addObject(object.ModelIndex, object.Transformation);
+			}
+		}
+
+		if (TexturedModelLoad.valid() && TexturedModelLoad.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+			TexturedModel = std::make_shared<ModelVulkan>(TexturedModelLoad.get());
+			RenderableTexturedModel = std::make_shared<RenderableModelVulkan>("TexturedObjModel", TexturedModel, TexturedModelDescriptorSets);
+		}
+	}
+
+	void DemoLiciousAppLogic::ObjModelsDemo::runLoadBenchmark() {
+		ZoneScoped;
+
+		LoadBenchmarkResults.clear();
+		const uint32_t count = static_cast<uint32_t>(LoadBenchmarkCount);
+
+		{
+			LoadBenchmarkResult& result = LoadBenchmarkResults.emplace_back();
+			result.Name = SharedResources.TestTexturePath;
+			result.Count = count;
+
+			double start = Time::getCurrentTimeMillis();
+			for (uint32_t i = 0; i < count; i++) {
+				TextureCreationData textureData = ResourceHandler::loadTexture(SharedResources.TestTexturePath, false);
+				if (!textureData.Failed) {
+					ResourceHandler::freeTexture(textureData);
+				}
+			}
+			result.UncookedSerialMillis = Time::getCurrentTimeMillis() - start;
+
+			start = Time::getCurrentTimeMillis();
+			for (uint32_t i = 0; i < count; i++) {
+				TextureCreationData textureData = ResourceHandler::loadTexture(SharedResources.TestTexturePath);
+				if (!textureData.Failed) {
+					ResourceHandler::freeTexture(textureData);
+				}
+			}
+			result.SerialMillis = Time::getCurrentTimeMillis() - start;
+
+			start = Time::getCurrentTimeMillis();
+			std::vector<std::future<TextureCreationData>> loads;
+			loads.reserve(count);
+			for (uint32_t i = 0; i < count; i++) {
+				loads.emplace_back(ResourceHandler::loadTextureAsync(SharedResources.TestTexturePath));
+			}
+			for (auto& load : loads) {
+				TextureCreationData textureData = load.get();
+				if (!textureData.Failed) {
+					ResourceHandler::freeTexture(textureData);
+				}
+			}
+			result.ParallelMillis = Time::getCurrentTimeMillis() - start;
+		}
+
+		for (const char* filePath : ObjModelFilePaths) {
+			LoadBenchmarkResult& result = LoadBenchmarkResults.emplace_back();
+			result.Name = filePath;
+			result.Count = count;
+
+			double start = Time::getCurrentTimeMillis();
+			for (uint32_t i = 0; i < count; i++) {
+				ResourceHandler::loadObjModel(filePath, ColouredVertexInputLayout, false);
+			}
+			result.UncookedSerialMillis = Time::getCurrentTimeMillis() - start;
+
+			start = Time::getCurrentTimeMillis();
+			for (uint32_t i = 0; i < count; i++) {
+				ResourceHandler::loadObjModel(filePath, ColouredVertexInputLayout);
+			}
+			result.SerialMillis = Time::getCurrentTimeMillis() - start;
+
+			start = Time::getCurrentTimeMillis();
+			std::vector<std::future<std::shared_ptr<Model3dCreationData>>> loads;
+			loads.reserve(count);
+			for (uint32_t i = 0; i < count; i++) {
+				loads.emplace_back(ResourceHandler::loadObjModelAsync(filePath, ColouredVertexInputLayout));
+			}
+			for (auto& load : loads) {
+				load.get();
+			}
+			result.ParallelMillis = Time::getCurrentTimeMillis() - start;
+		}
+	}
+
 	void DemoLiciousAppLogic::ObjModelsDemo::imGuiDrawObjDemoItem(DOH::RenderableModelVulkan& model, const std::string& uniqueImGuiId) {
 		ZoneScoped;
 
@@ -734,6 +910,11 @@ namespace DOH::EDITOR {
 
 				std::string label = filePath + uniqueImGuiId;
 
+				//Models still loading can't be picked yet
+				if (LoadedModels[modelFilePathIndex] == nullptr) {
+					continue;
+				}
+
 				if (ImGui::Selectable(label.c_str(), &selected)) {
 					model.Model = LoadedModels[modelFilePathIndex];
 					model.Name = ObjModelFilePaths[modelFilePathIndex];
@@ -932,8 +1113,8 @@ namespace DOH::EDITOR {
 	void DemoLiciousAppLogic::ShapesDemo::GridDemo::init() {
 		ZoneScoped;
 
-		//NOTE:: Arbitrary limit that doesn't take into account whether any other demo is rendering quads.
-		TestGridMaxQuadCount = EBatchSizeLimits::QUAD_MAX_BATCH_COUNT * EBatchSizeLimits::QUAD_BATCH_MAX_GEO_COUNT;
+		//NOTE:: Arbitrary limit to keep the demo responsive, the ShapeRenderer batch pools grow as needed so there is no renderer limit.
+		TestGridMaxQuadCount = 100 * EBatchSizeLimits::QUAD_BATCH_MAX_GEO_COUNT;
 	}
 
 	void DemoLiciousAppLogic::ShapesDemo::GridDemo::close() {
@@ -1045,6 +1226,11 @@ namespace DOH::EDITOR {
 
 		BouncingQuads.clear();
 		BouncingQuadVelocities.clear();
+
+		for (std::shared_ptr<TextureVulkan>& texture : TexturedSubmitBenchmarkTextures) {
+			GET_RENDERER.closeGpuResource(texture);
+		}
+		TexturedSubmitBenchmarkTextures.clear();
 	}
 
 	void DemoLiciousAppLogic::ShapesDemo::BouncingQuadDemo::update(float delta) {
@@ -1070,11 +1256,17 @@ namespace DOH::EDITOR {
 
 	void DemoLiciousAppLogic::ShapesDemo::BouncingQuadDemo::render() {
 		if (Render) {
+			const double preSubmit = Time::getCurrentTimeMillis();
+
 			if (QuadDrawColour) {
 				ShapeRenderer::drawQuadArrayScene(BouncingQuads);
 			} else {
 				ShapeRenderer::drawQuadArraySameTextureScene(BouncingQuads);
 			}
+
+			if (BenchmarkRunning) {
+				updatePathBenchmark(Time::getCurrentTimeMillis() - preSubmit);
+			}
 		}
 
 	}
@@ -1110,6 +1302,60 @@ namespace DOH::EDITOR {
 		if (ImGui::Button("Clear Quads")) {
 			BouncingQuads.clear();
 		}
+
+		ImGui::Text("Quad Path Benchmark:");
+		if (BenchmarkRunning) {
+			ImGui::Text(
+				"Running %s path: frame %i of %i",
+				BenchmarkInstancedPhase ? "Instanced" : "Vertex",
+				BenchmarkFrame,
+				BenchmarkFramesPerPath
+			);
+		} else {
+			if (ImGui::InputInt("Frames Per Path", &BenchmarkFramesPerPath, 10, 100)) {
+				if (BenchmarkFramesPerPath < 10) {
+					BenchmarkFramesPerPath = 10;
+				}
+			}
+			if (ImGui::Button("Run Quad Path Benchmark")) {
+				startPathBenchmark();
+			}
+		}
+		ImGui::Text(
+			"Vertex:    submit %fms render %fms upload %fMB/frame (%i frames)",
+			BenchmarkVertexResult.getAvgSubmitMillis(),
+			BenchmarkVertexResult.getAvgRenderMillis(),
+			BenchmarkVertexResult.getAvgUploadMegaBytes(),
+			BenchmarkVertexResult.FrameCount
+		);
+		ImGui::Text(
+			"Instanced: submit %fms render %fms upload %fMB/frame (%i frames)",
+			BenchmarkInstancedResult.getAvgSubmitMillis(),
+			BenchmarkInstancedResult.getAvgRenderMillis(),
+			BenchmarkInstancedResult.getAvgUploadMegaBytes(),
+			BenchmarkInstancedResult.FrameCount
+		);
+
+		ImGui::Text(
+			"Textured Submit Benchmark: %i quads, %i textures",
+			TexturedSubmitBenchmarkQuadCount,
+			TexturedSubmitBenchmarkTextureCount
+		);
+		if (ImGui::Button("Run Textured Submit Benchmark")) {
+			runTexturedSubmitBenchmark();
+		}
+		EditorGui::displayHelpTooltip("Submits quads one at a time through a batch pool and texture slot lookup, the same as ShapeRenderer::drawQuadTextured*. Nothing is drawn.");
+		ImGui::Text(
+			"Vertex:    %fms (%fns per quad)",
+			TexturedSubmitVertexMillis,
+			TexturedSubmitVertexMillis * 1000000.0 / TexturedSubmitBenchmarkQuadCount
+		);
+		ImGui::Text(
+			"Instanced: %fms (%fns per quad)",
+			TexturedSubmitInstancedMillis,
+			TexturedSubmitInstancedMillis * 1000000.0 / TexturedSubmitBenchmarkQuadCount
+		);
+		ImGui::Text("Batches used: %i", TexturedSubmitBatchCount);
 	}
 
 	void DemoLiciousAppLogic::ShapesDemo::BouncingQuadDemo::renderImGuiExtras() {
@@ -1191,6 +1437,119 @@ namespace DOH::EDITOR {
 		}
 	}
 
+	void DemoLiciousAppLogic::ShapesDemo::BouncingQuadDemo::startPathBenchmark() {
+		ZoneScoped;
+
+		BenchmarkVertexResult = {};
+		BenchmarkInstancedResult = {};
+		BenchmarkFrame = 0;
+		BenchmarkInstancedPhase = false;
+		BenchmarkRunning = true;
+		InstancingBeforeBenchmark = ShapeRenderer::isQuadInstancingEnabled();
+
+		//Benchmark relies on render() being called each frame
+		Render = true;
+		ShapeRenderer::setQuadInstancingEnabled(false);
+	}
+
+	void DemoLiciousAppLogic::ShapesDemo::BouncingQuadDemo::updatePathBenchmark(double submitMillis) {
+		ZoneScoped;
+
+		QuadPathBenchmarkResult& result = BenchmarkInstancedPhase ? BenchmarkInstancedResult : BenchmarkVertexResult;
+		const size_t bytesPerQuad = BenchmarkInstancedPhase ? VertexQuadInstance3d::BYTE_SIZE : Quad::BYTE_SIZE;
+
+		result.TotalSubmitMillis += submitMillis;
+		result.TotalUploadBytes += BouncingQuads.size() * bytesPerQuad;
+		//LastRenderTimeMillis is from the previous frame, skip the first frame of a phase as it was rendered with the other path.
+		if (BenchmarkFrame > 0) {
+			result.TotalRenderMillis += Application::get().getDebugInfo().LastRenderTimeMillis;
+		}
+		result.FrameCount++;
+		BenchmarkFrame++;
+
+		if (BenchmarkFrame >= BenchmarkFramesPerPath) {
+			if (BenchmarkInstancedPhase) {
+				BenchmarkRunning = false;
+				ShapeRenderer::setQuadInstancingEnabled(InstancingBeforeBenchmark);
+			} else {
+				BenchmarkInstancedPhase = true;
+				ShapeRenderer::setQuadInstancingEnabled(true);
+			}
+			BenchmarkFrame = 0;
+		}
+	}
+
+	void DemoLiciousAppLogic::ShapesDemo::BouncingQuadDemo::runTexturedSubmitBenchmark() {
+		ZoneScoped;
+
+		if (TexturedSubmitBenchmarkTextures.empty()) {
+			RenderingContextVulkan& context = GET_RENDERER.getContext();
+			for (uint32_t i = 0; i < TexturedSubmitBenchmarkTextureCount; i++) {
+				const float shade = static_cast<float>(i + 1) / TexturedSubmitBenchmarkTextureCount;
+				TexturedSubmitBenchmarkTextures.emplace_back(
+					context.createTexture(shade, 1.0f - shade, 0.5f, 1.0f, true, "Submit Benchmark Texture")
+				);
+			}
+		}
+
+		std::vector<Quad> quads;
+		quads.reserve(TexturedSubmitBenchmarkQuadCount);
+		for (size_t i = 0; i < TexturedSubmitBenchmarkQuadCount; i++) {
+			quads.emplace_back(
+				glm::vec3(static_cast<float>(i % 1000) * 0.01f, static_cast<float>(i / 1000) * 0.01f, 0.5f),
+				QuadSize,
+				glm::vec4(1.0f),
+				0.0f,
+				TexturedSubmitBenchmarkTextures[i % TexturedSubmitBenchmarkTextureCount]
+			);
+		}
+
+		//Benchmark has its own texture array so the benchmark textures don't take up ShapeRenderer's slots
+		TextureArray textureArray(EBatchSizeLimits::BATCH_MAX_COUNT_TEXTURE, *TexturedSubmitBenchmarkTextures[0]);
+
+		{
+			BatchManager<RenderBatchQuad> batches(
+				EBatchSizeLimits::QUAD_BATCH_MAX_GEO_COUNT,
+				Quad::BYTE_SIZE,
+				EBatchSizeLimits::BATCH_MAX_COUNT_TEXTURE,
+				nullptr,
+				nullptr,
+				nullptr
+			);
+
+			const double start = Time::getCurrentTimeMillis();
+			for (const Quad& quad : quads) {
+				batches.add(quad, textureArray.addNewTexture(quad.getTexture()));
+			}
+			TexturedSubmitVertexMillis = Time::getCurrentTimeMillis() - start;
+			TexturedSubmitBatchCount = batches.getUsedBatchCount();
+			batches.endFrame();
+		}
+
+		{
+			BatchManager<RenderBatchQuadInstanced> batches(
+				EBatchSizeLimits::QUAD_BATCH_MAX_GEO_COUNT,
+				VertexQuadInstance3d::BYTE_SIZE,
+				EBatchSizeLimits::BATCH_MAX_COUNT_TEXTURE,
+				nullptr,
+				nullptr,
+				nullptr
+			);
+
+			const double start = Time::getCurrentTimeMillis();
+			for (const Quad& quad : quads) {
+				batches.add(quad, textureArray.addNewTexture(quad.getTexture()));
+			}
+			TexturedSubmitInstancedMillis = Time::getCurrentTimeMillis() - start;
+			batches.endFrame();
+		}
+
+		LOG_INFO(
+			"Textured submit benchmark: " << TexturedSubmitBenchmarkQuadCount << " quads across " << TexturedSubmitBenchmarkTextureCount <<
+			" textures. Vertex: " << TexturedSubmitVertexMillis << "ms Instanced: " << TexturedSubmitInstancedMillis << "ms"
+		);
+	}
+
 	void DemoLiciousAppLogic::ShapesDemo::CircleDemo::init() {
 		ZoneScoped;
 
@@ -1404,13 +1763,8 @@ namespace DOH::EDITOR {
 
 		ImGui::Text("Shapes Batch Renderer Info:");
 		ImGui::Text("Quads Drawn: %i", ShapeRenderer::getDrawnQuadCount());
-		ImGui::Text("Quads Truncated: %i", ShapeRenderer::getTruncatedQuadCount());
 		ImGui::Text("Quad Batch Max Size: %i", EBatchSizeLimits::QUAD_BATCH_MAX_GEO_COUNT);
-		ImGui::Text(
-			"Quad Batch Count: %i of Max %i",
-			ShapeRenderer::getQuadBatchCount(),
-			EBatchSizeLimits::QUAD_MAX_BATCH_COUNT
-		);
+		ImGui::Text("Quad Batch Count: %i", ShapeRenderer::getQuadBatchCount());
 		for (uint32_t i = 0; i < ShapeRenderer::getQuadSceneBatchCount(); i++) {
 			RenderBatchQuad& batch = *ShapeRenderer::getQuadSceneRenderBatches()[i];
 			ImGui::Text("Scene Batch: %i Geo Count: %i", i, batch.getGeometryCount());
@@ -1419,6 +1773,14 @@ namespace DOH::EDITOR {
 			RenderBatchQuad& batch = *ShapeRenderer::getQuadUiRenderBatches()[i];
 			ImGui::Text("UI Batch: %i Geo Count: %i", i, batch.getGeometryCount());
 		}
+		for (size_t i = 0; i < ShapeRenderer::getQuadInstancedSceneRenderBatches().size(); i++) {
+			RenderBatchQuadInstanced& batch = *ShapeRenderer::getQuadInstancedSceneRenderBatches()[i];
+			ImGui::Text("Instanced Scene Batch: %i Geo Count: %i", i, batch.getGeometryCount());
+		}
+		for (size_t i = 0; i < ShapeRenderer::getQuadInstancedUiRenderBatches().size(); i++) {
+			RenderBatchQuadInstanced& batch = *ShapeRenderer::getQuadInstancedUiRenderBatches()[i];
+			ImGui::Text("Instanced UI Batch: %i Geo Count: %i", i, batch.getGeometryCount());
+		}
 		//TODO:: debug info when multiple texture arrays are supported
 		//uint32_t texArrIndex = 0;
 		//for (TextureArray& texArr : renderer.getContext().getRenderer2d().getStorage().getTextureArrays()) {
@@ -1436,11 +1798,11 @@ namespace DOH::EDITOR {
 		if (ImGui::Button("Close All Empty Quad Batches")) {
 			ShapeRenderer::closeEmptyQuadBatches();
 		}
-		EditorGui::displayHelpTooltip("Close Empty Quad Batches. This can help clean-up when 1 or more batches have geo counts of 0. Does not include the TextQuad batch.");
+		EditorGui::displayHelpTooltip("Close Empty Quad Batches. Batch pools shrink on their own after a number of low usage frames, this shrinks them immediately. Does not include the TextQuad batch.");
 		if (ImGui::Button("Close All Empty Circle Batches")) {
 			ShapeRenderer::closeEmptyCircleBatches();
 		}
-		EditorGui::displayHelpTooltip("Close Empty Circle Batches. This can help clean-up when 1 or more batches have geo counts of 0.");
+		EditorGui::displayHelpTooltip("Close Empty Circle Batches. Batch pools shrink on their own after a number of low usage frames, this shrinks them immediately.");
 	}
 
 	void DemoLiciousAppLogic::ShapesDemo::renderImGuiExtras() {
@@ -1475,6 +1837,32 @@ namespace DOH::EDITOR {
 			TextRenderer::getFontBitmap(TextRenderer::ARIAL_MSDF_NAME)
 		);
 
+		//Chat/log-like lines, some long enough to wrap in the log panel
+		const char* logMessages[] = {
+			"Player joined the game",
+			"Checkpoint reached",
+			"Picked up 25 gold",
+			"Quest updated: find the missing caravan somewhere along the northern road before nightfall",
+			"Connection latency: 42ms"
+		};
+		constexpr uint32_t logMessageCount = sizeof(logMessages) / sizeof(logMessages[0]);
+		LogPanelText.clear();
+		LogPanelText.reserve(LogPanelLineCount * 64);
+		char lineBuffer[160];
+		for (uint32_t i = 0; i < LogPanelLineCount; i++) {
+			snprintf(
+				lineBuffer,
+				sizeof(lineBuffer),
+				"[%02u:%02u:%02u] #%u %s\n",
+				(i / 3600) % 24,
+				(i / 60) % 60,
+				i % 60,
+				i,
+				logMessages[i % logMessageCount]
+			);
+			LogPanelText += lineBuffer;
+		}
+
 		TextRenderer::setSceneCameraData(SharedResources.PerspectiveSceneCamera->getGpuData());
 		TextRenderer::setUiCameraData(SharedResources.OrthoUiCamera->getGpuData());
 	}
@@ -1486,6 +1874,8 @@ namespace DOH::EDITOR {
 		MsdfTextScene.release();
 		SoftMaskTextUi.release();
 		MsdfTextUi.release();
+		NameLabels.clear();
+		NameLabelStrings.clear();
 	}
 
 	void DemoLiciousAppLogic::TextDemo::update(float delta) {
@@ -1494,11 +1884,67 @@ namespace DOH::EDITOR {
 
 	void DemoLiciousAppLogic::TextDemo::render() {
 		if (Render) {
+			if (SceneViewCulling) {
+				TextRenderer::setSceneViewCulling(SharedResources.PerspectiveSceneCamera->getProjectionViewMatrix());
+			} else {
+				TextRenderer::disableSceneViewCulling();
+			}
+
+			if (RenderNameLabels) {
+				if (NameLabels.empty()) {
+					createNameLabels();
+				}
+				for (std::unique_ptr<TextString>& label : NameLabels) {
+					TextRenderer::drawTextStringScene(*label);
+				}
+			}
+
 			TextRenderer::drawTextStringScene(*SoftMaskScene);
 			TextRenderer::drawTextStringScene(*MsdfTextScene);
 		
 			TextRenderer::drawTextStringUi(*SoftMaskTextUi);
 			TextRenderer::drawTextStringUi(*MsdfTextUi);
+
+			if (TextRenderer::hasFont(TextDemo::RuntimeFontName)) {
+				const FontBitmap& runtimeFont = TextRenderer::getFontBitmap(TextDemo::RuntimeFontName);
+				RuntimeFontQuads.clear();
+				TextRenderer::appendCachedStringAsQuads(RuntimeFontQuads, "Font loaded at runtime", runtimeFont, { -1.0f, -0.5f, 0.0f }, 0.1f);
+				TextRenderer::drawTextFromQuadsUi(RuntimeFontQuads, runtimeFont);
+			}
+
+			if (RenderLogPanel) {
+				const FontBitmap& bitmap = TextRenderer::getFontBitmap(TextRenderer::ARIAL_SOFT_MASK_NAME);
+				const float lineHeight = bitmap.getLineHeightNorm() * TextDemo::LogPanelScale;
+				const float panelWidth = TextDemo::LogPanelTopRight.x - TextDemo::LogPanelBotLeft.x;
+
+				TextLayoutBounds2d bounds = {};
+				bounds.MaxWidth = LogPanelWrap ? panelWidth : 0.0f;
+				bounds.HasClipRect = true;
+				bounds.ClipBotLeft = TextDemo::LogPanelBotLeft;
+				bounds.ClipTopRight = TextDemo::LogPanelTopRight;
+
+				//Without wrapping lines are aligned around the root, so move it to the aligned edge of the panel
+				const ETextFlags2d alignFlag = LogPanelAlignment == 1 ?
+					ETextFlags2d::ALIGN_CENTRE : (LogPanelAlignment == 2 ? ETextFlags2d::ALIGN_RIGHT : ETextFlags2d::NONE);
+				const float rootX = LogPanelWrap ?
+					TextDemo::LogPanelBotLeft.x : TextDemo::LogPanelBotLeft.x + (panelWidth * 0.5f * static_cast<float>(LogPanelAlignment));
+				const glm::vec3 root = { rootX, TextDemo::LogPanelTopRight.y - lineHeight + (LogPanelScroll * lineHeight), 0.0f };
+
+				LogPanelQuads.clear();
+				const double start = Time::getCurrentTimeMillis();
+				TextString::appendStringAsQuads(
+					LogPanelQuads,
+					LogPanelText.c_str(),
+					bitmap,
+					root,
+					bounds,
+					TextDemo::LogPanelScale,
+					Colour,
+					ETextFlags2d::IGNORE_MISSING_GLYPHS | alignFlag
+				);
+				LogPanelLayoutMillis = Time::getCurrentTimeMillis() - start;
+				TextRenderer::drawTextFromQuadsUi(LogPanelQuads, bitmap);
+			}
 		}
 	}
 
@@ -1508,6 +1954,49 @@ namespace DOH::EDITOR {
 		ImGui::Checkbox("Render", &Render);
 
 		ImGui::Text("Text Batches Geo Count: %i", TextRenderer::getDrawnQuadCount());
+		if (ImGui::Checkbox("Static Strings", &StaticStrings)) {
+			SoftMaskScene->setStatic(StaticStrings);
+			MsdfTextScene->setStatic(StaticStrings);
+			SoftMaskTextUi->setStatic(StaticStrings);
+			MsdfTextUi->setStatic(StaticStrings);
+		}
+		EditorGui::displayHelpTooltip("Static strings are uploaded to the GPU once and only re-uploaded when changed, instead of being batched every frame.");
+
+		if (TextRenderer::isFontBitmapLoading(TextDemo::RuntimeFontName)) {
+			ImGui::Text("Runtime Font: Loading");
+		} else if (TextRenderer::hasFont(TextDemo::RuntimeFontName)) {
+			if (ImGui::Button("Unload Runtime Font")) {
+				TextRenderer::unloadFontBitmap(TextDemo::RuntimeFontName);
+			}
+		} else if (ImGui::Button("Load Runtime Font")) {
+			TextRenderer::loadFontBitmap(
+				TextDemo::RuntimeFontName,
+				"Dough/Dough/res/fonts/arial_latin_32px.fnt",
+				"Dough/Dough/res/fonts/",
+				ETextRenderMethod::SOFT_MASK
+			);
+		}
+		EditorGui::displayHelpTooltip("Fonts can be loaded and unloaded while running, page images are decoded in the background and the font is usable once uploaded.");
+
+		ImGui::Checkbox("Render Name Labels", &RenderNameLabels);
+		EditorGui::displayHelpTooltip("Thousands of scene text labels spread out around the scene, most are out of view at any time.");
+		ImGui::Checkbox("Scene View Culling", &SceneViewCulling);
+		EditorGui::displayHelpTooltip("Skip scene strings outside of the camera's view, long strings partly in view only draw their visible lines.");
+		ImGui::Text("Scene quads culled last frame: %i", TextRenderer::getLastFrameCulledQuadCount());
+
+		ImGui::Checkbox("Render Log Panel", &RenderLogPanel);
+		EditorGui::displayHelpTooltip("Lays out a log of thousands of lines every frame, clipped to a panel so only the visible lines get quads.");
+		if (RenderLogPanel) {
+			ImGui::SliderFloat("Log Panel Scroll", &LogPanelScroll, 0.0f, static_cast<float>(TextDemo::LogPanelLineCount));
+			ImGui::Checkbox("Log Panel Wrap", &LogPanelWrap);
+			ImGui::Combo("Log Panel Alignment", &LogPanelAlignment, "Left\0Centre\0Right\0");
+			ImGui::Text(
+				"Log Panel: %i lines, %i quads, layout %fms",
+				TextDemo::LogPanelLineCount,
+				static_cast<int>(LogPanelQuads.size()),
+				LogPanelLayoutMillis
+			);
+		}
 
 		ImGui::Text("String length limit: %i", TextDemo::StringLengthLimit);
 		EditorGui::displayHelpTooltip(
@@ -1583,12 +2072,268 @@ namespace DOH::EDITOR {
 			MsdfTextUi->setColour(Colour);
 		}
 		EditorGui::displayHelpTooltip("Each individual letter/glyph can be coloured separately, this UI just doesn't currently allow for it.");
+
+		ImGui::Text(
+			"Layout Benchmark: %i strings, %i iterations",
+			LayoutBenchmarkStringCount,
+			LayoutBenchmarkIterations
+		);
+		if (ImGui::Button("Run Text Layout Benchmark")) {
+			runLayoutBenchmark();
+		}
+		EditorGui::displayHelpTooltip("Lays out HUD-like strings (timers, counters & chat) with the Arial soft mask font. Nothing is drawn.");
+		if (LayoutBenchmarkGlyphCount > 0) {
+			const double charCount = static_cast<double>(LayoutBenchmarkCharCount);
+			const double glyphCount = static_cast<double>(LayoutBenchmarkGlyphCount);
+			ImGui::Text(
+				"Lookup Map:   %fms (%.2fM lookups/sec)",
+				LayoutBenchmarkMapLookupMillis,
+				charCount / LayoutBenchmarkMapLookupMillis / 1000.0
+			);
+			ImGui::Text(
+				"Lookup Table: %fms (%.2fM lookups/sec)",
+				LayoutBenchmarkTableLookupMillis,
+				charCount / LayoutBenchmarkTableLookupMillis / 1000.0
+			);
+			ImGui::Text(
+				"Layout New Array:    %fms (%.2fM glyphs/sec)",
+				LayoutBenchmarkNewArrayMillis,
+				glyphCount / LayoutBenchmarkNewArrayMillis / 1000.0
+			);
+			ImGui::Text(
+				"Layout Reused Array: %fms (%.2fM glyphs/sec)",
+				LayoutBenchmarkReusedArrayMillis,
+				glyphCount / LayoutBenchmarkReusedArrayMillis / 1000.0
+			);
+			ImGui::Text(
+				"Layout Cached Runs:  %fms (%.2fM glyphs/sec)",
+				LayoutBenchmarkCachedMillis,
+				glyphCount / LayoutBenchmarkCachedMillis / 1000.0
+			);
+		}
+		if (ImGui::Button("Run Mixed-Script Layout Benchmark")) {
+			runMixedScriptLayoutBenchmark();
+		}
+		EditorGui::displayHelpTooltip("Lays out UTF-8 strings in several scripts with the Arial soft mask font, with and without kerning. Nothing is drawn.");
+		if (MixedScriptBenchmarkGlyphCount > 0) {
+			const double byteCount = static_cast<double>(MixedScriptBenchmarkByteCount);
+			ImGui::Text(
+				"Layout No Kerning: %fms (%.2fMB/sec)",
+				MixedScriptBenchmarkNoKerningMillis,
+				byteCount / MixedScriptBenchmarkNoKerningMillis / 1000.0
+			);
+			ImGui::Text(
+				"Layout Kerning:    %fms (%.2fMB/sec)",
+				MixedScriptBenchmarkKerningMillis,
+				byteCount / MixedScriptBenchmarkKerningMillis / 1000.0
+			);
+		}
 	}
 
 	void DemoLiciousAppLogic::TextDemo::renderImGuiExtras() {
 		//No extra windows required for this demo
 	}
 
+	void DemoLiciousAppLogic::TextDemo::createNameLabels() {
+		ZoneScoped;
+
+		FontBitmap& bitmap = TextRenderer::getFontBitmap(TextRenderer::ARIAL_SOFT_MASK_NAME);
+		const uint32_t labelCount = TextDemo::NameLabelGridWidth * TextDemo::NameLabelGridDepth;
+
+		//Filled before any TextString is created so the strings aren't moved by re-allocation
+		NameLabelStrings.clear();
+		NameLabelStrings.reserve(labelCount);
+		for (uint32_t i = 0; i < labelCount; i++) {
+			NameLabelStrings.emplace_back("Player_" + std::to_string(i));
+		}
+
+		NameLabels.reserve(labelCount);
+		const float halfWidth = static_cast<float>(TextDemo::NameLabelGridWidth) * TextDemo::NameLabelSpacing * 0.5f;
+		for (uint32_t z = 0; z < TextDemo::NameLabelGridDepth; z++) {
+			for (uint32_t x = 0; x < TextDemo::NameLabelGridWidth; x++) {
+				std::unique_ptr<TextString>& label = NameLabels.emplace_back(
+					std::make_unique<TextString>(NameLabelStrings[NameLabels.size()].c_str(), bitmap, 0.5f)
+				);
+				label->setRoot({
+					(static_cast<float>(x) * TextDemo::NameLabelSpacing) - halfWidth,
+					1.0f + static_cast<float>((x + z) % 3),
+					-static_cast<float>(z) * TextDemo::NameLabelSpacing
+				});
+			}
+		}
+	}
+
+	void DemoLiciousAppLogic::TextDemo::runLayoutBenchmark() {
+		ZoneScoped;
+
+		const FontBitmap& bitmap = TextRenderer::getFontBitmap(TextRenderer::ARIAL_SOFT_MASK_NAME);
+
+		std::vector<std::string> strings;
+		strings.reserve(LayoutBenchmarkStringCount);
+		size_t charCount = 0;
+		for (uint32_t i = 0; i < LayoutBenchmarkStringCount; i++) {
+			switch (i % 3) {
+				case 0:
+					strings.emplace_back("Time: " + std::to_string(i * 1.25f) + "s");
+					break;
+				case 1:
+					strings.emplace_back("Score: " + std::to_string(i * 137) + "\tCombo: x" + std::to_string(i % 17));
+					break;
+				case 2:
+					strings.emplace_back("Player" + std::to_string(i) + ": The quick brown fox jumps over the lazy dog!");
+					break;
+			}
+			charCount += strings.back().size();
+		}
+
+		//Stops the lookups being optimised away
+		float lookupSink = 0.0f;
+
+		{
+			const auto& glyphMap = bitmap.getGlyphMap();
+			const double start = Time::getCurrentTimeMillis();
+			for (uint32_t iteration = 0; iteration < LayoutBenchmarkIterations; iteration++) {
+				for (const std::string& string : strings) {
+					for (const char c : string) {
+						const auto itr = glyphMap.find(static_cast<uint32_t>(static_cast<unsigned char>(c)));
+						if (itr != glyphMap.end()) {
+							lookupSink += itr->second.AdvanceX;
+						}
+					}
+				}
+			}
+			LayoutBenchmarkMapLookupMillis = Time::getCurrentTimeMillis() - start;
+		}
+
+		{
+			const double start = Time::getCurrentTimeMillis();
+			for (uint32_t iteration = 0; iteration < LayoutBenchmarkIterations; iteration++) {
+				for (const std::string& string : strings) {
+					for (const char c : string) {
+						const GlyphData* glyph = bitmap.getGlyph(static_cast<uint32_t>(static_cast<unsigned char>(c)));
+						if (glyph != nullptr) {
+							lookupSink += glyph->AdvanceX;
+						}
+					}
+				}
+			}
+			LayoutBenchmarkTableLookupMillis = Time::getCurrentTimeMillis() - start;
+		}
+
+		size_t glyphCount = 0;
+		{
+			const double start = Time::getCurrentTimeMillis();
+			for (uint32_t iteration = 0; iteration < LayoutBenchmarkIterations; iteration++) {
+				for (const std::string& string : strings) {
+					std::vector<Quad> quads = TextString::getStringAsQuads(string.c_str(), bitmap);
+					glyphCount += quads.size();
+				}
+			}
+			LayoutBenchmarkNewArrayMillis = Time::getCurrentTimeMillis() - start;
+		}
+
+		{
+			std::vector<Quad> quads;
+			const double start = Time::getCurrentTimeMillis();
+			for (uint32_t iteration = 0; iteration < LayoutBenchmarkIterations; iteration++) {
+				for (const std::string& string : strings) {
+					quads.clear();
+					TextString::appendStringAsQuads(quads, string.c_str(), bitmap, { 0.0f, 0.0f, 0.0f });
+				}
+			}
+			LayoutBenchmarkReusedArrayMillis = Time::getCurrentTimeMillis() - start;
+		}
+
+		{
+			//Separate from the renderer's cache so the benchmark doesn't evict its runs
+			GlyphRunCache cache(16 * 1024 * 1024);
+			std::vector<Quad> quads;
+			const double start = Time::getCurrentTimeMillis();
+			for (uint32_t iteration = 0; iteration < LayoutBenchmarkIterations; iteration++) {
+				for (const std::string& string : strings) {
+					quads.clear();
+					cache.appendStringAsQuads(quads, string.c_str(), bitmap, { 0.0f, 0.0f, 0.0f }, 1.0f, { 1.0f, 1.0f, 1.0f, 1.0f }, ETextFlags2d::NONE);
+				}
+			}
+			LayoutBenchmarkCachedMillis = Time::getCurrentTimeMillis() - start;
+		}
+
+		LayoutBenchmarkCharCount = charCount * LayoutBenchmarkIterations;
+		LayoutBenchmarkGlyphCount = glyphCount;
+
+		LOG_INFO(
+			"Text layout benchmark: " << glyphCount << " glyphs. Map lookup: " << LayoutBenchmarkMapLookupMillis <<
+			"ms Table lookup: " << LayoutBenchmarkTableLookupMillis << "ms New array: " << LayoutBenchmarkNewArrayMillis <<
+			"ms Reused array: " << LayoutBenchmarkReusedArrayMillis << "ms Cached runs: " << LayoutBenchmarkCachedMillis <<
+			"ms (sink: " << lookupSink << ")"
+		);
+	}
+
+	void DemoLiciousAppLogic::TextDemo::runMixedScriptLayoutBenchmark() {
+		ZoneScoped;
+
+		const FontBitmap& bitmap = TextRenderer::getFontBitmap(TextRenderer::ARIAL_SOFT_MASK_NAME);
+
+		//Escaped so the source file's encoding doesn't matter
+		const std::array<const char*, 7> corpus = {
+			"AVAST! To WAVy Tall LT. Yo, We Try",
+			"Caf\xC3\xA9 cr\xC3\xA8me br\xC3\xBBl\xC3\xA9" "e, na\xC3\xAFve fa\xC3\xA7" "ade",
+			"Gr\xC3\xBC\xC3\x9F Gott! \xC3\x9C" "ber 100 Stra\xC3\x9F" "en",
+			"\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82, \xD0\xBC\xD0\xB8\xD1\x80! \xD0\xA1\xD1\x87\xD1\x91\xD1\x82: 42",
+			"\xCE\x93\xCE\xB5\xCE\xB9\xCE\xAC \xCF\x83\xCE\xBF\xCF\x85 \xCE\x9A\xCF\x8C\xCF\x83\xCE\xBC\xCE\xB5",
+			"\xE3\x81\x93\xE3\x82\x93\xE3\x81\xAB\xE3\x81\xA1\xE3\x81\xAF\xE4\xB8\x96\xE7\x95\x8C Score: 9001",
+			"Level up! \xF0\x9F\x8E\x89 Combo x7"
+		};
+
+		std::vector<std::string> strings;
+		strings.reserve(LayoutBenchmarkStringCount);
+		size_t byteCount = 0;
+		for (uint32_t i = 0; i < LayoutBenchmarkStringCount; i++) {
+			strings.emplace_back(std::string(corpus[i % corpus.size()]) + " #" + std::to_string(i));
+			byteCount += strings.back().size();
+		}
+
+		const ETextFlags2d noKerningFlags = ETextFlags2d::NO_KERNING | ETextFlags2d::IGNORE_MISSING_GLYPHS;
+		const ETextFlags2d kerningFlags = ETextFlags2d::IGNORE_MISSING_GLYPHS;
+
+		std::vector<Quad> quads;
+		//Stops the layout being optimised away
+		float layoutSink = 0.0f;
+		size_t glyphCount = 0;
+		{
+			const double start = Time::getCurrentTimeMillis();
+			for (uint32_t iteration = 0; iteration < LayoutBenchmarkIterations; iteration++) {
+				for (const std::string& string : strings) {
+					quads.clear();
+					glyphCount += TextString::appendStringAsQuads(quads, string.c_str(), bitmap, { 0.0f, 0.0f, 0.0f }, 1.0f, { 1.0f, 1.0f, 1.0f, 1.0f }, noKerningFlags);
+					layoutSink += quads.empty() ? 0.0f : quads.back().Position.x;
+				}
+			}
+			MixedScriptBenchmarkNoKerningMillis = Time::getCurrentTimeMillis() - start;
+		}
+
+		{
+			const double start = Time::getCurrentTimeMillis();
+			for (uint32_t iteration = 0; iteration < LayoutBenchmarkIterations; iteration++) {
+				for (const std::string& string : strings) {
+					quads.clear();
+					TextString::appendStringAsQuads(quads, string.c_str(), bitmap, { 0.0f, 0.0f, 0.0f }, 1.0f, { 1.0f, 1.0f, 1.0f, 1.0f }, kerningFlags);
+					layoutSink += quads.empty() ? 0.0f : quads.back().Position.x;
+				}
+			}
+			MixedScriptBenchmarkKerningMillis = Time::getCurrentTimeMillis() - start;
+		}
+
+		MixedScriptBenchmarkByteCount = byteCount * LayoutBenchmarkIterations;
+		MixedScriptBenchmarkGlyphCount = glyphCount;
+
+		LOG_INFO(
+			"Mixed-script layout benchmark: " << MixedScriptBenchmarkByteCount << " bytes, " << glyphCount << " glyphs, " <<
+			bitmap.getKerningCount() << " kerning pairs. No kerning: " << MixedScriptBenchmarkNoKerningMillis <<
+			"ms Kerning: " << MixedScriptBenchmarkKerningMillis << "ms (sink: " << layoutSink << ")"
+		);
+	}
+
 	void DemoLiciousAppLogic::LineDemo::init() {
 		ZoneScoped;
 
@@ -2229,12 +2974,128 @@ namespace DOH::EDITOR {
 		if (nameTaken) {
 			EditorGui::displayWarningTooltip("Name taken, please choose another.");
 		}
+
+		ImGui::Text("Parse Benchmark:");
+		if (ImGui::InputInt("Runs Per File", &ParseBenchmarkRuns, 5, 20)) {
+			if (ParseBenchmarkRuns < 1) {
+				ParseBenchmarkRuns = 1;
+			}
+		}
+		if (ImGui::InputInt("Synthetic File MB", &ParseBenchmarkSyntheticMegaBytes, 1, 8)) {
+			ParseBenchmarkSyntheticMegaBytes = std::clamp(ParseBenchmarkSyntheticMegaBytes, 1, 256);
+		}
+		if (ImGui::Button("Run Parse Benchmark")) {
+			runParseBenchmark();
+		}
+		EditorGui::displayHelpTooltip("Parse and write every JSON file in res/demos, the font meta file and a generated file. Blocks until finished.");
+		for (const JsonParseBenchmarkResult& result : ParseBenchmarkResults) {
+			ImGui::Text(
+				"%s: %iKB %i nodes, Document %.1fMB/s (%fms), Document + JsonElement %.1fMB/s (%fms), Stream %.1fMB/s (%fms), Write %.1fMB/s (%fms)",
+				result.Name.c_str(),
+				static_cast<int>(result.ByteSize / 1024),
+				static_cast<int>(result.NodeCount),
+				result.getDocumentMegaBytesPerSecond(),
+				result.RunCount > 0 ? result.TotalDocumentMillis / result.RunCount : 0.0,
+				result.getElementMegaBytesPerSecond(),
+				result.RunCount > 0 ? (result.TotalDocumentMillis + result.TotalElementMillis) / result.RunCount : 0.0,
+				result.getStreamMegaBytesPerSecond(),
+				result.RunCount > 0 ? result.TotalStreamMillis / result.RunCount : 0.0,
+				result.getWriteMegaBytesPerSecond(),
+				result.RunCount > 0 ? result.TotalWriteMillis / result.RunCount : 0.0
+			);
+		}
 	}
 
 	void DemoLiciousAppLogic::JsonDemo::renderImGuiExtras() {
 
 	}
 
+	void DemoLiciousAppLogic::JsonDemo::runParseBenchmark() {
+		ZoneScoped;
+
+		std::vector<std::pair<std::string, std::vector<char>>> sources;
+		for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator("Dough/Dough/res/demos")) {
+			if (entry.is_regular_file() && entry.path().extension() == ".json") {
+				sources.emplace_back(entry.path().filename().string(), ResourceHandler::readFile(entry.path().string()));
+			}
+		}
+		sources.emplace_back("arial_msdf_32px_meta.json", ResourceHandler::readFile("Dough/Dough/res/fonts/arial_msdf_32px_meta.json"));
+		sources.emplace_back(
+			"Synthetic " + std::to_string(ParseBenchmarkSyntheticMegaBytes) + "MB",
+			JsonDemo::createSyntheticJson(static_cast<size_t>(ParseBenchmarkSyntheticMegaBytes) * 1024 * 1024)
+		);
+
+		ParseBenchmarkResults.clear();
+		for (const auto& [name, source] : sources) {
+			JsonParseBenchmarkResult& result = ParseBenchmarkResults.emplace_back();
+			result.Name = name;
+			result.ByteSize = source.size();
+
+			for (int run = 0; run < ParseBenchmarkRuns; run++) {
+				std::vector<char> sourceCopy = source;
+
+				const double preParse = Time::getCurrentTimeMillis();
+				std::shared_ptr<JsonDocument> document = JsonDocument::parse(std::move(sourceCopy), name.c_str());
+				const double postParse = Time::getCurrentTimeMillis();
+				if (document == nullptr) {
+					LOG_ERR("JsonDemo::runParseBenchmark failed to parse: " << name);
+					break;
+				}
+
+				JsonElement root = JsonDocument::toElement(document->getRoot());
+				const double postElement = Time::getCurrentTimeMillis();
+
+				std::istringstream stream(std::string(source.begin(), source.end()));
+				AJsonStreamHandler ignoreEventsHandler;
+				const double preStream = Time::getCurrentTimeMillis();
+				JsonStreamReader::readStream(stream, ignoreEventsHandler, name.c_str());
+				const double postStream = Time::getCurrentTimeMillis();
+
+				const double preWrite = Time::getCurrentTimeMillis();
+				JsonStreamWriter writer(JsonDemo::ParseBenchmarkWriteFilePath);
+				writer.writeElement(root);
+				writer.close();
+				const double postWrite = Time::getCurrentTimeMillis();
+
+				result.NodeCount = document->getNodeCount();
+				result.WrittenByteSize = writer.getBytesWritten();
+				result.TotalDocumentMillis += postParse - preParse;
+				result.TotalElementMillis += postElement - postParse;
+				result.TotalStreamMillis += postStream - preStream;
+				result.TotalWriteMillis += postWrite - preWrite;
+				result.RunCount++;
+			}
+		}
+
+		std::filesystem::remove(JsonDemo::ParseBenchmarkWriteFilePath);
+	}
+
+	std::vector<char> DemoLiciousAppLogic::JsonDemo::createSyntheticJson(const size_t targetByteSize) {
+		ZoneScoped;
+
+		//Mix of what the engine's own JSON files contain, nested objects with short keys, numbers, bools and strings with escapes
+		std::string json;
+		json.reserve(targetByteSize + 1024);
+		json.append("{\n\t\"entries\": [\n");
+
+		size_t i = 0;
+		while (json.size() < targetByteSize) {
+			if (i > 0) {
+				json.append(",\n");
+			}
+			json.append("\t\t{\n\t\t\t\"id\": ").append(std::to_string(i));
+			json.append(",\n\t\t\t\"name\": \"entry_").append(std::to_string(i)).append(" \\\"quoted\\\" \\u00e9\\n\"");
+			json.append(",\n\t\t\t\"position\": [ ").append(std::to_string(i * 0.25)).append(", -").append(std::to_string(i % 97)).append(".5e-2, 3.0 ]");
+			json.append(",\n\t\t\t\"enabled\": ").append(i % 3 == 0 ? "true" : "false");
+			json.append(",\n\t\t\t\"parent\": null");
+			json.append(",\n\t\t\t\"tags\": { \"kbm\": [ { \"type\": \"KEY_PRESS\", \"value\": \"SPACE\" } ], \"weight\": 1 }\n\t\t}");
+			i++;
+		}
+		json.append("\n\t]\n}\n");
+
+		return std::vector<char>(json.begin(), json.end());
+	}
+
 	void DemoLiciousAppLogic::InputActionDemo::init() {
 		ActionMap = std::make_unique<InputActionMap>();
 
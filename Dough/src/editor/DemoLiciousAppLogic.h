@@ -113,10 +113,32 @@ namespace DOH::EDITOR {
 			std::unique_ptr<GraphicsPipelineInstanceInfo> ScenePipelineInfo;
 			std::unique_ptr<GraphicsPipelineInstanceInfo> SceneWireframePipelineInfo;
 
+			//Models are read on worker threads, LoadedModels[i] is nullptr until ModelLoads[i] is ready and it's uploaded in update.
 			std::vector<std::shared_ptr<ModelVulkan>> LoadedModels;
+			std::vector<std::future<std::shared_ptr<Model3dCreationData>>> ModelLoads;
 			std::vector<std::shared_ptr<RenderableModelVulkan>> RenderableObjects;
+			//Objects added before their model has loaded, added to RenderableObjects once it has
+			struct PendingObject {
+				uint32_t ModelIndex;
+				std::shared_ptr<TransformationData> Transformation;
+			};
+			std::vector<PendingObject> PendingObjects;
+
+			//Time to load LoadBenchmarkCount textures and obj models, one after another on the main thread and all at once with ResourceHandler's async loads.
+			//Only reading and decoding is timed, creating GPU resources is the same either way.
+			//Assets are loaded from their cooked file, UncookedSerialMillis is one after another decoding the source file instead (without generating mips for textures).
+			struct LoadBenchmarkResult {
+				std::string Name;
+				uint32_t Count = 0;
+				double SerialMillis = 0.0;
+				double ParallelMillis = 0.0;
+				double UncookedSerialMillis = 0.0;
+			};
+			std::vector<LoadBenchmarkResult> LoadBenchmarkResults;
+			int LoadBenchmarkCount = 32;
 
 			std::shared_ptr<ModelVulkan> TexturedModel;
+			std::future<std::shared_ptr<Model3dCreationData>> TexturedModelLoad;
 			std::shared_ptr<DescriptorSetsInstanceVulkan> TexturedModelDescriptorSets;
 			std::shared_ptr<RenderableModelVulkan> RenderableTexturedModel;
 
@@ -156,6 +178,7 @@ namespace DOH::EDITOR {
 				const float roll = 0.0f,
 				const float scale = 1.0f
 			);
+			void addObject(const uint32_t modelIndex, std::shared_ptr<TransformationData> transform);
 			inline void addRandomisedObject() {
 				addObject(
 					rand() % LoadedModels.size(),
@@ -171,6 +194,8 @@ namespace DOH::EDITOR {
 			}
 
 			void imGuiDrawObjDemoItem(DOH::RenderableModelVulkan& model, const std::string& uniqueImGuiId);
+			void updateModelLoads();
+			void runLoadBenchmark();
 		};
 
 		class CustomDemo : public ADemo {
@@ -288,6 +313,37 @@ namespace DOH::EDITOR {
 				bool Update = false;
 				bool Render = false;
 
+				//Benchmark comparing the vertex expanded and instanced ShapeRenderer quad paths.
+				//Each path is used for BenchmarkFramesPerPath frames, vertex path first.
+				struct QuadPathBenchmarkResult {
+					double TotalSubmitMillis = 0.0;
+					double TotalRenderMillis = 0.0;
+					size_t TotalUploadBytes = 0;
+					uint32_t FrameCount = 0;
+
+					inline double getAvgSubmitMillis() const { return FrameCount > 0 ? TotalSubmitMillis / FrameCount : 0.0; }
+					//The first frame of a phase has no render time of its own
+					inline double getAvgRenderMillis() const { return FrameCount > 1 ? TotalRenderMillis / (FrameCount - 1) : 0.0; }
+					inline double getAvgUploadMegaBytes() const { return FrameCount > 0 ? static_cast<double>(TotalUploadBytes) / FrameCount / (1024.0 * 1024.0) : 0.0; }
+				};
+				QuadPathBenchmarkResult BenchmarkVertexResult;
+				QuadPathBenchmarkResult BenchmarkInstancedResult;
+				int BenchmarkFramesPerPath = 300;
+				int BenchmarkFrame = 0;
+				bool BenchmarkRunning = false;
+				bool BenchmarkInstancedPhase = false;
+				bool InstancingBeforeBenchmark = true;
+
+				//Micro-benchmark of per-quad submission cost, TexturedSubmitBenchmarkQuadCount individually textured quads spread over
+				//TexturedSubmitBenchmarkTextureCount textures. Uses the same batch pool and texture slot lookup as ShapeRenderer::drawQuadTextured*
+				//but with its own BatchManagers and TextureArray so the renderer's state isn't touched and nothing is drawn.
+				static constexpr size_t TexturedSubmitBenchmarkQuadCount = 1000000;
+				static constexpr uint32_t TexturedSubmitBenchmarkTextureCount = 8;
+				std::vector<std::shared_ptr<TextureVulkan>> TexturedSubmitBenchmarkTextures;
+				double TexturedSubmitVertexMillis = 0.0;
+				double TexturedSubmitInstancedMillis = 0.0;
+				uint32_t TexturedSubmitBatchCount = 0;
+
 				BouncingQuadDemo(SharedDemoResources& sharedResources)
 				:	ADemo(sharedResources)
 				{}
@@ -301,6 +357,9 @@ namespace DOH::EDITOR {
 
 				void addRandomQuads(size_t count);
 				void popQuads(size_t count);
+				void startPathBenchmark();
+				void updatePathBenchmark(double submitMillis);
+				void runTexturedSubmitBenchmark();
 			};
 
 			class CircleDemo : public ADemo {
@@ -369,6 +428,54 @@ namespace DOH::EDITOR {
 		
 			bool Update = false;
 			bool Render = false;
+			bool StaticStrings = false;
+
+			//Loaded and unloaded at runtime through TextRenderer::loadFontBitmap, uses the same files as the default font.
+			static constexpr const char* RuntimeFontName = "Arial-SoftMask-Runtime";
+			std::vector<Quad> RuntimeFontQuads;
+
+			//Scrolling log panel, LogPanelLineCount lines laid out every frame clipped to the panel so only the visible lines are paid for.
+			static constexpr uint32_t LogPanelLineCount = 5000;
+			static constexpr float LogPanelScale = 0.05f;
+			static constexpr glm::vec2 LogPanelBotLeft = { 0.3f, -0.9f };
+			static constexpr glm::vec2 LogPanelTopRight = { 1.7f, 0.0f };
+			std::string LogPanelText;
+			std::vector<Quad> LogPanelQuads;
+			bool RenderLogPanel = false;
+			bool LogPanelWrap = false;
+			int LogPanelAlignment = 0;
+			float LogPanelScroll = 0.0f;
+			double LogPanelLayoutMillis = 0.0;
+
+			//Floating scene name labels spread over a grid, most are out of view at any time so scene view culling skips them.
+			//Created the first time they are rendered. TextString doesn't own its string so the names are kept here.
+			static constexpr uint32_t NameLabelGridWidth = 50;
+			static constexpr uint32_t NameLabelGridDepth = 40;
+			static constexpr float NameLabelSpacing = 4.0f;
+			std::vector<std::string> NameLabelStrings;
+			std::vector<std::unique_ptr<TextString>> NameLabels;
+			bool RenderNameLabels = false;
+			bool SceneViewCulling = true;
+
+			//Text layout benchmark, lays out LayoutBenchmarkStringCount HUD-like strings LayoutBenchmarkIterations times.
+			//Compares glyph lookup through the glyph map against FontBitmap::getGlyph and laying out into a new array per string
+			//(getStringAsQuads, through the renderer's glyph run cache) against a re-used one (appendStringAsQuads), and a re-used one
+			//through a glyph run cache big enough for every string so all but the first iteration hit. Nothing is drawn.
+			static constexpr uint32_t LayoutBenchmarkStringCount = 500;
+			static constexpr uint32_t LayoutBenchmarkIterations = 100;
+			size_t LayoutBenchmarkCharCount = 0;
+			size_t LayoutBenchmarkGlyphCount = 0;
+			double LayoutBenchmarkMapLookupMillis = 0.0;
+			double LayoutBenchmarkTableLookupMillis = 0.0;
+			double LayoutBenchmarkNewArrayMillis = 0.0;
+			double LayoutBenchmarkReusedArrayMillis = 0.0;
+			double LayoutBenchmarkCachedMillis = 0.0;
+			//Lays out a mixed-script (Latin, accented Latin, Cyrillic, Greek, CJK & emoji) UTF-8 corpus into a re-used array
+			//with and without kerning. Arial only has ASCII glyphs so most non-Latin chars are decoded and looked up but skipped.
+			size_t MixedScriptBenchmarkByteCount = 0;
+			size_t MixedScriptBenchmarkGlyphCount = 0;
+			double MixedScriptBenchmarkNoKerningMillis = 0.0;
+			double MixedScriptBenchmarkKerningMillis = 0.0;
 
 			TextDemo(SharedDemoResources& sharedResources)
 			:	ADemo(sharedResources)
@@ -380,6 +487,10 @@ namespace DOH::EDITOR {
 			virtual void renderImGuiMainTab() override;
 			virtual void renderImGuiExtras() override;
 			virtual const char* getName() override { return "Text"; }
+
+			void runLayoutBenchmark();
+			void runMixedScriptLayoutBenchmark();
+			void createNameLabels();
 		};
 
 		class LineDemo : public ADemo {
@@ -561,10 +672,46 @@ namespace DOH::EDITOR {
 			std::shared_ptr<JsonFileData> EditableData;
 			char FileNameBuffer[1024];
 
+			//Parse throughput of JsonDocument, of JsonDocument then converting to JsonElements (what JsonFileReader::read does)
+			//and of JsonStreamReader sending events to a handler that ignores them, over every file in res/demos, the font meta file
+			//and a generated file of ParseBenchmarkSyntheticMegaBytes. Each source is parsed ParseBenchmarkRuns times, copying the source before each run isn't timed.
+			//Writing the JsonElements back out with a JsonStreamWriter (what JsonFileWriter does) is timed too, to ParseBenchmarkWriteFilePath which is deleted afterwards.
+			struct JsonParseBenchmarkResult {
+				std::string Name;
+				size_t ByteSize = 0;
+				size_t NodeCount = 0;
+				double TotalDocumentMillis = 0.0;
+				double TotalElementMillis = 0.0;
+				double TotalStreamMillis = 0.0;
+				double TotalWriteMillis = 0.0;
+				size_t WrittenByteSize = 0;
+				uint32_t RunCount = 0;
+
+				inline double getDocumentMegaBytesPerSecond() const {
+					return TotalDocumentMillis > 0.0 ? (static_cast<double>(ByteSize) * RunCount / (1024.0 * 1024.0)) / (TotalDocumentMillis / 1000.0) : 0.0;
+				}
+				inline double getElementMegaBytesPerSecond() const {
+					const double totalMillis = TotalDocumentMillis + TotalElementMillis;
+					return totalMillis > 0.0 ? (static_cast<double>(ByteSize) * RunCount / (1024.0 * 1024.0)) / (totalMillis / 1000.0) : 0.0;
+				}
+				inline double getStreamMegaBytesPerSecond() const {
+					return TotalStreamMillis > 0.0 ? (static_cast<double>(ByteSize) * RunCount / (1024.0 * 1024.0)) / (TotalStreamMillis / 1000.0) : 0.0;
+				}
+				inline double getWriteMegaBytesPerSecond() const {
+					return TotalWriteMillis > 0.0 ? (static_cast<double>(WrittenByteSize) * RunCount / (1024.0 * 1024.0)) / (TotalWriteMillis / 1000.0) : 0.0;
+				}
+			};
+			std::vector<JsonParseBenchmarkResult> ParseBenchmarkResults;
+			int ParseBenchmarkRuns = 20;
+			int ParseBenchmarkSyntheticMegaBytes = 8;
+			constexpr static const char* ParseBenchmarkWriteFilePath = "localJsonWriteBenchmark.json";
+
 			JsonDemo(SharedDemoResources& sharedResources)
 			:	ADemo(sharedResources),
 				FileNameBuffer("localSave_0")
 			{}
+			void runParseBenchmark();
+			static std::vector<char> createSyntheticJson(const size_t targetByteSize);
 			virtual void init() override;
 			virtual void close() override;
 			virtual void update(float delta) override;
@@ -533,6 +533,98 @@ UPS displayed is the count of frames in the last full second interval)"
 				ImGui::Text("VertexBuffer Binds: %i", debugInfo.VertexBufferBinds);
 				ImGui::Text("IndexBuffer Binds: %i", debugInfo.IndexBufferBinds);
 				ImGui::Text("DescriptorSet Binds: %i", debugInfo.DescriptorSetBinds);
+
+				//Upload info
+				const UploadRingVulkan& uploadRing = renderer.getContext().getUploadRing();
+				ImGui::NewLine();
+				ImGui::Text("Upload Info:");
+				EditorGui::displayHelpTooltip("Vertex data written to the shared upload ring by the built-in renderers this frame");
+				ImGui::Text("ShapeRenderer: %.2f KiB", static_cast<double>(debugInfo.ShapeRendererUploadBytes) / 1024.0);
+				ImGui::Text("TextRenderer: %.2f KiB", static_cast<double>(debugInfo.TextRendererUploadBytes) / 1024.0);
+				ImGui::Text("LineRenderer: %.2f KiB", static_cast<double>(debugInfo.LineRendererUploadBytes) / 1024.0);
+				ImGui::Text(
+					"Ring: %.2f of %.2f MiB per frame (Peak: %.2f MiB)",
+					static_cast<double>(uploadRing.getLastFrameUsedBytes()) / (1024.0 * 1024.0),
+					static_cast<double>(uploadRing.getFrameRegionByteSize()) / (1024.0 * 1024.0),
+					static_cast<double>(uploadRing.getPeakFrameUsedBytes()) / (1024.0 * 1024.0)
+				);
+				ImGui::Text("Ring Allocations: %i Grows: %i", uploadRing.getLastFrameAllocationCount(), uploadRing.getGrowCount());
+
+				//Device memory info
+				const DeviceMemoryAllocatorVulkan& memoryAllocator = renderer.getContext().getMemoryAllocator();
+				ImGui::NewLine();
+				ImGui::Text("Device Memory Info:");
+				EditorGui::displayHelpTooltip(
+					"Slot waste is lost to rounding allocations up to their size class. Free is reserved by blocks but not allocated."
+				);
+				ImGui::Text(
+					"Device Allocations: %i of %i",
+					memoryAllocator.getDeviceAllocationCount(),
+					memoryAllocator.getMaxMemoryAllocationCount()
+				);
+				for (uint32_t i = 0; i < memoryAllocator.getMemoryTypeCount(); i++) {
+					const DeviceMemoryTypeStats& stats = memoryAllocator.getMemoryTypeStats(i);
+					if (stats.BlockCount == 0 && stats.DedicatedAllocationCount == 0) {
+						continue;
+					}
+
+					const VkMemoryPropertyFlags flags = memoryAllocator.getMemoryTypeFlags(i);
+					ImGui::Text(
+						"Type %i%s%s:",
+						i,
+						(flags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT) != 0 ? " Device" : "",
+						(flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0 ? " Host" : ""
+					);
+					ImGui::Text(
+						"  Blocks: %i (%.2f MiB) Allocations: %i Used: %.2f MiB",
+						stats.BlockCount,
+						static_cast<double>(stats.BlockBytes) / (1024.0 * 1024.0),
+						stats.BlockAllocationCount,
+						static_cast<double>(stats.UsedBytes) / (1024.0 * 1024.0)
+					);
+					ImGui::Text(
+						"  Slot Waste: %.2f MiB Free: %.2f MiB",
+						static_cast<double>(stats.SlotBytes - stats.UsedBytes) / (1024.0 * 1024.0),
+						static_cast<double>(stats.BlockBytes - stats.SlotBytes) / (1024.0 * 1024.0)
+					);
+					ImGui::Text(
+						"  Dedicated: %i (%.2f MiB)",
+						stats.DedicatedAllocationCount,
+						static_cast<double>(stats.DedicatedBytes) / (1024.0 * 1024.0)
+					);
+				}
+
+				//Staging upload info
+				const StagingUploadQueueVulkan& stagingUploadQueue = renderer.getContext().getStagingUploadQueue();
+				ImGui::NewLine();
+				ImGui::Text("Staging Upload Info:");
+				ImGui::Text(
+					"Submitted Batches: %i In Flight: %i",
+					stagingUploadQueue.getSubmittedBatchCount(),
+					stagingUploadQueue.getInFlightBatchCount()
+				);
+				ImGui::Text(
+					"Last Batch: %i uploads (%.2f KiB)",
+					stagingUploadQueue.getLastBatchUploadCount(),
+					static_cast<double>(stagingUploadQueue.getLastBatchByteSize()) / 1024.0
+				);
+				ImGui::Text("Total Uploaded: %.2f MiB", static_cast<double>(stagingUploadQueue.getTotalUploadedBytes()) / (1024.0 * 1024.0));
+
+				//Pipeline cache info
+				const PipelineCacheVulkan& pipelineCache = renderer.getContext().getPipelineCache();
+				ImGui::NewLine();
+				ImGui::Text("Pipeline Cache Info:");
+				EditorGui::displayHelpTooltip(pipelineCache.getFilePath().c_str());
+				if (pipelineCache.isLoadedFromFile()) {
+					ImGui::Text("Loaded from file: %.2f KiB", static_cast<double>(pipelineCache.getLoadedByteSize()) / 1024.0);
+				} else {
+					ImGui::Text("Started empty");
+				}
+				ImGui::Text(
+					"Pipelines Created: %i in %.2fms",
+					pipelineCache.getPipelineCreationCount(),
+					pipelineCache.getPipelineCreationTimeMillis()
+				);
 			}
 
 			ImGui::SetNextItemOpen(mEditorSettings->InnerAppCollapseMenu);
@@ -284,7 +284,7 @@ namespace DOH::EDITOR {
 		ImGui::DragFloat3(posLabel.c_str(), glm::value_ptr(geo.Position), 0.05f, -10.0f, 10.0f);
 		ImGui::DragFloat2(sizeLabel.c_str(), glm::value_ptr(geo.Size), 0.05f, -10.0f, 10.0f);
 		ImGui::DragFloat(rotationLabel.c_str(), &geo.Rotation);
-		displayHelpTooltip("INFO:: Rotation not currently supported by quad renderer.");
+		displayHelpTooltip("INFO:: Rotation in radians around the centre of the geometry.");
 	}
 
 	void EditorGui::imGuiControlsQuadImpl(Quad& quad, const char* name) {
@@ -320,7 +320,7 @@ namespace DOH::EDITOR {
 		ImGui::Text("Pos: X: %f, Y: %f, Z: %f", geo.Position.x, geo.Position.y, geo.Position.z);
 		ImGui::Text("Size: W: %f, H: %f", geo.Size.x, geo.Size.y);
 		ImGui::Text("Rotation: %f", geo.Rotation);
-		displayHelpTooltip("INFO:: Rotation not currently supported by quad renderer.");
+		displayHelpTooltip("INFO:: Rotation in radians around the centre of the geometry.");
 	}
 
 	void EditorGui::imGuiInfoQuadImpl(Quad& quad, const char* name) {
@@ -307,7 +307,7 @@ namespace DOH::EDITOR {
 				ImGui::TreePush();
 				ImGui::Unindent();
 
-				//Textures are added to the arrays linearly and there shouldn't be any gaps.
+				//Textures are added to the arrays linearly, slots emptied by TextureArray::removeTexture show the fallback texture.
 				uint32_t slot = 0;
 				for (ResourceViewerUiTexture& viewer : mTextureSlotsUi) {
 					if (ImGui::TreeNode(("[" + std::to_string(slot) + "]").c_str())) {